@@ -25,6 +25,7 @@
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/render/gl_renderer/render_engine_gl_factory.h"
 #include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_engine_ray_cast_factory.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/scene_graph.h"
@@ -412,6 +413,28 @@ void def_geometry_render(py::module m) {
 
   m.def("MakeRenderEngineGl", &MakeRenderEngineGl, doc.MakeRenderEngineGl.doc);
 
+  {
+    using Class = RenderEngineRayCastParams;
+    const auto& cls_doc = doc.RenderEngineRayCastParams;
+    py::class_<Class>(m, "RenderEngineRayCastParams", cls_doc.doc)
+        .def(ParamInit<Class>())
+        .def_readwrite(
+            "default_label", &Class::default_label, cls_doc.default_label.doc)
+        .def_readwrite("default_diffuse", &Class::default_diffuse,
+            cls_doc.default_diffuse.doc)
+        .def_readwrite("default_clear_color", &Class::default_clear_color,
+            cls_doc.default_clear_color.doc)
+        .def_readwrite("relative_resolution_hint",
+            &Class::relative_resolution_hint,
+            cls_doc.relative_resolution_hint.doc)
+        .def_readwrite("num_parallel_executions",
+            &Class::num_parallel_executions,
+            cls_doc.num_parallel_executions.doc);
+  }
+
+  m.def("MakeRenderEngineRayCast", &MakeRenderEngineRayCast,
+      py::arg("params"), doc.MakeRenderEngineRayCast.doc);
+
   m.def("MakeRenderEngineVtk", &MakeRenderEngineVtk, py::arg("params"),
       doc.MakeRenderEngineVtk.doc);
 
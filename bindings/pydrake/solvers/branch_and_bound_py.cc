@@ -55,7 +55,13 @@ PYBIND11_MODULE(branch_and_bound, m) {
               return self.GetSolution(mip_vars, nth_best_solution);
             },
             py::arg("mip_vars"), py::arg("nth_best_solution") = 0,
-            cls_doc.GetSolution.doc_2args_constEigenMatrixBase_int);
+            cls_doc.GetSolution.doc_2args_constEigenMatrixBase_int)
+        .def("set_num_parallel_executions",
+            &Class::set_num_parallel_executions,
+            py::arg("num_parallel_executions"),
+            cls_doc.set_num_parallel_executions.doc)
+        .def("num_parallel_executions", &Class::num_parallel_executions,
+            cls_doc.num_parallel_executions.doc);
   }
 }
 
@@ -20,7 +20,11 @@ PYBIND11_MODULE(osqp, m) {
   py::module::import("pydrake.solvers.mathematicalprogram");
 
   py::class_<OsqpSolver, SolverInterface>(m, "OsqpSolver", doc.OsqpSolver.doc)
-      .def(py::init<>(), doc.OsqpSolver.ctor.doc);
+      .def(py::init<>(), doc.OsqpSolver.ctor.doc)
+      .def("set_persistent_workspace", &OsqpSolver::set_persistent_workspace,
+          py::arg("enabled"), doc.OsqpSolver.set_persistent_workspace.doc)
+      .def("persistent_workspace", &OsqpSolver::persistent_workspace,
+          doc.OsqpSolver.persistent_workspace.doc);
 
   py::class_<OsqpSolverDetails>(
       m, "OsqpSolverDetails", doc.OsqpSolverDetails.doc)
@@ -40,7 +44,9 @@ PYBIND11_MODULE(osqp, m) {
           doc.OsqpSolverDetails.polish_time.doc)
       .def_readonly("run_time", &OsqpSolverDetails::run_time,
           doc.OsqpSolverDetails.run_time.doc)
-      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc);
+      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc)
+      .def_readonly("workspace_reused", &OsqpSolverDetails::workspace_reused,
+          doc.OsqpSolverDetails.workspace_reused.doc);
   AddValueInstantiation<OsqpSolverDetails>(m);
 }
 
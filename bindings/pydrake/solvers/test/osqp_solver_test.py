@@ -24,6 +24,23 @@ class TestOsqpSolver(unittest.TestCase):
             result.get_solver_details().y, np.array([-1., -1.]))
         np.testing.assert_allclose(result.GetDualSolution(constraint1), [1.])
         np.testing.assert_allclose(result.GetDualSolution(constraint2), [1.])
+        self.assertFalse(result.get_solver_details().workspace_reused)
+
+    def test_persistent_workspace(self):
+        prog = mp.MathematicalProgram()
+        x = prog.NewContinuousVariables(2, "x")
+        constraint = prog.AddLinearConstraint(x[0] >= 1)
+        prog.AddQuadraticCost(np.eye(2), np.zeros(2), x)
+        solver = OsqpSolver()
+        self.assertFalse(solver.persistent_workspace())
+        solver.set_persistent_workspace(enabled=True)
+        self.assertTrue(solver.persistent_workspace())
+        result = solver.Solve(prog, None, None)
+        self.assertFalse(result.get_solver_details().workspace_reused)
+        constraint.evaluator().set_bounds([2.], [np.inf])
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.get_solver_details().workspace_reused)
+        self.assertTrue(np.allclose(result.GetSolution(x), [2, 0]))
 
     def unavailable(self):
         """Per the BUILD file, this test is only run when OSQP is disabled."""
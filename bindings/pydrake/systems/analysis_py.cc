@@ -253,7 +253,10 @@ PYBIND11_MODULE(analysis, m) {
             doc.RegionOfAttractionOptions.lyapunov_candidate.doc)
         .def_readwrite("state_variables",
             &RegionOfAttractionOptions::state_variables,
-            doc.RegionOfAttractionOptions.state_variables.doc);
+            doc.RegionOfAttractionOptions.state_variables.doc)
+        .def_readwrite("intern_expressions",
+            &RegionOfAttractionOptions::intern_expressions,
+            doc.RegionOfAttractionOptions.intern_expressions.doc);
 
     m.def("RegionOfAttraction", &RegionOfAttraction, py::arg("system"),
         py::arg("context"), py::arg("options") = RegionOfAttractionOptions(),
@@ -23,6 +23,7 @@
 #include "drake/systems/primitives/pass_through.h"
 #include "drake/systems/primitives/random_source.h"
 #include "drake/systems/primitives/saturation.h"
+#include "drake/systems/primitives/signal_log_file.h"
 #include "drake/systems/primitives/signal_logger.h"
 #include "drake/systems/primitives/sine.h"
 #include "drake/systems/primitives/symbolic_vector_system.h"
@@ -239,7 +240,16 @@ PYBIND11_MODULE(primitives, m) {
             py_rvp::reference_internal, doc.SignalLogger.sample_times.doc)
         .def("data", &SignalLogger<T>::data, py_rvp::reference_internal,
             doc.SignalLogger.data.doc)
-        .def("reset", &SignalLogger<T>::reset, doc.SignalLogger.reset.doc);
+        .def("reset", &SignalLogger<T>::reset, doc.SignalLogger.reset.doc)
+        .def("set_max_samples", &SignalLogger<T>::set_max_samples,
+            py::arg("max_samples"), doc.SignalLogger.set_max_samples.doc)
+        .def("max_samples", &SignalLogger<T>::max_samples,
+            doc.SignalLogger.max_samples.doc)
+        .def("StreamToFile", &SignalLogger<T>::StreamToFile,
+            py::arg("filename"), py::arg("chunk_size") = 4096,
+            doc.SignalLogger.StreamToFile.doc)
+        .def("CloseFile", &SignalLogger<T>::CloseFile,
+            doc.SignalLogger.CloseFile.doc);
 
     DefineTemplateClassWithDefault<StateInterpolatorWithDiscreteDerivative<T>,
         Diagram<T>>(m, "StateInterpolatorWithDiscreteDerivative",
@@ -388,6 +398,33 @@ PYBIND11_MODULE(primitives, m) {
           py::arg("num_outputs"), py::arg("sampling_interval_sec"),
           doc.RandomSource.ctor.doc);
 
+  py::class_<SignalLogFileReader>(
+      m, "SignalLogFileReader", doc.SignalLogFileReader.doc)
+      .def(py::init<const std::string&>(), py::arg("filename"),
+          doc.SignalLogFileReader.ctor.doc)
+      .def("num_samples", &SignalLogFileReader::num_samples,
+          doc.SignalLogFileReader.num_samples.doc)
+      .def("get_input_size", &SignalLogFileReader::get_input_size,
+          doc.SignalLogFileReader.get_input_size.doc)
+      .def("sample_time", &SignalLogFileReader::sample_time, py::arg("index"),
+          doc.SignalLogFileReader.sample_time.doc)
+      .def("sample", &SignalLogFileReader::sample, py::arg("index"),
+          doc.SignalLogFileReader.sample.doc)
+      .def("FindFirstSampleAtOrAfter",
+          &SignalLogFileReader::FindFirstSampleAtOrAfter, py::arg("time"),
+          doc.SignalLogFileReader.FindFirstSampleAtOrAfter.doc)
+      .def(
+          "ReadSamples",
+          [](const SignalLogFileReader& self, double start_time,
+              double end_time) {
+            VectorXd sample_times;
+            MatrixXd data;
+            self.ReadSamples(start_time, end_time, &sample_times, &data);
+            return std::make_pair(sample_times, data);
+          },
+          py::arg("start_time"), py::arg("end_time"),
+          doc.SignalLogFileReader.ReadSamples.doc);
+
   py::class_<TrajectorySource<double>, LeafSystem<double>>(
       m, "TrajectorySource", doc.TrajectorySource.doc)
       .def(py::init<const trajectories::Trajectory<double>&, int, bool>(),
@@ -19,6 +19,7 @@
 #include "drake/systems/sensors/camera_info.h"
 #include "drake/systems/sensors/image.h"
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
+#include "drake/systems/sensors/multi_camera_rgbd_sensor.h"
 #include "drake/systems/sensors/pixel_types.h"
 #include "drake/systems/sensors/rgbd_sensor.h"
 
@@ -270,6 +271,43 @@ PYBIND11_MODULE(sensors, m) {
   rgbd_camera_discrete.attr("kDefaultPeriod") =
       double{RgbdSensorDiscrete::kDefaultPeriod};
 
+  {
+    using Class = MultiCameraRgbdSensor;
+    constexpr auto& cls_doc = doc.MultiCameraRgbdSensor;
+    py::class_<Class, LeafSystem<T>> cls(
+        m, "MultiCameraRgbdSensor", cls_doc.doc);
+    py::class_<Class::Camera>(cls, "Camera", cls_doc.Camera.doc)
+        .def(py::init([](FrameId parent_id, const RigidTransformd& X_PB,
+                          const ColorRenderCamera& color_camera,
+                          const DepthRenderCamera& depth_camera) {
+          return Class::Camera{parent_id, X_PB, color_camera, depth_camera};
+        }),
+            py::arg("parent_id"), py::arg("X_PB"), py::arg("color_camera"),
+            py::arg("depth_camera"))
+        .def_readwrite("parent_id", &Class::Camera::parent_id,
+            cls_doc.Camera.parent_id.doc)
+        .def_readwrite("X_PB", &Class::Camera::X_PB, cls_doc.Camera.X_PB.doc)
+        .def_readwrite("color_camera", &Class::Camera::color_camera)
+        .def_readwrite("depth_camera", &Class::Camera::depth_camera);
+    cls  // BR
+        .def(py::init<std::vector<Class::Camera>>(), py::arg("cameras"),
+            cls_doc.ctor.doc)
+        .def("num_cameras", &Class::num_cameras, cls_doc.num_cameras.doc)
+        .def("camera", &Class::camera, py::arg("i"),
+            py_rvp::reference_internal, cls_doc.camera.doc)
+        .def("query_object_input_port", &Class::query_object_input_port,
+            py_rvp::reference_internal, cls_doc.query_object_input_port.doc)
+        .def("color_image_output_port", &Class::color_image_output_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.color_image_output_port.doc)
+        .def("depth_image_32F_output_port",
+            &Class::depth_image_32F_output_port, py::arg("i"),
+            py_rvp::reference_internal, cls_doc.depth_image_32F_output_port.doc)
+        .def("label_image_output_port", &Class::label_image_output_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.label_image_output_port.doc);
+  }
+
   {
     using Class = CameraInfo;
     constexpr auto& cls_doc = doc.CameraInfo;
@@ -26,6 +26,7 @@ class TestAnalysis(unittest.TestCase):
         options = RegionOfAttractionOptions()
         options.lyapunov_candidate = x*x
         options.state_variables = [x]
+        options.intern_expressions = True
         V = RegionOfAttraction(system=sys, context=context, options=options)
 
     def test_integrator_constructors(self):
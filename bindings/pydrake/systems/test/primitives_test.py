@@ -3,7 +3,8 @@ import unittest
 import numpy as np
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import RandomDistribution, RandomGenerator
+from pydrake.common import (
+    RandomDistribution, RandomGenerator, temp_directory)
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.test_utilities.deprecation import catch_drake_warnings
 from pydrake.common.value import AbstractValue
@@ -42,6 +43,7 @@ from pydrake.systems.primitives import (
     PassThrough, PassThrough_,
     RandomSource,
     Saturation, Saturation_,
+    SignalLogFileReader,
     SignalLogger, SignalLogger_,
     Sine, Sine_,
     StateInterpolatorWithDiscreteDerivative,
@@ -158,6 +160,30 @@ class TestGeneral(unittest.TestCase):
         self.assertTrue((t == t_copy).all())
         self.assertTrue((x == x_copy).all())
 
+    def test_signal_logger_bounded_and_streamed(self):
+        filename = temp_directory() + "/signal_logger.bin"
+        builder = DiagramBuilder()
+        source = builder.AddSystem(ConstantVectorSource([2.0, 3.0]))
+        logger = LogOutput(source.get_output_port(0), builder)
+        logger.set_publish_period(0.1)
+        logger.set_max_samples(3)
+        self.assertEqual(logger.max_samples(), 3)
+        logger.StreamToFile(filename=filename, chunk_size=4)
+        diagram = builder.Build()
+        Simulator(diagram).AdvanceTo(1.)
+        logger.CloseFile()
+        self.assertEqual(logger.data().shape, (2, 3))
+
+        reader = SignalLogFileReader(filename=filename)
+        self.assertEqual(reader.num_samples(), 11)
+        self.assertEqual(reader.get_input_size(), 2)
+        self.assertEqual(reader.sample_time(index=0), 0.)
+        numpy_compare.assert_float_equal(reader.sample(index=10), [2., 3.])
+        self.assertEqual(reader.FindFirstSampleAtOrAfter(time=0.45), 5)
+        t, x = reader.ReadSamples(start_time=0.45, end_time=0.75)
+        self.assertEqual(t.shape, (3,))
+        self.assertEqual(x.shape, (2, 3))
+
     def test_linear_affine_system(self):
         # Just make sure linear system is spelled correctly.
         A = np.identity(2)
@@ -368,3 +368,23 @@ class TestSensors(unittest.TestCase):
                               Value[mut.ImageDepth16U])
         self.assertIsInstance(values.get_value(3),
                               Value[mut.ImageLabel16I])
+
+    def test_multi_camera_rgbd_sensor(self):
+        core = RenderCameraCore(
+            "renderer", mut.CameraInfo(4, 3, np.pi/6),
+            ClippingRange(0.1, 6.0), RigidTransform())
+        camera = mut.MultiCameraRgbdSensor.Camera(
+            parent_id=FrameId.get_new_id(), X_PB=RigidTransform(),
+            color_camera=ColorRenderCamera(core, False),
+            depth_camera=DepthRenderCamera(core, DepthRange(0.1, 5.5)))
+        sensor = mut.MultiCameraRgbdSensor(cameras=[camera, camera])
+        self.assertEqual(sensor.num_cameras(), 2)
+        self.assertEqual(sensor.camera(i=1).parent_id, camera.parent_id)
+        self.assertIsInstance(sensor.query_object_input_port(), InputPort)
+        for i in range(2):
+            self.assertIsInstance(sensor.color_image_output_port(i=i),
+                                  OutputPort)
+            self.assertIsInstance(sensor.depth_image_32F_output_port(i=i),
+                                  OutputPort)
+            self.assertIsInstance(sensor.label_image_output_port(i=i),
+                                  OutputPort)
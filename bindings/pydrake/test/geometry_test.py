@@ -75,6 +75,13 @@ class TestGeometry(unittest.TestCase):
                                     mut.render.RenderEngineVtkParams()))
         self.assertTrue(scene_graph.HasRenderer("test_renderer"))
         self.assertEqual(scene_graph.RendererCount(), 1)
+        params = mut.render.RenderEngineRayCastParams(
+            relative_resolution_hint=0.2, num_parallel_executions=2)
+        self.assertEqual(params.num_parallel_executions, 2)
+        scene_graph.AddRenderer("ray_cast",
+                                mut.render.MakeRenderEngineRayCast(params))
+        self.assertTrue(scene_graph.HasRenderer("ray_cast"))
+        self.assertEqual(scene_graph.RendererCount(), 2)
 
         # Test SceneGraphInspector API
         inspector = scene_graph.model_inspector()
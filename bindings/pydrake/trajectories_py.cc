@@ -26,8 +26,10 @@ PYBIND11_MODULE(trajectories, m) {
   py::class_<Trajectory<T>>(m, "Trajectory", doc.Trajectory.doc)
       .def("value", &Trajectory<T>::value, py::arg("t"),
           doc.Trajectory.value.doc)
-      .def("vector_values", &Trajectory<T>::vector_values,
-          doc.Trajectory.vector_values.doc)
+      .def("vector_values",
+          overload_cast_explicit<MatrixX<T>, const std::vector<T>&>(
+              &Trajectory<T>::vector_values),
+          doc.Trajectory.vector_values.doc_1args)
       .def("EvalDerivative", &Trajectory<T>::EvalDerivative, py::arg("t"),
           py::arg("derivative_order") = 1, doc.Trajectory.EvalDerivative.doc)
       .def("MakeDerivative", &Trajectory<T>::MakeDerivative,
@@ -0,0 +1,81 @@
+#include "drake/common/parallelism.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+int SelectNumberOfThreads(int num_parallel_executions, int num_work_items) {
+  DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
+  int num_threads = num_parallel_executions;
+  if (num_parallel_executions == kUseHardwareConcurrency) {
+    // hardware_concurrency() is allowed to return zero when the value is not
+    // computable; fall back to serial execution in that case.
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  return std::max(1, std::min(num_threads, num_work_items));
+}
+
+void ParallelFor(int num_work_items, int num_threads,
+                 const std::function<void(int, int)>& body) {
+  DRAKE_DEMAND(num_threads >= 1);
+  if (num_threads == 1) {
+    for (int item = 0; item < num_work_items; ++item) {
+      body(0, item);
+    }
+    return;
+  }
+
+  std::atomic<int> next_item{0};
+  std::atomic<bool> failed{false};
+  auto worker = [&](int thread_index) {
+    while (!failed.load()) {
+      const int item = next_item.fetch_add(1);
+      if (item >= num_work_items) {
+        return;
+      }
+      try {
+        body(thread_index, item);
+      } catch (...) {
+        // Ask the other workers to stop claiming items; the exception reaches
+        // the caller through the future.
+        failed.store(true);
+        throw;
+      }
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  workers.reserve(num_threads);
+  for (int thread_index = 0; thread_index < num_threads; ++thread_index) {
+    workers.emplace_back(std::async(std::launch::async, worker, thread_index));
+  }
+
+  // Join every worker (even after a failure, since they all reference local
+  // state), then report the first failure, if any.
+  std::exception_ptr first_error;
+  for (auto& future : workers) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!first_error) {
+        first_error = std::current_exception();
+      }
+    }
+  }
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <functional>
+
+namespace drake {
+
+/// Sentinel value for a `num_parallel_executions`-style argument that
+/// requests all work be done serially on the calling thread.
+constexpr int kNoConcurrency = 1;
+
+/// Sentinel value for a `num_parallel_executions`-style argument that
+/// requests one worker per hardware thread, as reported by
+/// std::thread::hardware_concurrency().
+constexpr int kUseHardwareConcurrency = -1;
+
+namespace internal {
+
+/* Resolves a user-facing `num_parallel_executions` request into the number of
+workers to use for `num_work_items` items of work. The result is always in the
+range [1, max(1, num_work_items)].
+@throws std::exception if `num_parallel_executions` is neither positive nor
+kUseHardwareConcurrency. */
+int SelectNumberOfThreads(int num_parallel_executions, int num_work_items);
+
+/* Calls `body(thread_index, item)` exactly once for every `item` in
+[0, num_work_items), using `num_threads` workers. Items are claimed
+dynamically from a shared counter, so the load is balanced even when the
+items' costs vary widely. The `thread_index` is in [0, num_threads) and is
+stable for a given worker, so it may be used to index per-worker scratch data
+(e.g., a cloned Context) that `body` may then use without synchronization.
+
+When `num_threads` is 1 the items are processed in order on the calling
+thread, and no threads are launched.
+
+If any invocation of `body` throws, the remaining unclaimed items are
+abandoned, all workers are joined, and the first exception is rethrown on the
+calling thread.
+
+@pre num_threads >= 1. */
+void ParallelFor(int num_work_items, int num_threads,
+                 const std::function<void(int thread_index, int item)>& body);
+
+}  // namespace internal
+}  // namespace drake
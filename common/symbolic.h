@@ -49,5 +49,6 @@
 #include "drake/common/symbolic_formula_visitor.h"
 #include "drake/common/symbolic_simplification.h"
 #include "drake/common/symbolic_codegen.h"
+#include "drake/common/symbolic_compiled_expression.h"
 // clang-format on
 #undef DRAKE_COMMON_SYMBOLIC_HEADER
@@ -0,0 +1,692 @@
+// NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/symbolic.h"
+#include "drake/common/symbolic_expression_cell.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+using std::unordered_map;
+using std::vector;
+
+namespace {
+
+// These return false where Expression::Evaluate() throws a domain error.
+bool IsInLogDomain(double v) { return v >= 0.0; }
+bool IsInAsinDomain(double v) { return v >= -1.0 && v <= 1.0; }
+bool IsInPowDomain(double v1, double v2) {
+  return !(std::isfinite(v1) && v1 < 0.0 && std::isfinite(v2) &&
+           !is_integer(v2));
+}
+
+}  // namespace
+
+// Translates expressions into a program in static single assignment form, in
+// which instruction i writes the value with id `n + i` (where n is the number
+// of variables), variable j has id j, and constant j has id -(j + 1). Assign()
+// then maps these ids to registers.
+class CompiledExpression::Compiler {
+ public:
+  explicit Compiler(CompiledExpression* program) : program_(*program) {
+    const int n = program_.num_variables();
+    for (int i = 0; i < n; ++i) {
+      const bool inserted =
+          variable_ids_.emplace(program_.variables_[i].get_id(), i).second;
+      if (!inserted) {
+        throw runtime_error(fmt::format(
+            "CompiledExpression: variable {} appears more than once.",
+            program_.variables_[i].get_name()));
+      }
+    }
+  }
+
+  // Returns the id of the value of `e`.
+  int Compile(const Expression& e) {
+    const auto iter = expression_ids_.find(e);
+    if (iter != expression_ids_.end()) {
+      return iter->second;
+    }
+    const int id = DoCompile(e);
+    expression_ids_.emplace(e, id);
+    return id;
+  }
+
+  // Returns the id of the value of `f` (1.0 if true, 0.0 if false).
+  int Compile(const Formula& f) {
+    const auto iter = formula_ids_.find(f);
+    if (iter != formula_ids_.end()) {
+      return iter->second;
+    }
+    const int id = DoCompile(f);
+    formula_ids_.emplace(f, id);
+    return id;
+  }
+
+  // Maps the value ids of the program's instructions and of `output_ids` to
+  // registers, reusing the register of an instruction's value once its last
+  // reader has executed.
+  void Assign(const vector<int>& output_ids) {
+    const int n = program_.num_variables();
+    const int num_constants = program_.constants_.size();
+    vector<Instruction>& instructions = program_.instructions_;
+    const int num_instructions = instructions.size();
+    const int kNever = std::numeric_limits<int>::max();
+
+    // The index of the last instruction that reads each instruction's value.
+    vector<int> last_read(num_instructions, -1);
+    for (int i = 0; i < num_instructions; ++i) {
+      for (const int* id : Operands(&instructions[i])) {
+        if (*id >= n) last_read[*id - n] = i;
+      }
+    }
+    for (int id : output_ids) {
+      if (id >= n) last_read[id - n] = kNever;
+    }
+
+    const int first_temporary = n + num_constants;
+    vector<int> temporary_of_instruction(num_instructions, -1);
+    vector<int> free_temporaries;
+    int num_temporaries = 0;
+    auto to_register = [&](int id) {
+      if (id < 0) return n + (-id - 1);
+      if (id < n) return id;
+      return first_temporary + temporary_of_instruction[id - n];
+    };
+    for (int i = 0; i < num_instructions; ++i) {
+      Instruction& instruction = instructions[i];
+      for (int* operand : Operands(&instruction)) {
+        const int id = *operand;
+        *operand = to_register(id);
+        // Operations are elementwise, so an instruction may overwrite the
+        // register of its own operand.
+        if (id >= n && last_read[id - n] == i) {
+          free_temporaries.push_back(temporary_of_instruction[id - n]);
+          last_read[id - n] = -1;
+        }
+      }
+      int temporary;
+      if (free_temporaries.empty()) {
+        temporary = num_temporaries++;
+      } else {
+        temporary = free_temporaries.back();
+        free_temporaries.pop_back();
+      }
+      temporary_of_instruction[i] = temporary;
+      instruction.out = first_temporary + temporary;
+    }
+    program_.num_registers_ = first_temporary + num_temporaries;
+    program_.outputs_.clear();
+    for (int id : output_ids) {
+      program_.outputs_.push_back(to_register(id));
+    }
+  }
+
+ private:
+  // Returns pointers to the register operands of `instruction`.
+  static vector<int*> Operands(Instruction* instruction) {
+    int* const operands[3] = {&instruction->a, &instruction->b,
+                              &instruction->c};
+    return vector<int*>(operands,
+                        operands + num_operands(instruction->op));
+  }
+
+  // Returns the id of the constant `value`.
+  int Constant(double value) {
+    const auto iter = constant_ids_.find(value);
+    if (iter != constant_ids_.end()) {
+      return iter->second;
+    }
+    program_.constants_.push_back(value);
+    const int id = -static_cast<int>(program_.constants_.size());
+    constant_ids_.emplace(value, id);
+    return id;
+  }
+
+  // Appends an instruction and returns the id of its value.
+  int Emit(OpCode op, int a, int b = -1, int c = -1, double k = 0.0) {
+    Instruction instruction;
+    instruction.op = op;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.c = c;
+    instruction.k = k;
+    program_.instructions_.push_back(instruction);
+    return program_.num_variables() +
+           static_cast<int>(program_.instructions_.size()) - 1;
+  }
+
+  int EmitUnary(OpCode op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)));
+  }
+
+  int EmitBinary(OpCode op, const Expression& e) {
+    const int a = Compile(get_first_argument(e));
+    const int b = Compile(get_second_argument(e));
+    return Emit(op, a, b);
+  }
+
+  // Compiles base^exponent.
+  int CompilePow(const Expression& base, const Expression& exponent) {
+    const int a = Compile(base);
+    if (is_constant(exponent)) {
+      const double k = get_constant_value(exponent);
+      if (k == 1.0) return a;
+      if (k == 2.0) return Emit(OpCode::kMul, a, a);
+      return Emit(OpCode::kPowConstant, a, -1, -1, k);
+    }
+    return Emit(OpCode::kPow, a, Compile(exponent));
+  }
+
+  int DoCompile(const Expression& e) {
+    switch (e.get_kind()) {
+      case ExpressionKind::Constant:
+        return Constant(get_constant_value(e));
+      case ExpressionKind::NaN:
+        program_.contains_nan_ = true;
+        return Constant(std::numeric_limits<double>::quiet_NaN());
+      case ExpressionKind::Var: {
+        const Variable& var = get_variable(e);
+        const auto iter = variable_ids_.find(var.get_id());
+        if (iter == variable_ids_.end()) {
+          throw runtime_error(fmt::format(
+              "CompiledExpression: {} includes variable {}, which is not in "
+              "the list of variables.",
+              e.to_string(), var.to_string()));
+        }
+        return iter->second;
+      }
+      case ExpressionKind::Add: {
+        // Follows the order of operations of Expression::Evaluate(), i.e.
+        // c₀ + c₁e₁ + c₂e₂ + ... from left to right.
+        const double c0 = get_constant_in_addition(e);
+        const auto& expr_to_coeff_map = get_expr_to_coeff_map_in_addition(e);
+        DRAKE_ASSERT(!expr_to_coeff_map.empty());
+        auto iter = expr_to_coeff_map.begin();
+        int result = iter->second == 1.0
+                         ? Compile(iter->first)
+                         : Emit(OpCode::kScale, Compile(iter->first), -1, -1,
+                                iter->second);
+        if (c0 != 0.0) {
+          result = Emit(OpCode::kAddConstant, result, -1, -1, c0);
+        }
+        for (++iter; iter != expr_to_coeff_map.end(); ++iter) {
+          const int t = Compile(iter->first);
+          if (iter->second == 1.0) {
+            result = Emit(OpCode::kAdd, result, t);
+          } else {
+            result = Emit(OpCode::kAxpy, result, t, -1, iter->second);
+          }
+        }
+        return result;
+      }
+      case ExpressionKind::Mul: {
+        // Follows the order of operations of Expression::Evaluate(), i.e.
+        // c₀ * b₁^e₁ * b₂^e₂ * ... from left to right.
+        const double c0 = get_constant_in_multiplication(e);
+        const auto& base_to_exponent_map =
+            get_base_to_exponent_map_in_multiplication(e);
+        DRAKE_ASSERT(!base_to_exponent_map.empty());
+        auto iter = base_to_exponent_map.begin();
+        int result = CompilePow(iter->first, iter->second);
+        if (c0 != 1.0) {
+          result = Emit(OpCode::kScale, result, -1, -1, c0);
+        }
+        for (++iter; iter != base_to_exponent_map.end(); ++iter) {
+          result = Emit(OpCode::kMul, result,
+                        CompilePow(iter->first, iter->second));
+        }
+        return result;
+      }
+      case ExpressionKind::Div:
+        return EmitBinary(OpCode::kDiv, e);
+      case ExpressionKind::Pow:
+        return CompilePow(get_first_argument(e), get_second_argument(e));
+      case ExpressionKind::Atan2:
+        return EmitBinary(OpCode::kAtan2, e);
+      case ExpressionKind::Min:
+        return EmitBinary(OpCode::kMin, e);
+      case ExpressionKind::Max:
+        return EmitBinary(OpCode::kMax, e);
+      case ExpressionKind::Log:
+        return EmitUnary(OpCode::kLog, e);
+      case ExpressionKind::Abs:
+        return EmitUnary(OpCode::kAbs, e);
+      case ExpressionKind::Exp:
+        return EmitUnary(OpCode::kExp, e);
+      case ExpressionKind::Sqrt:
+        return EmitUnary(OpCode::kSqrt, e);
+      case ExpressionKind::Sin:
+        return EmitUnary(OpCode::kSin, e);
+      case ExpressionKind::Cos:
+        return EmitUnary(OpCode::kCos, e);
+      case ExpressionKind::Tan:
+        return EmitUnary(OpCode::kTan, e);
+      case ExpressionKind::Asin:
+        return EmitUnary(OpCode::kAsin, e);
+      case ExpressionKind::Acos:
+        return EmitUnary(OpCode::kAcos, e);
+      case ExpressionKind::Atan:
+        return EmitUnary(OpCode::kAtan, e);
+      case ExpressionKind::Sinh:
+        return EmitUnary(OpCode::kSinh, e);
+      case ExpressionKind::Cosh:
+        return EmitUnary(OpCode::kCosh, e);
+      case ExpressionKind::Tanh:
+        return EmitUnary(OpCode::kTanh, e);
+      case ExpressionKind::Ceil:
+        return EmitUnary(OpCode::kCeil, e);
+      case ExpressionKind::Floor:
+        return EmitUnary(OpCode::kFloor, e);
+      case ExpressionKind::IfThenElse: {
+        const int condition = Compile(get_conditional_formula(e));
+        const int then_value = Compile(get_then_expression(e));
+        const int else_value = Compile(get_else_expression(e));
+        return Emit(OpCode::kSelect, condition, then_value, else_value);
+      }
+      case ExpressionKind::UninterpretedFunction:
+        throw runtime_error(fmt::format(
+            "CompiledExpression: uninterpreted function {} cannot be "
+            "evaluated.",
+            e.to_string()));
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+  int EmitRelational(OpCode op, const Formula& f) {
+    const int a = Compile(get_lhs_expression(f));
+    const int b = Compile(get_rhs_expression(f));
+    return Emit(op, a, b);
+  }
+
+  int EmitNary(OpCode op, const Formula& f) {
+    const std::set<Formula>& operands = get_operands(f);
+    DRAKE_ASSERT(!operands.empty());
+    auto iter = operands.begin();
+    int result = Compile(*iter);
+    for (++iter; iter != operands.end(); ++iter) {
+      result = Emit(op, result, Compile(*iter));
+    }
+    return result;
+  }
+
+  int DoCompile(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::False:
+        return Constant(0.0);
+      case FormulaKind::True:
+        return Constant(1.0);
+      case FormulaKind::Eq:
+        return EmitRelational(OpCode::kEq, f);
+      case FormulaKind::Neq:
+        return EmitRelational(OpCode::kNeq, f);
+      case FormulaKind::Gt:
+        return EmitRelational(OpCode::kGt, f);
+      case FormulaKind::Geq:
+        return EmitRelational(OpCode::kGeq, f);
+      case FormulaKind::Lt:
+        return EmitRelational(OpCode::kLt, f);
+      case FormulaKind::Leq:
+        return EmitRelational(OpCode::kLeq, f);
+      case FormulaKind::And:
+        return EmitNary(OpCode::kAnd, f);
+      case FormulaKind::Or:
+        return EmitNary(OpCode::kOr, f);
+      case FormulaKind::Not:
+        return Emit(OpCode::kNot, Compile(get_operand(f)));
+      case FormulaKind::Var:
+      case FormulaKind::Forall:
+      case FormulaKind::Isnan:
+      case FormulaKind::PositiveSemidefinite:
+        break;
+    }
+    for (const Variable& var : f.GetFreeVariables()) {
+      if (variable_ids_.count(var.get_id()) == 0) {
+        throw runtime_error(fmt::format(
+            "CompiledExpression: {} includes variable {}, which is not in "
+            "the list of variables.",
+            f.to_string(), var.to_string()));
+      }
+    }
+    program_.formulas_.push_back(f);
+    return Emit(OpCode::kFormula,
+                static_cast<int>(program_.formulas_.size()) - 1);
+  }
+
+  CompiledExpression& program_;
+  unordered_map<Variable::Id, int> variable_ids_;
+  unordered_map<double, int> constant_ids_;
+  unordered_map<Expression, int> expression_ids_;
+  unordered_map<Formula, int> formula_ids_;
+};
+
+CompiledExpression::CompiledExpression() = default;
+
+CompiledExpression::CompiledExpression(
+    const Eigen::Ref<const MatrixX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& variables)
+    : rows_(expressions.rows()),
+      cols_(expressions.cols()),
+      expressions_(expressions),
+      variables_(variables) {
+  Compiler compiler(this);
+  vector<int> output_ids;
+  output_ids.reserve(expressions.size());
+  for (int j = 0; j < cols_; ++j) {
+    for (int i = 0; i < rows_; ++i) {
+      output_ids.push_back(compiler.Compile(expressions(i, j)));
+    }
+  }
+  compiler.Assign(output_ids);
+  scratch_.registers.resize(num_registers_);
+}
+
+int CompiledExpression::num_operands(OpCode op) {
+  switch (op) {
+    case OpCode::kFormula:
+      return 0;
+    case OpCode::kScale:
+    case OpCode::kAddConstant:
+    case OpCode::kPowConstant:
+    case OpCode::kLog:
+    case OpCode::kAbs:
+    case OpCode::kExp:
+    case OpCode::kSqrt:
+    case OpCode::kSin:
+    case OpCode::kCos:
+    case OpCode::kTan:
+    case OpCode::kAsin:
+    case OpCode::kAcos:
+    case OpCode::kAtan:
+    case OpCode::kSinh:
+    case OpCode::kCosh:
+    case OpCode::kTanh:
+    case OpCode::kCeil:
+    case OpCode::kFloor:
+    case OpCode::kNot:
+      return 1;
+    case OpCode::kSelect:
+      return 3;
+    default:
+      return 2;
+  }
+}
+
+bool CompiledExpression::Execute(const Instruction& instruction,
+                                 double* r) const {
+  if (instruction.op == OpCode::kFormula) {
+    // The formula may sit in a branch that is not taken; let the caller
+    // decide whether its error matters.
+    try {
+      r[instruction.out] = EvaluateFormula(instruction.a, r);
+    } catch (const std::exception&) {
+      r[instruction.out] = 0.0;
+      return false;
+    }
+    return true;
+  }
+  const double a = instruction.a >= 0 ? r[instruction.a] : 0.0;
+  const double b = instruction.b >= 0 ? r[instruction.b] : 0.0;
+  const double k = instruction.k;
+  double& out = r[instruction.out];
+  switch (instruction.op) {
+    case OpCode::kAdd: out = a + b; return true;
+    case OpCode::kMul: out = a * b; return true;
+    case OpCode::kDiv: out = a / b; return b != 0.0;
+    case OpCode::kAxpy: out = a + b * k; return true;
+    case OpCode::kScale: out = k * a; return true;
+    case OpCode::kAddConstant: out = k + a; return true;
+    case OpCode::kPow: out = std::pow(a, b); return IsInPowDomain(a, b);
+    case OpCode::kPowConstant:
+      out = std::pow(a, k);
+      return IsInPowDomain(a, k);
+    case OpCode::kAtan2: out = std::atan2(a, b); return true;
+    case OpCode::kMin: out = std::min(a, b); return true;
+    case OpCode::kMax: out = std::max(a, b); return true;
+    case OpCode::kLog: out = std::log(a); return IsInLogDomain(a);
+    case OpCode::kAbs: out = std::fabs(a); return true;
+    case OpCode::kExp: out = std::exp(a); return true;
+    case OpCode::kSqrt: out = std::sqrt(a); return IsInLogDomain(a);
+    case OpCode::kSin: out = std::sin(a); return true;
+    case OpCode::kCos: out = std::cos(a); return true;
+    case OpCode::kTan: out = std::tan(a); return true;
+    case OpCode::kAsin: out = std::asin(a); return IsInAsinDomain(a);
+    case OpCode::kAcos: out = std::acos(a); return IsInAsinDomain(a);
+    case OpCode::kAtan: out = std::atan(a); return true;
+    case OpCode::kSinh: out = std::sinh(a); return true;
+    case OpCode::kCosh: out = std::cosh(a); return true;
+    case OpCode::kTanh: out = std::tanh(a); return true;
+    case OpCode::kCeil: out = std::ceil(a); return true;
+    case OpCode::kFloor: out = std::floor(a); return true;
+    case OpCode::kEq: out = (a == b); return true;
+    case OpCode::kNeq: out = (a != b); return true;
+    case OpCode::kGt: out = (a > b); return true;
+    case OpCode::kGeq: out = (a >= b); return true;
+    case OpCode::kLt: out = (a < b); return true;
+    case OpCode::kLeq: out = (a <= b); return true;
+    case OpCode::kAnd: out = (a != 0.0 && b != 0.0); return true;
+    case OpCode::kOr: out = (a != 0.0 || b != 0.0); return true;
+    case OpCode::kNot: out = (a == 0.0); return true;
+    case OpCode::kSelect: out = a != 0.0 ? b : r[instruction.c]; return true;
+    case OpCode::kFormula: break;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+bool CompiledExpression::ExecuteBatch(const Instruction& instruction,
+                                      Eigen::Ref<Eigen::MatrixXd> R) const {
+  if (instruction.op == OpCode::kFormula) {
+    const int n = num_variables();
+    Eigen::VectorXd x(n);
+    bool in_domain = true;
+    for (int j = 0; j < R.rows(); ++j) {
+      x = R.row(j).head(n).transpose();
+      try {
+        R(j, instruction.out) = EvaluateFormula(instruction.a, x.data());
+      } catch (const std::exception&) {
+        R(j, instruction.out) = 0.0;
+        in_domain = false;
+      }
+    }
+    return in_domain;
+  }
+  const auto a = R.col(std::max(instruction.a, 0)).array();
+  const auto b = R.col(std::max(instruction.b, 0)).array();
+  const double k = instruction.k;
+  auto out = R.col(instruction.out).array();
+  auto binary = [&](auto functor) { out = a.binaryExpr(b, functor); };
+  auto indicator = [&](const auto& condition) {
+    out = condition.template cast<double>();
+  };
+  // Check the operands before writing `out`, which may alias them.
+  bool in_domain = true;
+  switch (instruction.op) {
+    case OpCode::kDiv:
+      in_domain = (b != 0.0).all();
+      break;
+    case OpCode::kPow:
+      in_domain = a.binaryExpr(b, [](double x, double y) {
+                     return IsInPowDomain(x, y);
+                   }).all();
+      break;
+    case OpCode::kPowConstant:
+      in_domain =
+          a.unaryExpr([k](double x) { return IsInPowDomain(x, k); }).all();
+      break;
+    case OpCode::kLog:
+    case OpCode::kSqrt:
+      in_domain = (a >= 0.0).all();
+      break;
+    case OpCode::kAsin:
+    case OpCode::kAcos:
+      in_domain = ((a >= -1.0) && (a <= 1.0)).all();
+      break;
+    default:
+      break;
+  }
+  switch (instruction.op) {
+    case OpCode::kAdd: out = a + b; break;
+    case OpCode::kMul: out = a * b; break;
+    case OpCode::kDiv: out = a / b; break;
+    case OpCode::kAxpy: out = a + b * k; break;
+    case OpCode::kScale: out = k * a; break;
+    case OpCode::kAddConstant: out = k + a; break;
+    case OpCode::kPow:
+      binary([](double x, double y) { return std::pow(x, y); });
+      break;
+    case OpCode::kPowConstant:
+      out = a.unaryExpr([k](double x) { return std::pow(x, k); });
+      break;
+    case OpCode::kAtan2:
+      binary([](double x, double y) { return std::atan2(x, y); });
+      break;
+    case OpCode::kMin:
+      binary([](double x, double y) { return std::min(x, y); });
+      break;
+    case OpCode::kMax:
+      binary([](double x, double y) { return std::max(x, y); });
+      break;
+    case OpCode::kLog: out = a.log(); break;
+    case OpCode::kAbs: out = a.abs(); break;
+    case OpCode::kExp: out = a.exp(); break;
+    case OpCode::kSqrt: out = a.sqrt(); break;
+    case OpCode::kSin: out = a.sin(); break;
+    case OpCode::kCos: out = a.cos(); break;
+    case OpCode::kTan: out = a.tan(); break;
+    case OpCode::kAsin: out = a.asin(); break;
+    case OpCode::kAcos: out = a.acos(); break;
+    case OpCode::kAtan: out = a.atan(); break;
+    case OpCode::kSinh: out = a.sinh(); break;
+    case OpCode::kCosh: out = a.cosh(); break;
+    case OpCode::kTanh: out = a.tanh(); break;
+    case OpCode::kCeil: out = a.ceil(); break;
+    case OpCode::kFloor: out = a.floor(); break;
+    case OpCode::kEq: indicator(a == b); break;
+    case OpCode::kNeq: indicator(a != b); break;
+    case OpCode::kGt: indicator(a > b); break;
+    case OpCode::kGeq: indicator(a >= b); break;
+    case OpCode::kLt: indicator(a < b); break;
+    case OpCode::kLeq: indicator(a <= b); break;
+    case OpCode::kAnd: indicator(a != 0.0 && b != 0.0); break;
+    case OpCode::kOr: indicator(a != 0.0 || b != 0.0); break;
+    case OpCode::kNot: indicator(a == 0.0); break;
+    case OpCode::kSelect:
+      out = (a != 0.0).select(b, R.col(instruction.c).array());
+      break;
+    case OpCode::kFormula:
+      DRAKE_UNREACHABLE();
+  }
+  return in_domain;
+}
+
+bool CompiledExpression::EvaluateFormula(int index, const double* x) const {
+  Environment env;
+  for (int i = 0; i < num_variables(); ++i) {
+    env.insert(variables_[i], x[i]);
+  }
+  return formulas_[index].Evaluate(env);
+}
+
+void CompiledExpression::EvalWithEnvironment(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::MatrixXd* y) const {
+  Environment env;
+  for (int i = 0; i < num_variables(); ++i) {
+    env.insert(variables_[i], x[i]);
+  }
+  *y = expressions_.unaryExpr(
+      [&env](const Expression& e) { return e.Evaluate(env); });
+}
+
+void CompiledExpression::Eval(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::MatrixXd* y) const {
+  DRAKE_DEMAND(x.size() == num_variables());
+  DRAKE_DEMAND(y != nullptr);
+  if (contains_nan_) {
+    EvalWithEnvironment(x, y);
+    return;
+  }
+
+  // Use the registers kept in this object, unless another call is already
+  // using them.
+  vector<double> own_registers;
+  vector<double>* registers = &own_registers;
+  if (!scratch_.in_use.exchange(true, std::memory_order_acquire)) {
+    registers = &scratch_.registers;
+  } else {
+    own_registers.resize(num_registers_);
+  }
+  ScopeExit release([this, registers]() {
+    if (registers == &scratch_.registers) {
+      scratch_.in_use.store(false, std::memory_order_release);
+    }
+  });
+  // A default-constructed or copied object starts with no registers.
+  registers->resize(num_registers_);
+
+  double* const r = registers->data();
+  const int n = num_variables();
+  std::copy(x.data(), x.data() + n, r);
+  std::copy(constants_.begin(), constants_.end(), r + n);
+  bool in_domain = true;
+  for (const Instruction& instruction : instructions_) {
+    in_domain &= Execute(instruction, r);
+  }
+  if (!in_domain) {
+    EvalWithEnvironment(x, y);
+    return;
+  }
+  y->resize(rows_, cols_);
+  for (int i = 0; i < static_cast<int>(outputs_.size()); ++i) {
+    (*y)(i) = r[outputs_[i]];
+  }
+}
+
+void CompiledExpression::EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                                   Eigen::MatrixXd* Y) const {
+  DRAKE_DEMAND(X.rows() == num_variables());
+  DRAKE_DEMAND(Y != nullptr);
+  const int n = num_variables();
+  const int num_points = X.cols();
+  Y->resize(outputs_.size(), num_points);
+  // Evaluate the points in blocks, so that the registers of a block stay in
+  // cache.
+  const int kBlockSize = 128;
+  Eigen::MatrixXd R(std::min(kBlockSize, num_points), num_registers_);
+  Eigen::MatrixXd y;
+  for (int start = 0; start < num_points; start += kBlockSize) {
+    const int size = std::min(kBlockSize, num_points - start);
+    auto block = R.topRows(size);
+    block.leftCols(n) = X.middleCols(start, size).transpose();
+    for (int i = 0; i < static_cast<int>(constants_.size()); ++i) {
+      block.col(n + i).setConstant(constants_[i]);
+    }
+    bool in_domain = !contains_nan_;
+    for (const Instruction& instruction : instructions_) {
+      in_domain &= ExecuteBatch(instruction, block);
+    }
+    if (!in_domain) {
+      // Some point in this block needs the checks of Eval().
+      for (int j = start; j < start + size; ++j) {
+        Eval(X.col(j), &y);
+        Y->col(j) = Eigen::Map<const Eigen::VectorXd>(y.data(), y.size());
+      }
+      continue;
+    }
+    for (int i = 0; i < static_cast<int>(outputs_.size()); ++i) {
+      Y->row(i).segment(start, size) = block.col(outputs_[i]).transpose();
+    }
+  }
+}
+
+}  // namespace symbolic
+}  // namespace drake
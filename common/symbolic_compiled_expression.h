@@ -0,0 +1,218 @@
+#pragma once
+
+#ifndef DRAKE_COMMON_SYMBOLIC_HEADER
+#error Do not directly include this file. Include "drake/common/symbolic.h".
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic_expression.h"
+#include "drake/common/symbolic_formula.h"
+#include "drake/common/symbolic_variable.h"
+
+namespace drake {
+namespace symbolic {
+
+/** Evaluates a matrix of symbolic expressions at numerical values of a fixed,
+ordered list of variables, many times over.
+
+Expression::Evaluate() walks the expression tree and looks up each variable in
+an Environment (a map) on every call. This class instead flattens the
+expressions once, at construction, into a straight-line program of
+instructions over a contiguous array of `double` registers. Structurally equal
+subexpressions (within one entry or across entries, e.g. between a function
+and its symbolic::Jacobian) are evaluated only once, and registers are reused
+once their values are no longer needed.
+
+@code
+const Variable x("x");
+const Variable y("y");
+const Vector2<Expression> e(sin(x) * y, sin(x) + y);
+const CompiledExpression f(e, Vector2<Variable>(x, y));
+Eigen::MatrixXd value;
+f.Eval(Eigen::Vector2d(1.0, 2.0), &value);  // value is 2 x 1.
+@endcode
+
+EvalBatch() evaluates the same program at many points, one register per
+instruction being a contiguous array over (a block of) the points, which lets
+the compiler vectorize each instruction.
+
+The compiled program checks the domains of its operations as
+Expression::Evaluate() does (division by zero, the logarithm of a negative
+number, etc.). Since it evaluates both branches of every if_then_else(), a
+point at which any check fails is evaluated again with
+Expression::Evaluate(). That throws the same exception as Evaluate() if the
+failing operation is actually reached, and otherwise returns its result.
+Expressions that contain NaN are always evaluated that way. Formulas (in the
+conditions of if_then_else()) that are relational, conjunctions,
+disjunctions, negations, are compiled; other formulas are evaluated with an
+Environment. */
+class CompiledExpression {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledExpression)
+
+  /** Constructs an evaluator with no variables, whose value is 0 × 0. */
+  CompiledExpression();
+
+  /** Compiles `expressions` as a function of `variables`, whose order is the
+  order of the entries of the argument to Eval().
+  @throws std::exception if an expression includes a variable that is not in
+  `variables`, or an uninterpreted function.
+  @throws std::exception if `variables` has duplicate entries. */
+  CompiledExpression(const Eigen::Ref<const MatrixX<Expression>>& expressions,
+                     const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /** Returns the number of rows of the compiled expression matrix. */
+  int rows() const { return rows_; }
+
+  /** Returns the number of columns of the compiled expression matrix. */
+  int cols() const { return cols_; }
+
+  /** Returns the number of variables, i.e. the size of the argument to
+  Eval(). */
+  int num_variables() const { return variables_.size(); }
+
+  /** Returns the number of instructions in the compiled program. */
+  int num_instructions() const { return instructions_.size(); }
+
+  /** Returns the number of `double` registers used by the compiled program,
+  including one per variable and one per distinct constant. */
+  int num_registers() const { return num_registers_; }
+
+  /** Evaluates the expressions at `x`, whose i-th entry is the value of the
+  i-th variable, into `y`, which is resized to rows() × cols(). This method
+  is safe to call concurrently from several threads. The registers are kept
+  in this object and reused, so that a call does not allocate unless it
+  overlaps with another call on the same object (or `y` needs resizing).
+  @pre x.size() == num_variables().
+  @throws std::exception under the same conditions as
+  Expression::Evaluate(). */
+  void Eval(const Eigen::Ref<const Eigen::VectorXd>& x,
+            Eigen::MatrixXd* y) const;
+
+  /** Evaluates the expressions at each column of `X` (a num_variables() × N
+  matrix), writing into the same column of `Y`, which is resized to
+  (rows() * cols()) × N and holds the values in column-major order. The
+  results match Eval() up to the rounding of vectorized math functions.
+  This method is safe to call concurrently from several threads.
+  @pre X.rows() == num_variables().
+  @throws std::exception under the same conditions as
+  Expression::Evaluate(). */
+  void EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& X,
+                 Eigen::MatrixXd* Y) const;
+
+ private:
+  enum class OpCode : std::uint8_t {
+    // Arithmetic; `k` is an immediate constant.
+    kAdd,          // a + b
+    kMul,          // a * b
+    kDiv,          // a / b
+    kAxpy,         // a + k * b
+    kScale,        // k * a
+    kAddConstant,  // a + k
+    kPow,          // pow(a, b)
+    kPowConstant,  // pow(a, k)
+    kAtan2,        // atan2(a, b)
+    kMin,          // min(a, b)
+    kMax,          // max(a, b)
+    kLog,
+    kAbs,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kSinh,
+    kCosh,
+    kTanh,
+    kCeil,
+    kFloor,
+    // Formulas, whose values are 1.0 (true) or 0.0 (false).
+    kEq,      // a == b
+    kNeq,     // a != b
+    kGt,      // a > b
+    kGeq,     // a >= b
+    kLt,      // a < b
+    kLeq,     // a <= b
+    kAnd,     // a && b
+    kOr,      // a || b
+    kNot,     // !a
+    kSelect,  // a ? b : c
+    kFormula,  // formulas_[a].Evaluate() with an Environment
+  };
+
+  // An instruction writes a function of (up to) three registers to register
+  // `out`.
+  struct Instruction {
+    OpCode op{};
+    int out{-1};
+    int a{-1};
+    int b{-1};
+    int c{-1};
+    double k{};
+  };
+
+  class Compiler;
+
+  // Returns the number of register operands of `op`.
+  static int num_operands(OpCode op);
+
+  // Evaluates instruction `instruction` on the registers in `r`. Returns
+  // false if its operands are outside the domain that Expression::Evaluate()
+  // accepts.
+  bool Execute(const Instruction& instruction, double* r) const;
+
+  // Evaluates instruction `instruction` on registers that are the columns of
+  // `R`, one row per point. Returns false if the operands of any point are
+  // outside the domain that Expression::Evaluate() accepts.
+  bool ExecuteBatch(const Instruction& instruction,
+                    Eigen::Ref<Eigen::MatrixXd> R) const;
+
+  // Evaluates the expressions at `x` with Expression::Evaluate().
+  void EvalWithEnvironment(const Eigen::Ref<const Eigen::VectorXd>& x,
+                           Eigen::MatrixXd* y) const;
+
+  // Evaluates formulas_[index] at the variable values `x`.
+  bool EvaluateFormula(int index, const double* x) const;
+
+  // Scratch registers for Eval(). Copies of a CompiledExpression do not share
+  // them.
+  struct Scratch {
+    Scratch() = default;
+    Scratch(const Scratch&) {}
+    Scratch& operator=(const Scratch&) { return *this; }
+
+    std::vector<double> registers;
+    // Whether a call to Eval() is using `registers`.
+    std::atomic<bool> in_use{false};
+  };
+
+  int rows_{0};
+  int cols_{0};
+  MatrixX<Expression> expressions_;
+  VectorX<Variable> variables_;
+  // Registers [0, num_variables()) hold the variables, and the following
+  // constants_.size() registers hold constants_.
+  std::vector<double> constants_;
+  std::vector<Instruction> instructions_;
+  std::vector<Formula> formulas_;
+  // The registers of the entries of the expression matrix, in column-major
+  // order.
+  std::vector<int> outputs_;
+  int num_registers_{0};
+  // Whether the expressions contain NaN, which Expression::Evaluate() rejects.
+  bool contains_nan_{false};
+  mutable Scratch scratch_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
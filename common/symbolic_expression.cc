@@ -3,11 +3,13 @@
 #include <cmath>
 #include <cstddef>
 #include <ios>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <Eigen/Core>
@@ -57,6 +59,111 @@ Expression NegateMultiplication(const Expression& e) {
 }
 }  // namespace
 
+namespace internal {
+// The table of live expression cells behind ScopedExpressionInterning. Each
+// table belongs to the outermost scope on one thread, and is only used by that
+// thread, so it needs no locking. Cells are keyed on their hash and held
+// weakly, so the table does not keep them alive; entries of cells that have
+// since been destroyed are erased when they are found during a lookup, and by
+// a sweep of the whole table whenever it has doubled in size since the
+// previous sweep.
+class CellInterner {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CellInterner)
+
+  CellInterner() = default;
+
+  // Returns `cell`, or an equal live cell in the table instead.
+  shared_ptr<ExpressionCell> Intern(shared_ptr<ExpressionCell> cell) {
+    const size_t hash = cell->GetHash();
+    auto [iter, end] = table_.equal_range(hash);
+    while (iter != end) {
+      shared_ptr<ExpressionCell> candidate = iter->second.lock();
+      if (candidate == nullptr) {
+        iter = table_.erase(iter);
+        continue;
+      }
+      if (candidate->get_kind() == cell->get_kind() &&
+          candidate->EqualTo(*cell)) {
+        ++num_shared_cells_;
+        return candidate;
+      }
+      ++iter;
+    }
+    table_.emplace(hash, cell);
+    if (table_.size() >= 2 * size_after_sweep_) {
+      for (auto it = table_.begin(); it != table_.end();) {
+        it = it->second.expired() ? table_.erase(it) : std::next(it);
+      }
+      size_after_sweep_ = std::max(table_.size(), kMinSizeAfterSweep);
+    }
+    return cell;
+  }
+
+  int64_t num_shared_cells() const { return num_shared_cells_; }
+
+  int num_interned_cells() const {
+    int result = 0;
+    for (const auto& entry : table_) {
+      if (!entry.second.expired()) ++result;
+    }
+    return result;
+  }
+
+ private:
+  static constexpr size_t kMinSizeAfterSweep = 1024;
+
+  std::unordered_multimap<size_t, std::weak_ptr<ExpressionCell>> table_;
+  size_t size_after_sweep_{kMinSizeAfterSweep};
+  int64_t num_shared_cells_{0};
+};
+}  // namespace internal
+
+namespace {
+using internal::CellInterner;
+
+// Returns the table of the innermost ScopedExpressionInterning alive on this
+// thread, or nullptr if there is none.
+CellInterner*& ActiveCellInterner() {
+  thread_local CellInterner* active{nullptr};
+  return active;
+}
+
+// Returns `cell`, or an equal live cell instead if interning is enabled on
+// this thread.
+shared_ptr<ExpressionCell> InternCell(shared_ptr<ExpressionCell> cell) {
+  CellInterner* const interner = ActiveCellInterner();
+  return interner == nullptr ? cell : interner->Intern(std::move(cell));
+}
+}  // namespace
+
+ScopedExpressionInterning::ScopedExpressionInterning() {
+  CellInterner*& active = ActiveCellInterner();
+  if (active == nullptr) {
+    owned_interner_ = std::make_unique<CellInterner>();
+    active = owned_interner_.get();
+  }
+  interner_ = active;
+  initial_num_shared_cells_ = interner_->num_shared_cells();
+}
+
+ScopedExpressionInterning::~ScopedExpressionInterning() {
+  CellInterner*& active = ActiveCellInterner();
+  // Scopes must be destroyed on their own thread, innermost first.
+  DRAKE_DEMAND(active == interner_);
+  if (owned_interner_ != nullptr) {
+    active = nullptr;
+  }
+}
+
+int64_t ScopedExpressionInterning::num_shared_cells() const {
+  return interner_->num_shared_cells() - initial_num_shared_cells_;
+}
+
+int ScopedExpressionInterning::num_interned_cells() const {
+  return interner_->num_interned_cells();
+}
+
 shared_ptr<ExpressionCell> Expression::make_cell(const double d) {
   if (d == 0.0) {
     // The objects created by `Expression(0.0)` share the unique
@@ -72,10 +179,10 @@ shared_ptr<ExpressionCell> Expression::make_cell(const double d) {
 }
 
 Expression::Expression(const Variable& var)
-    : ptr_{make_shared<ExpressionVar>(var)} {}
-Expression::Expression(const double d) : ptr_{make_cell(d)} {}
+    : Expression{make_shared<ExpressionVar>(var)} {}
+Expression::Expression(const double d) : Expression{make_cell(d)} {}
 Expression::Expression(std::shared_ptr<ExpressionCell> ptr)
-    : ptr_{std::move(ptr)} {}
+    : ptr_{InternCell(std::move(ptr))} {}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -84,8 +191,9 @@ ExpressionKind Expression::get_kind() const {
 
 void Expression::HashAppend(DelegatingHasher* hasher) const {
   using drake::hash_append;
-  hash_append(*hasher, get_kind());
-  ptr_->HashAppendDetail(hasher);
+  // The cell caches the hash of its kind and details, so that hashing an
+  // expression does not traverse its whole tree every time.
+  hash_append(*hasher, ptr_->GetHash());
 }
 
 Expression Expression::Zero() {
@@ -543,7 +651,7 @@ Expression& operator/=(Expression& lhs, const Expression& rhs) {
     lhs = Expression::One();
     return lhs;
   }
-  lhs.ptr_ = make_shared<ExpressionDiv>(lhs, rhs);
+  lhs = Expression{make_shared<ExpressionDiv>(lhs, rhs)};
   return lhs;
 }
 
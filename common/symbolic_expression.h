@@ -6,6 +6,7 @@
 
 #include <algorithm>  // for cpplint only
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <map>
@@ -777,6 +778,69 @@ Expression operator-(const Variable& var);
 ///                  resulting polynomial approximating `f` around `a`.
 Expression TaylorExpand(const Expression& f, const Environment& a, int order);
 
+namespace internal {
+class CellInterner;  // In symbolic_expression.cc
+}  // namespace internal
+
+/** Enables the interning (also known as hash-consing) of symbolic expressions
+ * built on the calling thread while it is alive.
+ *
+ * By default, each operation that builds an Expression allocates a new
+ * expression cell, even if a structurally equal cell already exists (as is
+ * common when manipulating polynomials, whose expressions share many
+ * coefficients, monomials, and products). While an instance of this class
+ * exists on a thread, every cell newly built on that thread is looked up in a
+ * table of live cells first, and an Expression that is structurally equal to
+ * a live one shares the live one's cell instead. Since the children of an
+ * interned cell are interned too, this shares whole subtrees, and comparing
+ * equal subexpressions (e.g., in Expression::EqualTo() and Expression::Less())
+ * stops at the first shared pointer.
+ *
+ * The table belongs to the outermost instance on the thread, and nested
+ * instances use it too; other threads are unaffected, and are free to enable
+ * interning with tables of their own. Interning costs a hash-table lookup per
+ * new cell, and only pays off when many equal subexpressions are alive at the
+ * same time. It does not change the value or the structure of any expression.
+ * When the outermost instance is destroyed, its table is discarded;
+ * expressions that share cells keep sharing them, and may be used on any
+ * thread.
+ *
+ * Instances must be destroyed on the thread that created them, in the reverse
+ * order of their creation (as happens naturally for local variables).
+ *
+ * @code
+ * {
+ *   const ScopedExpressionInterning interning;
+ *   // Build and manipulate expressions.
+ * }
+ * @endcode
+ */
+class ScopedExpressionInterning {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedExpressionInterning)
+
+  /** Enables interning on the calling thread, until this object is
+   * destroyed. */
+  ScopedExpressionInterning();
+
+  ~ScopedExpressionInterning();
+
+  /** Returns the number of cells which have been built on this thread since
+   * this object was constructed and which were replaced by an equal live cell.
+   */
+  [[nodiscard]] int64_t num_shared_cells() const;
+
+  /** Returns the number of distinct live cells that are interned. */
+  [[nodiscard]] int num_interned_cells() const;
+
+ private:
+  // The table of the outermost instance on this thread, which owns it (in
+  // owned_interner_); nested instances leave owned_interner_ null.
+  std::unique_ptr<internal::CellInterner> owned_interner_;
+  internal::CellInterner* interner_{};
+  int64_t initial_num_shared_cells_{};
+};
+
 }  // namespace symbolic
 }  // namespace drake
 
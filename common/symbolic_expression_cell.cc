@@ -229,6 +229,24 @@ ExpressionCell::ExpressionCell(const ExpressionKind k, const bool is_poly,
                                const bool is_expanded)
     : kind_{k}, is_polynomial_{is_poly}, is_expanded_{is_expanded} {}
 
+size_t ExpressionCell::GetHash() const {
+  // Computing the hash twice (in a race between two threads) is harmless.
+  size_t result = hash_.load(std::memory_order_relaxed);
+  if (result == 0) {
+    using drake::hash_append;
+    DefaultHasher hasher;
+    hash_append(hasher, kind_);
+    DelegatingHasher delegating_hasher(
+        [&hasher](const void* data, const size_t length) {
+          return hasher(data, length);
+        });
+    HashAppendDetail(&delegating_hasher);
+    result = static_cast<size_t>(hasher);
+    hash_.store(result, std::memory_order_relaxed);
+  }
+  return result;
+}
+
 UnaryExpressionCell::UnaryExpressionCell(const ExpressionKind k, Expression e,
                                          const bool is_poly,
                                          const bool is_expanded)
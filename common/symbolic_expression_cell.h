@@ -12,6 +12,7 @@
 #endif
 
 #include <algorithm>  // for cpplint only
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -54,6 +55,11 @@ class ExpressionCell {
    */
   virtual void HashAppendDetail(DelegatingHasher*) const = 0;
 
+  /** Returns the hash of get_kind() and HashAppendDetail(), which is computed
+   * the first time it is requested and cached afterwards.
+   */
+  [[nodiscard]] size_t GetHash() const;
+
   /** Collects variables in expression. */
   [[nodiscard]] virtual Variables GetVariables() const = 0;
 
@@ -108,9 +114,11 @@ class ExpressionCell {
   /** Default constructor. */
   ExpressionCell() = default;
   /** Move-constructs an ExpressionCell from an rvalue. */
-  ExpressionCell(ExpressionCell&& e) = default;
+  ExpressionCell(ExpressionCell&& e)
+      : ExpressionCell{e.kind_, e.is_polynomial_, e.is_expanded_} {}
   /** Copy-constructs an ExpressionCell from an lvalue. */
-  ExpressionCell(const ExpressionCell& e) = default;
+  ExpressionCell(const ExpressionCell& e)
+      : ExpressionCell{e.kind_, e.is_polynomial_, e.is_expanded_} {}
   /** Constructs ExpressionCell of kind @p k with @p is_poly and @p is_expanded.
    */
   ExpressionCell(ExpressionKind k, bool is_poly, bool is_expanded);
@@ -121,6 +129,8 @@ class ExpressionCell {
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
   bool is_expanded_{false};
+  // The cached result of GetHash(), or zero if it has not been computed yet.
+  mutable std::atomic<size_t> hash_{0};
 };
 
 /** Represents the base class for unary expressions.  */
@@ -0,0 +1,75 @@
+#include "drake/common/parallelism.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ParallelismTest, SelectNumberOfThreads) {
+  EXPECT_EQ(SelectNumberOfThreads(kNoConcurrency, 10), 1);
+  EXPECT_EQ(SelectNumberOfThreads(4, 10), 4);
+  EXPECT_EQ(SelectNumberOfThreads(4, 3), 3);
+  EXPECT_EQ(SelectNumberOfThreads(4, 0), 1);
+  const int hardware = SelectNumberOfThreads(kUseHardwareConcurrency, 100000);
+  EXPECT_GE(hardware, 1);
+  EXPECT_LE(hardware,
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+  EXPECT_THROW(SelectNumberOfThreads(0, 10), std::exception);
+  EXPECT_THROW(SelectNumberOfThreads(-2, 10), std::exception);
+}
+
+// Every item is visited exactly once, and thread indices are in range.
+GTEST_TEST(ParallelismTest, ParallelForVisitsEachItemOnce) {
+  const int num_items = 1000;
+  for (const int num_threads : {1, 2, 7}) {
+    std::vector<std::atomic<int>> visits(num_items);
+    std::atomic<bool> bad_thread_index{false};
+    ParallelFor(num_items, num_threads, [&](int thread_index, int item) {
+      if (thread_index < 0 || thread_index >= num_threads) {
+        bad_thread_index.store(true);
+      }
+      ++visits[item];
+    });
+    EXPECT_FALSE(bad_thread_index.load());
+    for (int i = 0; i < num_items; ++i) {
+      EXPECT_EQ(visits[i].load(), 1) << "item " << i;
+    }
+  }
+}
+
+// The serial path runs in order on the calling thread.
+GTEST_TEST(ParallelismTest, SerialIsInOrder) {
+  const std::thread::id caller = std::this_thread::get_id();
+  std::vector<int> order;
+  ParallelFor(5, 1, [&](int thread_index, int item) {
+    EXPECT_EQ(thread_index, 0);
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    order.push_back(item);
+  });
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+GTEST_TEST(ParallelismTest, ExceptionPropagates) {
+  for (const int num_threads : {1, 4}) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        ParallelFor(100, num_threads,
+                    [](int, int item) {
+                      if (item == 17) {
+                        throw std::runtime_error("item 17 failed");
+                      }
+                    }),
+        std::runtime_error, "item 17 failed");
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
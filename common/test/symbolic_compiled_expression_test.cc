@@ -0,0 +1,238 @@
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+class SymbolicCompiledExpressionTest : public ::testing::Test {
+ protected:
+  // Evaluates `expressions` at `x` with Expression::Evaluate().
+  MatrixXd EvaluateWithEnvironment(const MatrixX<Expression>& expressions,
+                                   const VectorXd& x) const {
+    Environment env;
+    for (int i = 0; i < vars_.size(); ++i) {
+      env.insert(vars_[i], x[i]);
+    }
+    return expressions.unaryExpr(
+        [&env](const Expression& e) { return e.Evaluate(env); });
+  }
+
+  // Checks that Eval() and EvalBatch() of the compiled `expressions` match
+  // Expression::Evaluate() at a few points.
+  void CheckEvaluation(const MatrixX<Expression>& expressions) const {
+    const CompiledExpression compiled(expressions, vars_);
+    EXPECT_EQ(compiled.rows(), expressions.rows());
+    EXPECT_EQ(compiled.cols(), expressions.cols());
+    MatrixXd X(3, 4);
+    // clang-format off
+    X << 0.5, -1.2,  2.0, 0.1,
+         1.5,  0.3, -0.7, 0.9,
+         0.2,  0.8,  0.4, 1.6;
+    // clang-format on
+    MatrixXd Y;
+    compiled.EvalBatch(X, &Y);
+    ASSERT_EQ(Y.rows(), expressions.size());
+    ASSERT_EQ(Y.cols(), X.cols());
+    for (int j = 0; j < X.cols(); ++j) {
+      const MatrixXd expected = EvaluateWithEnvironment(expressions, X.col(j));
+      MatrixXd y;
+      compiled.Eval(X.col(j), &y);
+      EXPECT_TRUE(CompareMatrices(y, expected, 1e-14));
+      const MatrixXd y_batch =
+          Eigen::Map<const MatrixXd>(Y.col(j).data(), expressions.rows(),
+                                     expressions.cols());
+      EXPECT_TRUE(CompareMatrices(y_batch, expected, 1e-14));
+    }
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const Vector3<Variable> vars_{x_, y_, z_};
+};
+
+TEST_F(SymbolicCompiledExpressionTest, Arithmetic) {
+  Vector6<Expression> e;
+  // clang-format off
+  e << 2.0 + 3.0 * x_ - y_ * z_,
+       -4.0 * x_ * pow(y_, 2) * pow(z_, 3),
+       x_ / (1.0 + y_ * y_),
+       pow(z_, x_) + pow(z_, 0.5),
+       1.0,
+       y_;
+  // clang-format on
+  CheckEvaluation(e);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Functions) {
+  MatrixX<Expression> e(4, 5);
+  // clang-format off
+  e << log(z_), abs(y_), exp(x_), sqrt(z_), sin(x_),
+       cos(x_), tan(y_), asin(z_ / 2), acos(y_ / 2), atan(x_),
+       atan2(x_, y_), sinh(x_), cosh(y_), tanh(z_), min(x_, y_),
+       max(x_, y_), ceil(x_), floor(y_), x_ * sin(x_ * y_), 0.0;
+  // clang-format on
+  CheckEvaluation(e);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, IfThenElse) {
+  Vector4<Expression> e;
+  // clang-format off
+  e << if_then_else(x_ > y_, x_, y_ * z_),
+       if_then_else(x_ <= 0.5 && y_ != z_, 1.0, 2.0),
+       if_then_else(!(x_ == y_) || z_ >= 1.0, sin(x_), cos(x_)),
+       // Not compiled, but evaluated with an Environment.
+       if_then_else(isnan(x_), 1.0, x_ + y_);
+  // clang-format on
+  CheckEvaluation(e);
+}
+
+// Structurally equal subexpressions are evaluated only once, both within an
+// entry and across entries.
+TEST_F(SymbolicCompiledExpressionTest, CommonSubexpressions) {
+  const Expression s = sin(x_ * y_);
+  const CompiledExpression once(Vector1<Expression>(s), vars_);
+  const CompiledExpression twice(Vector2<Expression>(s, s + s * z_), vars_);
+  // s, and then s * z and s + s * z.
+  EXPECT_EQ(twice.num_instructions(), once.num_instructions() + 2);
+
+  // A function and its Jacobian share most of their instructions.
+  const Vector2<Expression> f(sin(x_ * y_) * z_, cos(x_ * y_) * z_);
+  MatrixX<Expression> f_and_J(2, 4);
+  f_and_J << f, Jacobian(f, vars_);
+  const CompiledExpression compiled_f(f, vars_);
+  const CompiledExpression compiled_J(Jacobian(f, vars_), vars_);
+  const CompiledExpression compiled_f_and_J(f_and_J, vars_);
+  EXPECT_LT(compiled_f_and_J.num_instructions(),
+            compiled_f.num_instructions() + compiled_J.num_instructions());
+  CheckEvaluation(f_and_J);
+}
+
+// Registers of values that are no longer needed are reused.
+TEST_F(SymbolicCompiledExpressionTest, RegisterReuse) {
+  Expression e = x_;
+  for (int i = 0; i < 20; ++i) {
+    e = sin(e) * y_;
+  }
+  const CompiledExpression compiled(Vector1<Expression>(e), vars_);
+  EXPECT_EQ(compiled.num_instructions(), 40);
+  EXPECT_LT(compiled.num_registers(), 10);
+  CheckEvaluation(Vector1<Expression>(e));
+}
+
+// Domain errors throw, as in Expression::Evaluate(), but only if the failing
+// operation is actually reached.
+TEST_F(SymbolicCompiledExpressionTest, DomainChecks) {
+  const Eigen::Vector3d x(1.0, 0.0, -1.0);
+  MatrixXd value;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpression(Vector1<Expression>(x_ / y_), vars_).Eval(x, &value),
+      std::runtime_error, "Division by zero: 1 / 0\\(x / y\\)\n");
+  for (const Expression& e : {log(z_), sqrt(z_), asin(z_ - x_),
+                              acos(z_ - x_), pow(z_, 0.5), pow(z_, x_ / 2)}) {
+    const CompiledExpression compiled(Vector1<Expression>(e), vars_);
+    EXPECT_THROW(compiled.Eval(x, &value), std::domain_error) << e;
+    EXPECT_THROW(compiled.EvalBatch(MatrixXd(x), &value), std::domain_error)
+        << e;
+  }
+  EXPECT_THROW(CompiledExpression(Vector1<Expression>(Expression::NaN()),
+                                  vars_).Eval(x, &value),
+               std::runtime_error);
+
+  // The compiled program evaluates both branches, but the error in the branch
+  // that is not taken does not count.
+  const Vector2<Expression> guarded(if_then_else(z_ > 0, log(z_), x_),
+                                    if_then_else(y_ != 0, x_ / y_, z_));
+  CheckEvaluation(guarded);
+  const CompiledExpression compiled(guarded, vars_);
+  compiled.Eval(x, &value);
+  EXPECT_EQ(value(0), 1.0);
+  EXPECT_EQ(value(1), -1.0);
+  MatrixXd X(3, 2);
+  X << x, Eigen::Vector3d(1.0, 2.0, 3.0);
+  compiled.EvalBatch(X, &value);
+  EXPECT_EQ(value(0, 0), 1.0);
+  EXPECT_EQ(value(1, 0), -1.0);
+  EXPECT_EQ(value(0, 1), std::log(3.0));
+  EXPECT_EQ(value(1, 1), 0.5);
+}
+
+// Once `y` has the right size, Eval() reuses its registers.
+TEST_F(SymbolicCompiledExpressionTest, EvalDoesNotAllocate) {
+  const CompiledExpression compiled(
+      Vector2<Expression>(sin(x_) * y_ + z_, x_ / y_), vars_);
+  const Eigen::Vector3d x(0.5, 1.5, 0.2);
+  MatrixXd value;
+  compiled.Eval(x, &value);
+  {
+    test::LimitMalloc guard;
+    compiled.Eval(x, &value);
+  }
+  EXPECT_EQ(value(1), 0.5 / 1.5);
+}
+
+// Copies evaluate independently, and calls may overlap.
+TEST_F(SymbolicCompiledExpressionTest, CopiesAndConcurrentCalls) {
+  const Vector1<Expression> e(sin(x_) * y_ + z_);
+  const CompiledExpression compiled(e, vars_);
+  const CompiledExpression copy = compiled;
+  const Eigen::Vector3d x(0.5, 1.5, 0.2);
+  MatrixXd expected;
+  compiled.Eval(x, &expected);
+  std::vector<std::thread> threads;
+  std::atomic<int> num_mismatches{0};
+  for (const CompiledExpression* program : {&compiled, &compiled, &copy}) {
+    threads.emplace_back([program, &x, &expected, &num_mismatches]() {
+      MatrixXd value;
+      for (int i = 0; i < 1000; ++i) {
+        program->Eval(x, &value);
+        if (value != expected) ++num_mismatches;
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(num_mismatches, 0);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Empty) {
+  const CompiledExpression compiled;
+  EXPECT_EQ(compiled.rows(), 0);
+  EXPECT_EQ(compiled.cols(), 0);
+  EXPECT_EQ(compiled.num_variables(), 0);
+  MatrixXd value;
+  compiled.Eval(VectorXd(0), &value);
+  EXPECT_EQ(value.size(), 0);
+}
+
+TEST_F(SymbolicCompiledExpressionTest, Errors) {
+  const Variable w("w");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpression(Vector1<Expression>(x_ + w), vars_),
+      std::runtime_error, ".*variable w, which is not in the list.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpression(Vector1<Expression>(x_), Vector2<Variable>(x_, x_)),
+      std::runtime_error, ".*variable x appears more than once.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledExpression(
+          Vector1<Expression>(uninterpreted_function("f", {x_})), vars_),
+      std::runtime_error, ".*uninterpreted function.*");
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -8,6 +8,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -2598,6 +2599,82 @@ TEST_F(SymbolicExpressionTest, EvaluateExpressionsIncludingRandomVariables) {
   }
 }
 
+TEST_F(SymbolicExpressionTest, Interning) {
+  // Without interning, equal expressions that are built separately do not
+  // share their cells.
+  const Expression e1 = sin(x_ * y_ + 2.0);
+  const Expression e2 = sin(x_ * y_ + 2.0);
+  EXPECT_NE(&get_argument(e1), &get_argument(e2));
+
+  {
+    const ScopedExpressionInterning interning;
+    const Expression e3 = sin(x_ * y_ + 2.0);
+    const Expression e4 = sin(x_ * y_ + 2.0);
+    EXPECT_EQ(&get_argument(e3), &get_argument(e4));
+    EXPECT_GT(interning.num_shared_cells(), 0);
+    EXPECT_GT(interning.num_interned_cells(), 0);
+
+    // Interning changes neither equality nor hashing.
+    EXPECT_PRED2(ExprEqual, e1, e3);
+    EXPECT_EQ(get_std_hash(e1), get_std_hash(e3));
+    EXPECT_PRED2(ExprNotEqual, e3, cos(x_ * y_ + 2.0));
+
+    // Scopes nest.
+    {
+      const ScopedExpressionInterning inner;
+      const Expression e5 = sin(x_ * y_ + 2.0);
+      EXPECT_EQ(&get_argument(e3), &get_argument(e5));
+    }
+    const Expression e6 = sin(x_ * y_ + 2.0);
+    EXPECT_EQ(&get_argument(e3), &get_argument(e6));
+  }
+
+  // Destroying the last scope disables interning and clears the table.
+  const Expression e7 = sin(x_ * y_ + 2.0);
+  const Expression e8 = sin(x_ * y_ + 2.0);
+  EXPECT_NE(&get_argument(e7), &get_argument(e8));
+  const ScopedExpressionInterning interning;
+  EXPECT_EQ(interning.num_interned_cells(), 0);
+  EXPECT_EQ(interning.num_shared_cells(), 0);
+}
+
+// Each thread interns with its own table, if any, and cells interned on one
+// thread may be used on another.
+TEST_F(SymbolicExpressionTest, InterningIsPerThread) {
+  const ScopedExpressionInterning interning;
+  const Expression e1 = sin(x_ * y_ + 2.0);
+  const int64_t num_shared_cells = interning.num_shared_cells();
+
+  // Without a scope of its own, another thread does not intern.
+  Expression e2, e3;
+  std::thread([&]() {
+    e2 = sin(x_ * y_ + 2.0);
+    e3 = sin(x_ * y_ + 2.0);
+  }).join();
+  EXPECT_NE(&get_argument(e2), &get_argument(e3));
+  EXPECT_NE(&get_argument(e1), &get_argument(e2));
+
+  // With a scope of its own, it interns with a table separate from ours.
+  Expression e4, e5;
+  int64_t num_other_shared_cells{};
+  std::thread([&]() {
+    const ScopedExpressionInterning other;
+    EXPECT_EQ(other.num_interned_cells(), 0);
+    e4 = sin(x_ * y_ + 2.0);
+    e5 = sin(x_ * y_ + 2.0);
+    num_other_shared_cells = other.num_shared_cells();
+  }).join();
+  EXPECT_EQ(&get_argument(e4), &get_argument(e5));
+  EXPECT_NE(&get_argument(e1), &get_argument(e4));
+  EXPECT_GT(num_other_shared_cells, 0);
+  EXPECT_EQ(interning.num_shared_cells(), num_shared_cells);
+  EXPECT_PRED2(ExprEqual, e1, e4);
+
+  // Our table is still in use.
+  const Expression e6 = sin(x_ * y_ + 2.0);
+  EXPECT_EQ(&get_argument(e1), &get_argument(e6));
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -40,6 +40,38 @@ MatrixX<T> BsplineTrajectory<T>::value(const T& time) const {
                                min(max(time, start_time()), end_time()));
 }
 
+template <typename T>
+void BsplineTrajectory<T>::DoVectorValues(const std::vector<T>& t,
+                                          MatrixX<T>* values) const {
+  using std::max;
+  using std::min;
+  std::vector<T> clamped_t(t.size());
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    clamped_t[i] = min(max(t[i], start_time()), end_time());
+  }
+  std::vector<int> first_active_indices;
+  MatrixX<T> basis_values;
+  basis_.EvaluateActiveBasisFunctions(clamped_t, &first_active_indices,
+                                      &basis_values);
+  const bool column_per_time = cols() == 1;
+  VectorX<T> value(rows() * cols());
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    value.setZero();
+    for (int r = 0; r < basis_.order(); ++r) {
+      const MatrixX<T>& control_point =
+          control_points_[first_active_indices[i] + r];
+      value += basis_values(r, i) *
+               Eigen::Map<const VectorX<T>>(control_point.data(),
+                                            control_point.size());
+    }
+    if (column_per_time) {
+      values->col(i) = value;
+    } else {
+      values->row(i) = value.transpose();
+    }
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> BsplineTrajectory<T>::DoMakeDerivative(
     int derivative_order) const {
@@ -135,6 +135,11 @@ class BsplineTrajectory final : public trajectories::Trajectory<T> {
   std::unique_ptr<trajectories::Trajectory<T>> DoMakeDerivative(
       int derivative_order) const override;
 
+  // Evaluates the basis at all of the times together, and then each value as
+  // a weighted sum of the control points.
+  void DoVectorValues(const std::vector<T>& t,
+                      MatrixX<T>* values) const override;
+
   bool CheckInvariants() const;
 
   math::BsplineBasis<T> basis_;
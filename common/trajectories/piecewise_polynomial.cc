@@ -71,6 +71,8 @@ PiecewisePolynomial<T>::derivative(int derivative_order) const {
       }
     }
   }
+  // The derivatives of a compiled trajectory are compiled too.
+  if (is_compiled()) ret.Compile();
   return ret;
 }
 
@@ -86,6 +88,7 @@ template <typename T>
 PiecewisePolynomial<T> PiecewisePolynomial<T>::integral(
     const Eigen::Ref<MatrixX<T>>& value_at_start_time) const {
   PiecewisePolynomial ret = *this;
+  ret.DiscardCompiledCoefficients();
   for (int segment_index = 0; segment_index < this->get_number_of_segments();
        segment_index++) {
     PolynomialMatrix& matrix = ret.polynomials_[segment_index];
@@ -118,6 +121,17 @@ MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
     const T& t, int derivative_order) const {
   const int segment_index = this->get_segment_index(t);
   const T time = min(max(t, this->start_time()), this->end_time());
+  if (is_compiled()) {
+    MatrixX<T> ret(rows() * cols(), 1);
+    auto flattened = ret.col(0);
+    EvaluateCompiledSegment(segment_index,
+                            time - this->breaks()[segment_index],
+                            derivative_order, &flattened);
+    // As in Reshape(), the data is preserved when the total number of
+    // elements does not change.
+    ret.resize(rows(), cols());
+    return ret;
+  }
   Eigen::Matrix<T, PolynomialMatrix::RowsAtCompileTime,
                 PolynomialMatrix::ColsAtCompileTime>
       ret(rows(), cols());
@@ -159,6 +173,7 @@ operator+=(const PiecewisePolynomial<T>& other) {
         "Addition not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += other.polynomials_[i];
+  DiscardCompiledCoefficients();
   return *this;
 }
 
@@ -170,6 +185,7 @@ operator-=(const PiecewisePolynomial<T>& other) {
         "Subtraction not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= other.polynomials_[i];
+  DiscardCompiledCoefficients();
   return *this;
 }
 
@@ -182,6 +198,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator*=(
   for (size_t i = 0; i < polynomials_.size(); i++) {
     polynomials_[i] *= other.polynomials_[i];
   }
+  DiscardCompiledCoefficients();
   return *this;
 }
 
@@ -190,6 +207,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator+=(
     const MatrixX<T>& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += offset.template cast<Polynomial<T>>();
+  DiscardCompiledCoefficients();
   return *this;
 }
 
@@ -198,6 +216,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator-=(
     const MatrixX<T>& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= offset.template cast<Polynomial<T>>();
+  DiscardCompiledCoefficients();
   return *this;
 }
 
@@ -223,6 +242,7 @@ const PiecewisePolynomial<T> PiecewisePolynomial<T>::operator-() const {
   for (size_t i = 0; i < polynomials_.size(); i++) {
     ret.polynomials_[i] = -polynomials_[i];
   }
+  ret.DiscardCompiledCoefficients();
   return ret;
 }
 
@@ -304,6 +324,7 @@ void PiecewisePolynomial<T>::ConcatenateInTime(
     breaks = other.breaks();
     polynomials_ = other.polynomials_;
   }
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -336,6 +357,7 @@ void PiecewisePolynomial<T>::AppendCubicHermiteSegment(
   }
   polynomials_.push_back(std::move(matrix));
   this->get_mutable_breaks().push_back(time);
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -361,6 +383,7 @@ void PiecewisePolynomial<T>::AppendFirstOrderSegment(
   }
   polynomials_.push_back(std::move(matrix));
   this->get_mutable_breaks().push_back(time);
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -368,6 +391,7 @@ void PiecewisePolynomial<T>::RemoveFinalSegment() {
   DRAKE_DEMAND(!empty());
   polynomials_.pop_back();
   this->get_mutable_breaks().pop_back();
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -404,6 +428,7 @@ void PiecewisePolynomial<T>::ReverseTime() {
   for (auto it = breaks.begin(); it != breaks.end(); ++it) {
     *it *= -1.0;
   }
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -432,6 +457,7 @@ void PiecewisePolynomial<T>::ScaleTime(const T& scale) {
   for (auto it = breaks.begin(); it != breaks.end(); ++it) {
     *it *= scale;
   }
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -450,6 +476,7 @@ void PiecewisePolynomial<T>::setPolynomialMatrixBlock(
   this->segment_number_range_check(segment_number);
   polynomials_[segment_number].block(row_start, col_start, replacement.rows(),
                                      replacement.cols()) = replacement;
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -480,6 +507,96 @@ T PiecewisePolynomial<T>::EvaluateSegmentAbsoluteTime(
       t - this->start_time(segment_index), derivative_order);
 }
 
+template <typename T>
+void PiecewisePolynomial<T>::Compile() {
+  int degree = 0;
+  for (const PolynomialMatrix& matrix : polynomials_) {
+    for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+      degree = max(degree, matrix(i).GetDegree());
+    }
+  }
+  const int num_coefficients = degree + 1;
+  const Eigen::Index num_elements = empty() ? 0 : rows() * cols();
+  const int num_segments = static_cast<int>(polynomials_.size());
+  compiled_coefficients_ =
+      MatrixX<T>::Zero(num_elements, num_segments * num_coefficients);
+  for (int segment_index = 0; segment_index < num_segments; ++segment_index) {
+    const PolynomialMatrix& matrix = polynomials_[segment_index];
+    for (Eigen::Index i = 0; i < num_elements; ++i) {
+      const VectorX<T> coefficients = matrix(i).GetCoefficients();
+      compiled_coefficients_.block(i, segment_index * num_coefficients, 1,
+                                   coefficients.size()) =
+          coefficients.transpose();
+    }
+  }
+  compiled_degree_ = degree;
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::EvaluateCompiledSegment(
+    int segment_index, const T& dt, int derivative_order,
+    EigenPtr<VectorX<T>> value) const {
+  DRAKE_ASSERT(is_compiled());
+  DRAKE_DEMAND(derivative_order >= 0);
+  DRAKE_ASSERT(value->size() == rows() * cols());
+  if (derivative_order > compiled_degree_) {
+    value->setZero();
+    return;
+  }
+  const int num_coefficients = compiled_degree_ + 1;
+  const auto coefficients = compiled_coefficients_.middleCols(
+      segment_index * num_coefficients, num_coefficients);
+  // Differentiating scales the coefficient of t^k by k! / (k - n)!, where n is
+  // the derivative order.
+  auto scale = [derivative_order](int k) {
+    double result = 1.0;
+    for (int i = 0; i < derivative_order; ++i) result *= k - i;
+    return result;
+  };
+  // Horner's method, applied to all of the elements at once.
+  auto& result = *value;
+  result = coefficients.col(compiled_degree_) * scale(compiled_degree_);
+  for (int k = compiled_degree_ - 1; k >= derivative_order; --k) {
+    if (derivative_order == 0) {
+      result = result * dt + coefficients.col(k);
+    } else {
+      result = result * dt + coefficients.col(k) * scale(k);
+    }
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::DoVectorValues(const std::vector<T>& t,
+                                            MatrixX<T>* values) const {
+  const bool column_per_time = cols() == 1;
+  const Eigen::Index num_elements = rows() * cols();
+  VectorX<T> value(num_elements);
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    const int segment_index = this->get_segment_index(t[i]);
+    const T time = min(max(t[i], this->start_time()), this->end_time());
+    const T dt = time - this->breaks()[segment_index];
+    if (is_compiled()) {
+      EvaluateCompiledSegment(segment_index, dt, 0, &value);
+    } else {
+      const PolynomialMatrix& matrix = polynomials_[segment_index];
+      for (Eigen::Index j = 0; j < num_elements; ++j) {
+        value(j) = matrix(j).EvaluateUnivariate(dt);
+      }
+    }
+    if (column_per_time) {
+      values->col(i) = value;
+    } else {
+      values->row(i) = value.transpose();
+    }
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::DiscardCompiledCoefficients() {
+  compiled_coefficients_.resize(0, 0);
+  compiled_degree_ = -1;
+}
+
 template <typename T>
 Eigen::Index PiecewisePolynomial<T>::rows() const {
   if (polynomials_.size() > 0) {
@@ -508,6 +625,7 @@ void PiecewisePolynomial<T>::Reshape(int rows, int cols) {
     // number of elements does not change.
     p.resize(rows, cols);
   }
+  DiscardCompiledCoefficients();
 }
 
 template <typename T>
@@ -521,6 +521,28 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
       return DoEvalDerivative(t, derivative_order);
   }
 
+  /**
+   * Switches value() and EvalDerivative() to the compiled evaluation mode,
+   * which copies the coefficients of all of the polynomials into one
+   * contiguous, segment-major array (padded with zeros to the highest degree
+   * of any polynomial) and evaluates every element of a segment at once with
+   * Horner's method. This is much faster than evaluating each Polynomial in
+   * turn, so it is worth calling once a trajectory that will be evaluated
+   * many times (e.g., played back in a simulation) is complete.
+   *
+   * Every method that modifies the polynomials (e.g., operator+=(),
+   * ConcatenateInTime(), or ScaleTime()) discards the compiled coefficients,
+   * and evaluation then falls back to the polynomials until Compile() is
+   * called again. Copies of a compiled trajectory are compiled.
+   */
+  void Compile();
+
+  /**
+   * Returns `true` iff value() and EvalDerivative() use the compiled
+   * coefficients. See Compile().
+   */
+  bool is_compiled() const { return compiled_degree_ >= 0; }
+
   /**
    * Gets the matrix of Polynomials corresponding to the given segment index.
    * @warning `segment_index` is not checked for validity.
@@ -784,9 +806,34 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
                                 Eigen::Index col,
                                 int derivative_order = 0) const;
 
+  // Evaluates the polynomials at each time without allocating a matrix for
+  // each of them, from the compiled coefficients when is_compiled().
+  void DoVectorValues(const std::vector<T>& t,
+                      MatrixX<T>* values) const override;
+
+  // Evaluates the derivative of segment `segment_index` at `dt` past its start
+  // time from the compiled coefficients, and writes it to `value` flattened
+  // in column-major order.
+  // @pre is_compiled() is true.
+  void EvaluateCompiledSegment(int segment_index, const T& dt,
+                               int derivative_order,
+                               EigenPtr<VectorX<T>> value) const;
+
+  // Discards the compiled coefficients; called by every method that modifies
+  // polynomials_.
+  void DiscardCompiledCoefficients();
+
   // a PolynomialMatrix for each piece (segment).
   std::vector<PolynomialMatrix> polynomials_;
 
+  // The coefficients of polynomials_ when compiled (see Compile()), padded
+  // with zeros to compiled_degree_, which is -1 when not compiled. Segment `i`
+  // owns the compiled_degree_ + 1 columns starting at column
+  // `i * (compiled_degree_ + 1)`; the k'th of those holds the coefficients of
+  // `t^k` of all of the segment's elements, in column-major order.
+  MatrixX<T> compiled_coefficients_;
+  int compiled_degree_{-1};
+
   // Computes coeffecients for a cubic spline given the value and first
   // derivatives at the end points.
   // Throws `std::runtime_error` if `dt < PiecewiseTrajectory::kEpsilonTime`.
@@ -200,6 +200,15 @@ MatrixX<T> PiecewiseQuaternionSlerp<T>::DoEvalDerivative(
   return Vector3<T>::Zero();
 }
 
+template <typename T>
+void PiecewiseQuaternionSlerp<T>::DoVectorValues(const std::vector<T>& t,
+                                                 MatrixX<T>* values) const {
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    const Quaternion<T> q = orientation(t[i]);
+    values->col(i) << q.w(), q.x(), q.y(), q.z();
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> PiecewiseQuaternionSlerp<T>::DoMakeDerivative(
       int derivative_order) const {
@@ -90,6 +90,11 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
    */
   Quaternion<T> orientation(double t) const;
 
+  /**
+   * Returns the rotation matrix of orientation(t).
+   * @note vector_values() instead returns the coefficients [w, x, y, z] of
+   * orientation(t) for each time, in agreement with rows() and cols().
+   */
   MatrixX<T> value(const T& t) const override {
     return orientation(t).matrix();
   }
@@ -160,6 +165,11 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
 
   MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const override;
 
+  // Writes the coefficients [w, x, y, z] of orientation(t[i]) to column i of
+  // values.
+  void DoVectorValues(const std::vector<T>& t,
+                      MatrixX<T>* values) const override;
+
   std::unique_ptr<Trajectory<T>> DoMakeDerivative(
       int derivative_order) const override;
 
@@ -58,24 +58,11 @@ T PiecewiseTrajectory<T>::end_time() const {
 }
 
 template <typename T>
-int PiecewiseTrajectory<T>::GetSegmentIndexRecursive(const T& time, int start,
-                                                     int end) const {
-  DRAKE_DEMAND(end >= start);
-  DRAKE_DEMAND(end < static_cast<int>(breaks_.size()));
-  DRAKE_DEMAND(start >= 0);
-  DRAKE_DEMAND(time <= breaks_[end] && time >= breaks_[start]);
-
-  int mid = (start + end) / 2;
-
-  // one or two numbers
-  if (end - start <= 1) return start;
-
-  if (time < breaks_[mid])
-    return GetSegmentIndexRecursive(time, start, mid);
-  else if (time > breaks_[mid])
-    return GetSegmentIndexRecursive(time, mid, end);
-  else
-    return mid;
+bool PiecewiseTrajectory<T>::SegmentContains(int segment_index,
+                                             const T& time) const {
+  if (time < breaks_[segment_index]) return false;
+  if (segment_index == get_number_of_segments() - 1) return true;
+  return static_cast<bool>(time < breaks_[segment_index + 1]);
 }
 
 template <typename T>
@@ -84,9 +71,32 @@ int PiecewiseTrajectory<T>::get_segment_index(const T& t) const {
   // clip to min/max times
   using std::min;
   using std::max;
-  T time = min(max(t, start_time()), end_time());
-  return GetSegmentIndexRecursive(time, 0,
-                                  static_cast<int>(breaks_.size() - 1));
+  const T time = min(max(t, start_time()), end_time());
+
+  // Try the segment of the previous query, then the one after it. The breaks
+  // may have changed since the hint was stored, so it is range checked.
+  const int num_segments = get_number_of_segments();
+  const int hint = segment_index_hint_.get();
+  for (int segment_index = hint;
+       segment_index < std::min(hint + 2, num_segments); ++segment_index) {
+    if (SegmentContains(segment_index, time)) {
+      if (segment_index != hint) segment_index_hint_.set(segment_index);
+      return segment_index;
+    }
+  }
+
+  // Otherwise, the segment starts at the last break that is not after time.
+  const auto after =
+      std::upper_bound(breaks_.begin(), breaks_.end(), time,
+                       [](const T& a, const T& b) {
+                         return static_cast<bool>(a < b);
+                       });
+  const int segment_index =
+      std::min(static_cast<int>(after - breaks_.begin()) - 1,
+               num_segments - 1);
+  DRAKE_DEMAND(segment_index >= 0);
+  segment_index_hint_.set(segment_index);
+  return segment_index;
 }
 
 template <typename T>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <random>
@@ -43,6 +44,18 @@ class PiecewiseTrajectory : public Trajectory<T> {
    */
   boolean<T> is_time_in_range(const T& t) const;
 
+  /**
+   * Returns the index of the segment that contains the time `t`, i.e., the
+   * `i` for which `start_time(i) <= t < end_time(i)`, or the final segment
+   * when `t` is end_time(). Times outside of the breaks are clamped to them.
+   *
+   * The search starts from the segment found by the previous call (and the
+   * one after it), so that evaluating the trajectory at monotonically
+   * increasing times -- e.g., during playback in a simulation -- finds the
+   * segment in constant time; other queries fall back to a binary search
+   * over the breaks. The remembered segment is only a hint: the result does
+   * not depend on it, and concurrent calls are safe.
+   */
   int get_segment_index(const T& t) const;
 
   const std::vector<T>& get_segment_times() const;
@@ -68,9 +81,31 @@ class PiecewiseTrajectory : public Trajectory<T> {
   std::vector<T>& get_mutable_breaks() { return breaks_; }
 
  private:
-  int GetSegmentIndexRecursive(const T& time, int start, int end) const;
+  // The segment most recently found by get_segment_index(). It is copyable,
+  // and relaxed atomic accesses suffice because it is only a hint.
+  class SegmentIndexHint {
+   public:
+    SegmentIndexHint() = default;
+    SegmentIndexHint(const SegmentIndexHint& other) : index_(other.get()) {}
+    SegmentIndexHint& operator=(const SegmentIndexHint& other) {
+      set(other.get());
+      return *this;
+    }
+    int get() const { return index_.load(std::memory_order_relaxed); }
+    void set(int index) const {
+      index_.store(index, std::memory_order_relaxed);
+    }
+
+   private:
+    mutable std::atomic<int> index_{0};
+  };
+
+  // Returns true iff `time` (already clamped to the breaks) lies in segment
+  // `segment_index`, with the convention of get_segment_index().
+  bool SegmentContains(int segment_index, const T& time) const;
 
   std::vector<T> breaks_;
+  SegmentIndexHint segment_index_hint_;
 };
 
 }  // namespace trajectories
@@ -130,6 +130,36 @@ TYPED_TEST(BsplineTrajectoryTests, ValueTest) {
   }
 }
 
+// Verifies that vector_values() agrees with value(), for sorted and unsorted
+// times, for trajectories whose values are columns and rows.
+TYPED_TEST(BsplineTrajectoryTests, VectorValuesTest) {
+  using T = TypeParam;
+  const BsplineTrajectory<T> column = MakeCircleTrajectory<T>();
+  const BsplineTrajectory<T> row = column.CopyWithSelector(
+      [](const MatrixX<T>& point) -> MatrixX<T> { return point.transpose(); });
+  std::vector<T> times;
+  for (int k = 0; k <= 30; ++k) times.push_back(-0.1 + 1.2 * k / 30.0);
+  times.push_back(0.5);
+  times.push_back(column.end_time());
+  times.push_back(0.125);
+
+  MatrixX<T> values;
+  column.vector_values(times, &values);
+  ASSERT_EQ(values.rows(), 2);
+  ASSERT_EQ(values.cols(), static_cast<int>(times.size()));
+  for (int k = 0; k < static_cast<int>(times.size()); ++k) {
+    EXPECT_TRUE(CompareMatrices(values.col(k), column.value(times[k]),
+                                10 * std::numeric_limits<double>::epsilon()));
+  }
+  row.vector_values(times, &values);
+  ASSERT_EQ(values.rows(), static_cast<int>(times.size()));
+  ASSERT_EQ(values.cols(), 2);
+  for (int k = 0; k < static_cast<int>(times.size()); ++k) {
+    EXPECT_TRUE(CompareMatrices(values.row(k), row.value(times[k]),
+                                10 * std::numeric_limits<double>::epsilon()));
+  }
+}
+
 // Verifies that MakeDerivative() works as expected.
 TYPED_TEST(BsplineTrajectoryTests, MakeDerivativeTest) {
   using T = TypeParam;
@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
+#include <algorithm>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -302,6 +303,47 @@ GTEST_TEST(testPiecewisePolynomial, VectorValueTest) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       mat.vector_values(times), std::runtime_error,
       "This method only supports vector-valued trajectories.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      mat.vector_values(times, &out), std::runtime_error,
+      "This method only supports vector-valued trajectories.");
+}
+
+// Batched evaluation into a caller-provided matrix matches value(), for
+// sorted and shuffled times, with and without compiled coefficients.
+GTEST_TEST(testPiecewisePolynomial, VectorValuesIntoMatrixTest) {
+  default_random_engine generator(321);
+  const std::vector<double> breaks =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(5, generator);
+  std::vector<double> times;
+  for (double t = breaks.front() - 0.2; t < breaks.back() + 0.2; t += 0.05) {
+    times.push_back(t);
+  }
+  std::vector<double> shuffled_times = times;
+  std::shuffle(shuffled_times.begin(), shuffled_times.end(), generator);
+
+  for (const Eigen::Index rows : {4, 1}) {
+    PiecewisePolynomial<double> pp =
+        test::MakeRandomPiecewisePolynomial<double>(rows, 5 - rows, 4,
+                                                    breaks);
+    for (const bool compiled : {false, true}) {
+      if (compiled) pp.Compile();
+      for (const auto* sequence : {&times, &shuffled_times}) {
+        // A matrix of the wrong size is resized.
+        Eigen::MatrixXd values(2, 2);
+        pp.vector_values(*sequence, &values);
+        EXPECT_TRUE(CompareMatrices(values, pp.vector_values(*sequence)));
+        ASSERT_EQ(values.size(), 4 * static_cast<int>(sequence->size()));
+        for (int i = 0; i < static_cast<int>(sequence->size()); ++i) {
+          const Eigen::MatrixXd value = pp.value((*sequence)[i]);
+          if (rows == 1) {
+            EXPECT_TRUE(CompareMatrices(values.row(i), value, 1e-12));
+          } else {
+            EXPECT_TRUE(CompareMatrices(values.col(i), value, 1e-12));
+          }
+        }
+      }
+    }
+  }
 }
 
 GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
@@ -444,6 +486,76 @@ GTEST_TEST(testPiecewisePolynomial, IsApproxTest) {
   EXPECT_TRUE(pp1.isApprox(pp2, 0.1, ToleranceType::kRelative));
 }
 
+// The compiled evaluation mode agrees with evaluating the polynomials, for
+// values and derivatives at monotonically increasing and at shuffled times.
+GTEST_TEST(testPiecewisePolynomial, CompiledEvaluationTest) {
+  default_random_engine generator(789);
+  const std::vector<double> breaks =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(6, generator);
+  PiecewisePolynomial<double> pp =
+      test::MakeRandomPiecewisePolynomial<double>(3, 2, 5, breaks);
+  // Lower the degree of a few elements, whose compiled coefficients are then
+  // padded with zeros.
+  PiecewisePolynomial<double>::PolynomialMatrix block(2, 1);
+  block << Polynomial<double>(Eigen::Vector2d(1, 2)), Polynomial<double>(3.0);
+  pp.setPolynomialMatrixBlock(block, 2, 1, 1);
+
+  PiecewisePolynomial<double> compiled = pp;
+  EXPECT_FALSE(compiled.is_compiled());
+  compiled.Compile();
+  EXPECT_TRUE(compiled.is_compiled());
+
+  std::vector<double> times = breaks;
+  for (double t = pp.start_time() - 0.1; t < pp.end_time() + 0.1; t += 0.01) {
+    times.push_back(t);
+  }
+  std::vector<double> shuffled_times = times;
+  std::shuffle(shuffled_times.begin(), shuffled_times.end(), generator);
+  times.insert(times.end(), shuffled_times.begin(), shuffled_times.end());
+
+  const double tol = 1e-12;
+  for (const double t : times) {
+    EXPECT_TRUE(CompareMatrices(compiled.value(t), pp.value(t), tol));
+    for (int order = 1; order <= 5; ++order) {
+      EXPECT_TRUE(CompareMatrices(compiled.EvalDerivative(t, order),
+                                  pp.EvalDerivative(t, order), tol));
+    }
+  }
+
+  // Copies and derivatives of a compiled trajectory are compiled.
+  const std::unique_ptr<Trajectory<double>> clone = compiled.Clone();
+  EXPECT_TRUE(
+      dynamic_cast<PiecewisePolynomial<double>&>(*clone).is_compiled());
+  const PiecewisePolynomial<double> derivative = compiled.derivative(2);
+  EXPECT_TRUE(derivative.is_compiled());
+  EXPECT_FALSE(pp.derivative(2).is_compiled());
+  for (const double t : times) {
+    EXPECT_TRUE(
+        CompareMatrices(derivative.value(t), pp.EvalDerivative(t, 2), tol));
+  }
+
+  // Modifying the polynomials discards the compiled coefficients.
+  compiled.ScaleTime(2.0);
+  EXPECT_FALSE(compiled.is_compiled());
+  compiled.Compile();
+  pp.ScaleTime(2.0);
+  EXPECT_TRUE(CompareMatrices(compiled.value(3.0), pp.value(3.0), tol));
+  compiled += pp;
+  EXPECT_FALSE(compiled.is_compiled());
+  compiled.Compile();
+  EXPECT_FALSE((-compiled).is_compiled());
+  compiled.Reshape(2, 3);
+  EXPECT_FALSE(compiled.is_compiled());
+  compiled.Reshape(3, 2);
+  compiled.Compile();
+  compiled.AppendFirstOrderSegment(compiled.end_time() + 1.0,
+                                   Eigen::MatrixXd::Ones(3, 2));
+  EXPECT_FALSE(compiled.is_compiled());
+  compiled.Compile();
+  compiled.RemoveFinalSegment();
+  EXPECT_FALSE(compiled.is_compiled());
+}
+
 template <typename T>
 void TestScalarType() {
   VectorX<T> breaks(3);
@@ -460,6 +572,14 @@ void TestScalarType() {
               ExtractDoubleOrThrow(samples(0, 1)), 1e-14);
   EXPECT_NEAR(ExtractDoubleOrThrow(value(1)),
               ExtractDoubleOrThrow(samples(1, 1)), 1e-14);
+
+  PiecewisePolynomial<T> compiled = spline;
+  compiled.Compile();
+  const MatrixX<T> compiled_value = compiled.value(0.5);
+  EXPECT_NEAR(ExtractDoubleOrThrow(compiled_value(0)),
+              ExtractDoubleOrThrow(samples(0, 1)), 1e-14);
+  EXPECT_NEAR(ExtractDoubleOrThrow(compiled_value(1)),
+              ExtractDoubleOrThrow(samples(1, 1)), 1e-14);
 }
 
 GTEST_TEST(PiecewiseTrajectoryTest, ScalarTypes) {
@@ -261,6 +261,31 @@ GTEST_TEST(TestPiecewiseQuaternionSlerp, TestDerivatives) {
   }
 }
 
+// vector_values() returns the coefficients of orientation() at each time.
+GTEST_TEST(TestPiecewiseQuaternionSlerp, TestVectorValues) {
+  const std::vector<double> time = {0, 1.6, 2.32, 3};
+  const Vector3<double> axis = Vector3<double>(1, 2, 3).normalized();
+  std::vector<Quaternion<double>> quat;
+  for (const double angle : {1.0, 2.4, 5.3, -0.2}) {
+    quat.push_back(Quaternion<double>(AngleAxis<double>(angle, axis)));
+  }
+  const PiecewiseQuaternionSlerp<double> rot_spline(time, quat);
+
+  std::vector<double> times;
+  for (double t = -1.0; t < 4.0; t += 0.234) times.push_back(t);
+  times.push_back(1.6);
+  times.push_back(0.3);
+  Eigen::MatrixXd values;
+  rot_spline.vector_values(times, &values);
+  ASSERT_EQ(values.rows(), 4);
+  ASSERT_EQ(values.cols(), static_cast<int>(times.size()));
+  for (int i = 0; i < static_cast<int>(times.size()); ++i) {
+    const Quaternion<double> q = rot_spline.orientation(times[i]);
+    EXPECT_TRUE(CompareMatrices(
+        values.col(i), Eigen::Vector4d(q.w(), q.x(), q.y(), q.z()), 0));
+  }
+}
+
 }  // namespace
 }  // namespace trajectories
 }  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/piecewise_trajectory.h"
 
+#include <algorithm>
 #include <random>
 
 #include <gtest/gtest.h>
@@ -100,6 +101,38 @@ GTEST_TEST(PiecewiseTrajectoryTest, GetIndexTest) {
   TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
 }
 
+// The segment found by the previous query only speeds up the search; any
+// sequence of queries gets the same answers as a linear search of the breaks.
+GTEST_TEST(PiecewiseTrajectoryTest, SegmentIndexHintTest) {
+  const std::vector<double> time = {0, 1, 2, 3.5, 4, 7};
+  const PiecewiseTrajectoryTester traj(time);
+  const int num_segments = traj.get_number_of_segments();
+  auto linear_search = [&](double t) {
+    int index = 0;
+    while (index < num_segments - 1 && time[index + 1] <= t) ++index;
+    return index;
+  };
+
+  std::vector<double> queries = time;
+  for (double t = -1; t < 8; t += 0.05) queries.push_back(t);
+  std::vector<double> shuffled_queries = queries;
+  std::default_random_engine generator(456);
+  std::shuffle(shuffled_queries.begin(), shuffled_queries.end(), generator);
+  std::vector<double> decreasing_queries(queries.rbegin(), queries.rend());
+  for (const auto* sequence :
+       {&queries, &shuffled_queries, &decreasing_queries}) {
+    for (const double t : *sequence) {
+      EXPECT_EQ(traj.get_segment_index(t), linear_search(t)) << t;
+    }
+  }
+
+  // A copy starts from the hint of the original.
+  EXPECT_EQ(traj.get_segment_index(3.7), 3);
+  const PiecewiseTrajectoryTester copy(traj);
+  EXPECT_EQ(copy.get_segment_index(3.7), 3);
+  EXPECT_EQ(copy.get_segment_index(0.5), 0);
+}
+
 template <typename T>
 void TestScalarType() {
   std::default_random_engine generator(123);
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 
 namespace drake {
@@ -63,6 +64,55 @@ GTEST_TEST(TrajectoryTest, MakeDerivativesTest) {
       std::logic_error, ".* does not support .*");
 }
 
+// A vector-valued trajectory, whose value is (t, 2t) as a column (or row).
+class LineTrajectory : public Trajectory<double> {
+ public:
+  explicit LineTrajectory(bool column) : column_(column) {}
+
+  MatrixX<double> value(const double& t) const override {
+    const Eigen::Vector2d value(t, 2 * t);
+    if (column_) return value;
+    return value.transpose();
+  }
+  std::unique_ptr<Trajectory<double>> Clone() const override {
+    return nullptr;
+  }
+  Eigen::Index rows() const override { return column_ ? 2 : 1; }
+  Eigen::Index cols() const override { return column_ ? 1 : 2; }
+  double start_time() const override { return 0; }
+  double end_time() const override { return 1; }
+
+ private:
+  bool column_;
+};
+
+GTEST_TEST(TrajectoryTest, VectorValuesTest) {
+  const std::vector<double> times = {0.5, 0.25, 1};
+  Eigen::MatrixXd expected(2, 3);
+  expected << 0.5, 0.25, 1, 1, 0.5, 2;
+
+  const LineTrajectory column(true);
+  EXPECT_TRUE(CompareMatrices(column.vector_values(times), expected));
+  Eigen::MatrixXd values;
+  column.vector_values(times, &values);
+  EXPECT_TRUE(CompareMatrices(values, expected));
+  // The matrix is reused when it already has the right size.
+  const double* const data = values.data();
+  column.vector_values({0, 0.5, 0.5}, &values);
+  EXPECT_EQ(values.data(), data);
+  EXPECT_TRUE(CompareMatrices(values.col(0), Eigen::Vector2d::Zero()));
+
+  const LineTrajectory row(false);
+  EXPECT_TRUE(CompareMatrices(row.vector_values(times), expected.transpose()));
+  row.vector_values(times, &values);
+  EXPECT_TRUE(CompareMatrices(values, expected.transpose()));
+
+  const TrajectoryTester<double> matrix(false);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      matrix.vector_values(times, &values), std::runtime_error,
+      "This method only supports vector-valued trajectories.");
+}
+
 template <typename T>
 void TestScalarType() {
   TrajectoryTester<T> traj(true);
@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/trajectory.h"
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/unused.h"
 
 namespace drake {
@@ -7,22 +8,42 @@ namespace trajectories {
 
 template <typename T>
 MatrixX<T> Trajectory<T>::vector_values(const std::vector<T>& t) const {
+  MatrixX<T> values;
+  vector_values(t, &values);
+  return values;
+}
+
+template <typename T>
+void Trajectory<T>::vector_values(const std::vector<T>& t,
+                                  MatrixX<T>* values) const {
+  DRAKE_THROW_UNLESS(values != nullptr);
   if (cols() != 1 && rows() != 1) {
     throw std::runtime_error(
         "This method only supports vector-valued trajectories.");
   }
+  const int num_times = static_cast<int>(t.size());
   if (cols() == 1) {
-    MatrixX<T> values(rows(), t.size());
-    for (int i = 0; i < static_cast<int>(t.size()); i++) {
-      values.col(i) = value(t[i]);
+    if (values->rows() != rows() || values->cols() != num_times) {
+      values->resize(rows(), num_times);
     }
-    return values;
+  } else if (values->rows() != num_times || values->cols() != cols()) {
+    values->resize(num_times, cols());
   }
-  MatrixX<T> values(t.size(), cols());
-  for (int i = 0; i < static_cast<int>(t.size()); i++) {
-    values.row(i) = value(t[i]);
+  DoVectorValues(t, values);
+}
+
+template <typename T>
+void Trajectory<T>::DoVectorValues(const std::vector<T>& t,
+                                   MatrixX<T>* values) const {
+  if (cols() == 1) {
+    for (int i = 0; i < static_cast<int>(t.size()); i++) {
+      values->col(i) = value(t[i]);
+    }
+  } else {
+    for (int i = 0; i < static_cast<int>(t.size()); i++) {
+      values->row(i) = value(t[i]);
+    }
   }
-  return values;
 }
 
 template <typename T>
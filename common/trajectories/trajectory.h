@@ -45,6 +45,17 @@ class Trajectory {
   */
   MatrixX<T> vector_values(const std::vector<T>& t) const;
 
+  /**
+  * Evaluates the trajectory at each time @p t as vector_values(t) does, but
+  * writes the results into the caller-provided @p values, which is resized to
+  * the shape of that result only if necessary. Reusing the same matrix to
+  * resample a trajectory many times thus allocates no memory for the results,
+  * and subclasses may evaluate all of the times together (e.g., finding the
+  * segment of each time from the previous one when @p t is sorted).
+  * @throws std::runtime_error if both cols and rows are not equal to 1.
+  */
+  void vector_values(const std::vector<T>& t, MatrixX<T>* values) const;
+
   /**
    * Returns true iff the Trajectory provides and implementation for
    * EvalDerivative() and MakeDerivative().  The derivative need not be
@@ -91,6 +102,13 @@ class Trajectory {
 
   virtual bool do_has_derivative() const;
 
+  // Writes the value at each time `t[i]` into column `i` of `values` if
+  // cols() == 1 and into row `i` otherwise (in which case rows() == 1). The
+  // caller has already sized `values` accordingly. The default implementation
+  // calls value() for each time.
+  virtual void DoVectorValues(const std::vector<T>& t,
+                              MatrixX<T>* values) const;
+
   virtual MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const;
 
   virtual std::unique_ptr<Trajectory<T>> DoMakeDerivative(
@@ -17,7 +17,9 @@ namespace internal {
  The benchmark evaluates mesh intersection between soft and rigid meshes.
 
  It computes the contact surface formed from the intersection of an ellipsoid
- and a sphere using broad-phase culling (via a bounding volume hierarchy).
+ and a sphere using broad-phase culling (via a bounding volume hierarchy). Each
+ configuration is run with both triangle-tetrahedron clipping kernels (see
+ __TestName__ below) so that they can be compared.
  Arguments include:
  - __resolution__: An enumeration in the integer range from 0 to 3 that guides
    the level of mesh refinement, where 0 produces the coarsest meshes and 3
@@ -102,7 +104,12 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidSoftMesh
+   - __TestName__: Either RigidSoftMesh or RigidSoftMeshGeneralClipping. Both
+     compute the same contact surface. RigidSoftMesh uses the (default)
+     vectorized, fixed-capacity kernel to clip triangles by tetrahedra, while
+     RigidSoftMeshGeneralClipping uses the general, std::vector-based kernel.
+     The ratio of their times for the same arguments is the speedup due to the
+     vectorized kernel.
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -208,6 +215,26 @@ class MeshIntersectionBenchmark : public benchmark::Fixture {
     }
   }
 
+  /* Computes the contact surface between the meshes in every iteration of
+   the benchmark, with the given choice of triangle-tetrahedron clipping
+   kernel (see SurfaceVolumeIntersector).  */
+  void RunRigidSoftMesh(bool use_vectorized_clipping,
+                        const std::string& test_name,
+                        benchmark::State* state) {
+    SetupMeshes(*state);
+    const auto bvh_S = Bvh<VolumeMesh<double>>(mesh_S_);
+    const auto bvh_R = Bvh<SurfaceMesh<double>>(mesh_R_);
+    std::unique_ptr<SurfaceMesh<double>> surface_SR;
+    std::unique_ptr<SurfaceMeshFieldLinear<double, double>> e_SR;
+    std::vector<Vector3<double>> grad_eM_Ms;
+    for (auto _ : *state) {
+      SurfaceVolumeIntersector<double>(use_vectorized_clipping)
+          .SampleVolumeFieldOnSurface(field_S_, bvh_S, mesh_R_, bvh_R, X_SR_,
+                                      &surface_SR, &e_SR, &grad_eM_Ms);
+    }
+    RecordContactSurfaceResult(surface_SR.get(), test_name, *state);
+  }
+
   // Keep track of the number of elements in the resulting contact surface. We
   // use a static set because Google Benchmark runs these benchmarks multiple
   // times with unique instances of the fixture, and we want to avoid duplicate
@@ -227,38 +254,41 @@ std::set<std::string> MeshIntersectionBenchmark::contact_surface_result_keys;
 std::vector<std::string>
     MeshIntersectionBenchmark::contact_surface_result_output;
 
+// Registers the benchmark configurations shared by all of the tests.
+void ApplyMeshIntersectionArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMillisecond)
+      ->MinTime(2)
+      ->Args({0, 4, 0})   // 0 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({2, 0, 0})   // 2 resolution, 0 contact overlap, 0 rotation factor.
+      ->Args({2, 1, 0})   // 2 resolution, 1 contact overlap, 0 rotation factor.
+      ->Args({2, 2, 0})   // 2 resolution, 2 contact overlap, 0 rotation factor.
+      ->Args({2, 3, 0})   // 2 resolution, 3 contact overlap, 0 rotation factor.
+      ->Args({2, 4, 1})   // 2 resolution, 4 contact overlap, 1 rotation factor.
+      ->Args({2, 4, 2})   // 2 resolution, 4 contact overlap, 2 rotation factor.
+      ->Args({2, 4, 3})   // 2 resolution, 4 contact overlap, 3 rotation factor.
+      ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
+      ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
+}
+
 BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, RigidSoftMesh)
 // NOLINTNEXTLINE(runtime/references)
 (benchmark::State& state) {
-  SetupMeshes(state);
-  const auto bvh_S = Bvh<VolumeMesh<double>>(mesh_S_);
-  const auto bvh_R = Bvh<SurfaceMesh<double>>(mesh_R_);
-  std::unique_ptr<SurfaceMesh<double>> surface_SR;
-  std::unique_ptr<SurfaceMeshFieldLinear<double, double>> e_SR;
-  std::vector<Vector3<double>> grad_eM_Ms;
-  for (auto _ : state) {
-    SurfaceVolumeIntersector<double>().SampleVolumeFieldOnSurface(
-        field_S_, bvh_S, mesh_R_, bvh_R, X_SR_, &surface_SR, &e_SR,
-        &grad_eM_Ms);
-  }
-  RecordContactSurfaceResult(surface_SR.get(), "RigidSoftMesh", state);
+  RunRigidSoftMesh(true /* use_vectorized_clipping */, "RigidSoftMesh", &state);
 }
 BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMesh)
-    ->Unit(benchmark::kMillisecond)
-    ->MinTime(2)
-    ->Args({0, 4, 0})   // 0 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({2, 0, 0})   // 2 resolution, 0 contact overlap, 0 rotation factor.
-    ->Args({2, 1, 0})   // 2 resolution, 1 contact overlap, 0 rotation factor.
-    ->Args({2, 2, 0})   // 2 resolution, 2 contact overlap, 0 rotation factor.
-    ->Args({2, 3, 0})   // 2 resolution, 3 contact overlap, 0 rotation factor.
-    ->Args({2, 4, 1})   // 2 resolution, 4 contact overlap, 1 rotation factor.
-    ->Args({2, 4, 2})   // 2 resolution, 4 contact overlap, 2 rotation factor.
-    ->Args({2, 4, 3})   // 2 resolution, 4 contact overlap, 3 rotation factor.
-    ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
-    ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
+    ->Apply(ApplyMeshIntersectionArgs);
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, RigidSoftMeshGeneralClipping)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  RunRigidSoftMesh(false /* use_vectorized_clipping */,
+                   "RigidSoftMeshGeneralClipping", &state);
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMeshGeneralClipping)
+    ->Apply(ApplyMeshIntersectionArgs);
 
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
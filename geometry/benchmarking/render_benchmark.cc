@@ -5,6 +5,7 @@
 #include <gflags/gflags.h>
 
 #include "drake/common/filesystem.h"
+#include "drake/geometry/render/render_engine_ray_cast_factory.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/systems/sensors/image_writer.h"
 
@@ -29,7 +30,7 @@ namespace render {
  should produce the same output image. This provides a measure of the
  scalability as a simulation includes an increasing number of cameras.
 
- The output image can be configured to an arbitrary size. For both RenderEngine
+ The output image can be configured to an arbitrary size. For all RenderEngine
  implementations, larger images take more time.
 
  <h2>Running the benchmark</h2>
@@ -90,6 +91,10 @@ RenderEngineBenchmark/VtkLabel/1/10/640/480                       26.1 ms
      - __VtkColor__: Renders the color image from RenderEngineVtk.
      - __VtkDepth__: Renders the depth image from RenderEngineVtk.
      - __VtkLabel__: Renders the label image from RenderEngineVtk.
+     - __RayCastColor__: Renders the (flat-shaded) color image from the
+       ray-casting engine (see MakeRenderEngineRayCast()).
+     - __RayCastDepth__: Renders the depth image from the ray-casting engine.
+     - __RayCastLabel__: Renders the label image from the ray-casting engine.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
      they each render the same image.
@@ -112,6 +117,13 @@ RenderEngineBenchmark/VtkLabel/1/10/640/480                       26.1 ms
        for label.
      - RenderEngineVtk also increased a factor of 10X when path-tracing the
        scene when we increased the number of cameras by a factor of 10X.
+
+ The ray-casting engine runs on the CPU and uses all of the hardware threads,
+ so its benchmarks report wall-clock (real) time; its `CPU` column only counts
+ the calling thread. Its cost grows with the number of pixels and, only
+ logarithmically, with the number of triangles, so it is most competitive for
+ small images, and on machines where the OpenGL-based engines fall back to
+ software rendering (or cannot run at all).
  */
 
 // Friend class for accessing RenderEngine's protected/private functionality.
@@ -176,6 +188,21 @@ class RenderEngineBenchmark : public benchmark::Fixture {
     SetupScene(sphere_count, camera_count, width, height);
   }
 
+  /* Set up the scene using the ray-casting render engine, with one thread per
+   hardware thread.
+   @param sphere_count Number of spheres to include in the render.
+   @param camera_count Number of cameras to include in the render.
+   @param width Width of the render image.
+   @param height Height of the render image.
+   */
+  void SetupRayCastRender(const int sphere_count, const int camera_count,
+                          const int width, const int height) {
+    RenderEngineRayCastParams params;
+    params.default_clear_color = bg_rgb_;
+    renderer_ = MakeRenderEngineRayCast(params);
+    SetupScene(sphere_count, camera_count, width, height);
+  }
+
   /* Parse arguments from the benchmark state.
    @return A tuple representing the sphere count, camera count, width, and
            height.  */
@@ -353,6 +380,81 @@ BENCHMARK_REGISTER_F(RenderEngineBenchmark, VtkLabel)
     ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
     ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
 
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, RayCastColor)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupRayCastRender(sphere_count, camera_count, width, height);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                        FLAGS_show_window);
+      renderer_->RenderColorImage(color_cam, &color_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name = image_path_name("RayCastColor", state, "png");
+    SaveToPng(color_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, RayCastColor)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
+
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, RayCastDepth)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupRayCastRender(sphere_count, camera_count, width, height);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      renderer_->RenderDepthImage(depth_cameras_[i], &depth_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name = image_path_name("RayCastDepth", state,
+                                                  "tiff");
+    SaveToTiff(depth_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, RayCastDepth)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Args({1, 1, 640, 480})     // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({4, 1, 640, 480})     // 4 spheres, 1 camera, 640 width, 480 height.
+    ->Args({8, 1, 640, 480})     // 8 spheres, 1 camera, 640 width, 480 height.
+    ->Args({1, 10, 640, 480})    // 1 sphere, 10 cameras, 640 width, 480 height.
+    ->Args({1, 1, 320, 240})     // 1 sphere, 1 camera, 320 width, 240 height.
+    ->Args({1, 1, 1280, 960});   // 1 sphere, 1 camera, 1280 width, 960 height.
+
+BENCHMARK_DEFINE_F(RenderEngineBenchmark, RayCastLabel)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  auto [sphere_count, camera_count, width, height] = ReadState(state);
+  SetupRayCastRender(sphere_count, camera_count, width, height);
+  for (auto _ : state) {
+    for (int i = 0; i < camera_count; ++i) {
+      const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                        FLAGS_show_window);
+      renderer_->RenderLabelImage(color_cam, &label_image_);
+    }
+  }
+  if (!FLAGS_save_image_path.empty()) {
+    const std::string path_name = image_path_name("RayCastLabel", state, "png");
+    SaveToPng(label_image_, path_name);
+    saved_image_paths.insert(path_name);
+  }
+}
+BENCHMARK_REGISTER_F(RenderEngineBenchmark, RayCastLabel)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Args({1, 1, 640, 480})    // 1 sphere, 1 camera, 640 width, 480 height.
+    ->Args({1, 10, 640, 480});  // 1 sphere, 10 cameras, 640 width, 480 height.
+
 void Cleanup() {
   if (!RenderEngineBenchmark::saved_image_paths.empty()) {
     std::cout << "Saved rendered images to:" << std::endl;
@@ -1075,6 +1075,66 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
   engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(
+    const std::vector<render::RenderImageRequest>& requests) const {
+  // The requests of each engine, in the order in which the engines are first
+  // named.
+  std::vector<std::pair<const render::RenderEngine*,
+                        std::vector<render::RenderImageRequest>>>
+      engine_requests;
+  auto add_request = [this, &engine_requests](
+                         const std::string& renderer_name,
+                         render::RenderImageRequest request) {
+    const render::RenderEngine* engine = &GetRenderEngineOrThrow(renderer_name);
+    auto iter = std::find_if(
+        engine_requests.begin(), engine_requests.end(),
+        [engine](const auto& entry) { return entry.first == engine; });
+    if (iter == engine_requests.end()) {
+      iter = engine_requests.emplace(engine_requests.end(), engine,
+                                     std::vector<render::RenderImageRequest>{});
+    }
+    iter->second.push_back(std::move(request));
+  };
+
+  for (const render::RenderImageRequest& request : requests) {
+    const bool renders_color =
+        request.color_image != nullptr || request.label_image != nullptr;
+    const bool renders_depth = request.depth_image != nullptr;
+    if (!renders_color && !renders_depth) continue;
+    if (renders_color && renders_depth && request.color_camera &&
+        request.depth_camera &&
+        request.color_camera->core().renderer_name() !=
+            request.depth_camera->core().renderer_name()) {
+      // The cameras name different engines; each renders its own images.
+      render::RenderImageRequest color_request = request;
+      color_request.depth_camera.reset();
+      color_request.depth_image = nullptr;
+      add_request(request.color_camera->core().renderer_name(),
+                  std::move(color_request));
+      render::RenderImageRequest depth_request = request;
+      depth_request.color_camera.reset();
+      depth_request.color_image = nullptr;
+      depth_request.label_image = nullptr;
+      add_request(request.depth_camera->core().renderer_name(),
+                  std::move(depth_request));
+    } else if (request.depth_camera && (!renders_color ||
+                                        !request.color_camera)) {
+      add_request(request.depth_camera->core().renderer_name(), request);
+    } else if (request.color_camera) {
+      add_request(request.color_camera->core().renderer_name(), request);
+    } else {
+      throw std::logic_error(
+          "Can't render images of a request that has no cameras");
+    }
+  }
+
+  for (auto& [engine, engine_request] : engine_requests) {
+    // See note in RenderColorImage() about this const cast.
+    const_cast<render::RenderEngine*>(engine)->RenderImages(engine_request);
+  }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
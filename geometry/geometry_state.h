@@ -388,6 +388,13 @@ class GeometryState {
     return geometry_engine_->ComputePointPairPenetration();
   }
 
+  /** Implementation of QueryObject::ComputePointPairPenetration() that writes
+   into `pairs`.  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* pairs) const {
+    geometry_engine_->ComputePointPairPenetration(pairs);
+  }
+
   /** Implementation of QueryObject::ComputeContactSurfaces().  */
   std::vector<ContactSurface<T>> ComputeContactSurfaces() const {
     return geometry_engine_->ComputeContactSurfaces(X_WGs_);
@@ -437,6 +444,22 @@ class GeometryState {
 
   //@}
 
+  //---------------------------------------------------------------------------
+  /** @name                Proximity query configuration  */
+  //@{
+
+  /** Implementation of SceneGraph::set_contact_surface_parallelism().  */
+  void set_contact_surface_parallelism(int num_parallel_executions) {
+    geometry_engine_->set_contact_surface_parallelism(num_parallel_executions);
+  }
+
+  /** Implementation of SceneGraph::contact_surface_parallelism().  */
+  int contact_surface_parallelism() const {
+    return geometry_engine_->contact_surface_parallelism();
+  }
+
+  //@}
+
   //---------------------------------------------------------------------------
   /** @name                Signed Distance Queries
    See @ref signed_distance_query "Signed Distance Queries" for more details.
@@ -549,6 +572,11 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(
+      const std::vector<render::RenderImageRequest>& requests) const;
+
   //@}
 
   /** @name Scalar conversion */
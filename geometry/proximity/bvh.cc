@@ -1,8 +1,10 @@
 #include "drake/geometry/proximity/bvh.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <set>
+#include <stack>
 #include <vector>
 
 #include "drake/geometry/utilities.h"
@@ -17,6 +19,37 @@ using math::RotationMatrixd;
 
 template <class MeshType>
 Bvh<MeshType>::Bvh(const MeshType& mesh) {
+  Build(mesh);
+}
+
+template <class MeshType>
+Bvh<MeshType>::Bvh(std::unique_ptr<BvNode<MeshType>> root_node)
+    : root_node_(std::move(root_node)) {
+  DRAKE_DEMAND(root_node_ != nullptr);
+  volume_ratio_at_build_ = CalcVolumeRatio();
+}
+
+template <class MeshType>
+void Bvh<MeshType>::Refit(const MeshType& mesh) {
+  std::vector<IndexType> elements;
+  elements.reserve(mesh.num_elements());
+  RefitNode(mesh, root_node_.get(), &elements);
+}
+
+template <class MeshType>
+bool Bvh<MeshType>::RefitOrRebuild(const MeshType& mesh,
+                                   double max_volume_growth) {
+  DRAKE_DEMAND(max_volume_growth >= 1.0);
+  Refit(mesh);
+  if (CalcVolumeRatio() <= max_volume_growth * volume_ratio_at_build_) {
+    return false;
+  }
+  Build(mesh);
+  return true;
+}
+
+template <class MeshType>
+void Bvh<MeshType>::Build(const MeshType& mesh) {
   // Generate element indices and corresponding centroids. These are used
   // for calculating the split point of the volumes.
   const int num_elements = mesh.num_elements();
@@ -27,6 +60,66 @@ Bvh<MeshType>::Bvh(const MeshType& mesh) {
 
   root_node_ =
       BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  volume_ratio_at_build_ = CalcVolumeRatio();
+}
+
+template <class MeshType>
+void Bvh<MeshType>::RefitNode(const MeshType& mesh_M, BvNode<MeshType>* node,
+                              std::vector<IndexType>* elements) {
+  DRAKE_DEMAND(node != nullptr);
+  DRAKE_DEMAND(elements != nullptr);
+  // Collect the elements in this node's subtree, refitting the children on
+  // the way.
+  const int first = elements->size();
+  if (node->is_leaf()) {
+    for (int i = 0; i < node->num_element_indices(); ++i) {
+      elements->push_back(node->element_index(i));
+    }
+  } else {
+    auto& children =
+        std::get<typename BvNode<MeshType>::NodeChildren>(node->child_);
+    RefitNode(mesh_M, children.left.get(), elements);
+    RefitNode(mesh_M, children.right.get(), elements);
+  }
+
+  // B is the canonical frame of the node's bounding volume, whose orientation
+  // we keep. We bound the vertices of the subtree's elements along B's axes.
+  // Bounding the children's boxes instead would be cheaper, but the boxes
+  // would grow with each level of the tree.
+  const RotationMatrixd& R_MB = node->bv_.pose().rotation();
+  const RotationMatrixd R_BM = R_MB.inverse();
+  Vector3d lower_B = Vector3d::Constant(std::numeric_limits<double>::max());
+  Vector3d upper_B = Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (auto it = elements->begin() + first; it != elements->end(); ++it) {
+    const auto& element = mesh_M.element(*it);
+    for (int v = 0; v < kElementVertexCount; ++v) {
+      const Vector3d p_BV =
+          R_BM * convert_to_double(mesh_M.vertex(element.vertex(v)).r_MV());
+      lower_B = lower_B.cwiseMin(p_BV);
+      upper_B = upper_B.cwiseMax(p_BV);
+    }
+  }
+  const Vector3d p_BoC_B = 0.5 * (lower_B + upper_B);
+  const Vector3d half_width = 0.5 * (upper_B - lower_B);
+  node->bv_ = Obb(math::RigidTransformd(R_MB, R_MB * p_BoC_B), half_width);
+}
+
+template <class MeshType>
+double Bvh<MeshType>::CalcVolumeRatio() const {
+  double total_volume = 0;
+  std::stack<const BvNode<MeshType>*> nodes;
+  nodes.push(root_node_.get());
+  while (!nodes.empty()) {
+    const BvNode<MeshType>* node = nodes.top();
+    nodes.pop();
+    total_volume += node->bv().CalcVolume();
+    if (!node->is_leaf()) {
+      nodes.push(&node->left());
+      nodes.push(&node->right());
+    }
+  }
+  // Padding guarantees that every box has a positive volume.
+  return total_volume / root_node_->bv().CalcVolume();
 }
 
 template <class MeshType>
@@ -33,6 +33,9 @@ struct MeshTraits<VolumeMesh<T>> {
   static constexpr int kMaxElementPerBvhLeaf = 1;
 };
 
+template <class MeshType>
+class Bvh;
+
 /* Node of the tree structure representing the Bvh.  */
 template <class MeshType>
 class BvNode {
@@ -115,6 +118,9 @@ class BvNode {
   }
 
  private:
+  // Bvh::Refit() updates the bounding volumes of the nodes in place.
+  friend class Bvh<MeshType>;
+
   struct NodeChildren {
     std::unique_ptr<BvNode<MeshType>> left;
     std::unique_ptr<BvNode<MeshType>> right;
@@ -164,8 +170,9 @@ using BvttCallback = std::function<BvttCallbackResult(
  hierarchy's frame H. Leaf nodes contain element indices into elements of the
  mesh. The BVH needs a reference to the mesh in order to build the tree, but
  does not own the mesh.
- @pre    The mesh is not mutable. Modifications to the mesh after
-         constructing the BVH will make the BVH invalid.
+ @pre    The mesh's elements are not mutable. Moving the mesh's vertices after
+         constructing the BVH makes the BVH invalid until Refit() or
+         RefitOrRebuild() is called with the modified mesh.
  @tparam MeshType SurfaceMesh<double> or VolumeMesh<double> (Exotic types like
          SurfaceMesh<AutoDiffXd> are not supported).  */
 template <class MeshType>
@@ -175,12 +182,20 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
+  /* Constructs the hierarchy from an existing tree, e.g., one that was built
+   for a mesh and later restored from the on-disk mesh cache (see
+   mesh_cache.h). The tree is taken as is; it is not validated against any
+   mesh.
+   @pre `root_node` is not null.  */
+  explicit Bvh(std::unique_ptr<BvNode<MeshType>> root_node);
+
   Bvh(const Bvh& bvh) { *this = bvh; }
 
   Bvh& operator=(const Bvh& bvh) {
     if (&bvh == this) return *this;
 
     root_node_ = std::make_unique<BvNode<MeshType>>(*bvh.root_node_);
+    volume_ratio_at_build_ = bvh.volume_ratio_at_build_;
     return *this;
   }
 
@@ -189,6 +204,43 @@ class Bvh {
 
   const BvNode<MeshType>& root_node() const { return *root_node_; }
 
+  /* Updates the bounding volumes of this hierarchy to bound the current vertex
+   positions of `mesh`, without changing the structure of the tree. This is
+   intended for meshes whose vertices move (e.g., deformable bodies) but whose
+   elements don't change. Each box keeps the orientation it was given when the
+   hierarchy was built; only its center and half widths are updated to tightly
+   bound the vertices of the elements in its subtree. The cost is O(n log n)
+   in the number of elements n, without the sorting and box orientation
+   optimization done when building the hierarchy.
+
+   Refitted boxes are never tighter than freshly built ones and become looser
+   as the mesh deforms away from its configuration at build time; see
+   RefitOrRebuild().
+
+   @pre `mesh` has the same elements as the mesh this hierarchy was built (or
+        last rebuilt) from; only the vertex positions may differ.  */
+  void Refit(const MeshType& mesh);
+
+  /* Refits this hierarchy to `mesh` as in Refit(), and then rebuilds it from
+   scratch if the refitted boxes degraded too much.
+
+   Quality is measured as the ratio of the total volume of all the boxes to the
+   volume of the root box, which is proportional to the expected number of
+   boxes containing a point sampled uniformly in the root box, i.e., to the
+   expected cost of a query. The ratio is invariant to rigid motions and
+   uniform scaling of the mesh, and grows as elements drift away from the
+   elements they were grouped with at build time. The hierarchy is rebuilt
+   when the ratio exceeds `max_volume_growth` times the ratio measured when the
+   hierarchy was last built.
+
+   @param mesh               The mesh with updated vertex positions.
+   @param max_volume_growth  The allowed growth in the volume ratio before
+                             rebuilding.
+   @returns `true` if the hierarchy was rebuilt.
+   @pre `mesh` satisfies the preconditions of Refit().
+   @pre `max_volume_growth` >= 1.  */
+  bool RefitOrRebuild(const MeshType& mesh, double max_volume_growth = 2.0);
+
   /* Perform a query of this bvh's mesh elements against the given bvh's
    mesh elements and runs the callback for each unculled pair.  */
   template <class OtherMeshType>
@@ -332,6 +384,19 @@ class Bvh {
   static Vector3<double> ComputeCentroid(const MeshType& mesh,
                                          IndexType i);
 
+  // Builds the tree from scratch and records its volume ratio.
+  void Build(const MeshType& mesh);
+
+  // Refits the bounding volumes of the subtree rooted at `node` to the vertex
+  // positions of `mesh`, see Refit(), and appends the indices of the elements
+  // in the subtree to `elements`.
+  static void RefitNode(const MeshType& mesh, BvNode<MeshType>* node,
+                        std::vector<IndexType>* elements);
+
+  // Returns the ratio of the total volume of all the bounding volumes in this
+  // hierarchy to the volume of the root's bounding volume.
+  double CalcVolumeRatio() const;
+
   // Tests that the two hierarchy trees, rooted at nodes a and b, are equal in
   // the sense that they have identical structure and equal bounding volumes
   // (see Obb::Equal()).
@@ -340,6 +405,10 @@ class Bvh {
   static constexpr int kElementVertexCount = MeshType::kDim + 1;
 
   std::unique_ptr<BvNode<MeshType>> root_node_;
+
+  // The value of CalcVolumeRatio() right after the tree was last built, used
+  // as the reference by RefitOrRebuild().
+  double volume_ratio_at_build_{1.0};
 };
 
 }  // namespace internal
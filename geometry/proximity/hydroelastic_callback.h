@@ -37,6 +37,10 @@ namespace hydroelastic {
       contact surfaces.
     - A vector of contact surfaces -- one instance of ContactSurface for
       every supported, unfiltered penetrating pair.
+    - Optionally, a vector of deferred soft-rigid pairs. If provided, the
+      contact surfaces of supported pairs are not computed during the broad
+      phase; the pairs are recorded instead so that the caller can compute
+      them afterwards with CalcContactSurface() (e.g., in parallel).
 
  @tparam T The computation scalar.  */
 template <typename T>
@@ -49,16 +53,21 @@ struct CallbackData {
    @param X_WGs_in                The T-valued poses. Aliased.
    @param geometries_in           The set of all hydroelastic geometric
                                   representations. Aliased.
-   @param surfaces_in             The output results. Aliased.  */
+   @param surfaces_in             The output results. Aliased.
+   @param deferred_pairs_in       If not null, the (soft, rigid) id pairs whose
+                                  contact surfaces are deferred. Aliased.  */
   CallbackData(
       const CollisionFilterLegacy* collision_filter_in,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs_in,
       const Geometries* geometries_in,
-      std::vector<ContactSurface<T>>* surfaces_in)
+      std::vector<ContactSurface<T>>* surfaces_in,
+      std::vector<std::pair<GeometryId, GeometryId>>* deferred_pairs_in =
+          nullptr)
       : collision_filter(*collision_filter_in),
         X_WGs(*X_WGs_in),
         geometries(*geometries_in),
-        surfaces(*surfaces_in) {
+        surfaces(*surfaces_in),
+        deferred_pairs(deferred_pairs_in) {
     DRAKE_DEMAND(collision_filter_in);
     DRAKE_DEMAND(X_WGs_in);
     DRAKE_DEMAND(geometries_in);
@@ -76,11 +85,16 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces;
+
+  /* If not null, the (soft, rigid) id pairs whose contact surfaces have yet to
+   be computed.  */
+  std::vector<std::pair<GeometryId, GeometryId>>* deferred_pairs{};
 };
 
 enum class CalcContactSurfaceResult {
   kCalculated,          //< Computation was successful; a contact surface is
                         //< only produced if the objects were in contact.
+                        //< Also reported for pairs that were deferred.
   kUnsupported,         //< Contact surface can't be computed for the geometry
                         //< pair.
   kHalfSpaceHalfSpace,  //< Contact between two half spaces; not allowed.
@@ -127,8 +141,28 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
   }
 }
 
+/* Computes the contact surface (if it exists) between the soft geometry with
+ id `id_S` and the rigid geometry with id `id_R`. This is the second half of
+ MaybeCalcContactSurface(), for pairs that have already been validated; it
+ only reads from `geometries` and `X_WGs` and can therefore be invoked
+ concurrently for different pairs.
+ @pre `id_S` and `id_R` are a soft and a rigid geometry, respectively, and are
+      not both half spaces.  */
+template <typename T>
+std::unique_ptr<ContactSurface<T>> CalcContactSurface(
+    const Geometries& geometries,
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    GeometryId id_S, GeometryId id_R) {
+  const SoftGeometry& soft = geometries.soft_geometry(id_S);
+  const RigidGeometry& rigid = geometries.rigid_geometry(id_R);
+  const math::RigidTransform<T>& X_WS(X_WGs.at(id_S));
+  const math::RigidTransform<T>& X_WR(X_WGs.at(id_R));
+  return DispatchRigidSoftCalculation(soft, X_WS, id_S, rigid, X_WR, id_R);
+}
+
 /* Calculates the contact surface (if it exists) between two potentially
- colliding geometries.
+ colliding geometries. If `callback_data` has deferred pairs, the calculation
+ of a supported pair is deferred instead (see CallbackData).
 
  @param object_A_ptr         Pointer to the first object in the pair (the order
                              has no significance).
@@ -176,11 +210,13 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
     return CalcContactSurfaceResult::kHalfSpaceHalfSpace;
   }
 
-  const math::RigidTransform<T>& X_WS(data->X_WGs.at(id_S));
-  const math::RigidTransform<T>& X_WR(data->X_WGs.at(id_R));
+  if (data->deferred_pairs != nullptr) {
+    data->deferred_pairs->emplace_back(id_S, id_R);
+    return CalcContactSurfaceResult::kCalculated;
+  }
 
   std::unique_ptr<ContactSurface<T>> surface =
-      DispatchRigidSoftCalculation(soft, X_WS, id_S, rigid, X_WR, id_R);
+      CalcContactSurface(data->geometries, data->X_WGs, id_S, id_R);
 
   if (surface != nullptr) {
     DRAKE_DEMAND(surface->id_M() < surface->id_N());
@@ -12,6 +12,7 @@
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_cache.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
@@ -231,22 +232,37 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   return RigidGeometry(RigidMesh(move(mesh)));
 }
 
+namespace {
+
+// Creates the rigid representation of the scaled .obj file named by a Mesh or
+// Convex specification. It goes through the on-disk mesh cache if one is
+// configured (see GetMeshCacheDirectory()).
+RigidGeometry MakeRigidObjRepresentation(const std::string& filename,
+                                         double scale) {
+  const std::optional<std::string> cache_directory = GetMeshCacheDirectory();
+  if (cache_directory.has_value()) {
+    ObjSurfaceMeshWithBvh cached =
+        ReadObjToSurfaceMeshWithBvh(filename, scale, *cache_directory);
+    return RigidGeometry(RigidMesh(move(cached.mesh), move(cached.bvh)));
+  }
+  auto mesh = make_unique<SurfaceMesh<double>>(
+      ReadObjToSurfaceMesh(filename, scale));
+  return RigidGeometry(RigidMesh(move(mesh)));
+}
+
+}  // namespace
+
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Mesh& mesh_spec, const ProximityProperties&) {
   // Mesh does not use any properties.
-  auto mesh = make_unique<SurfaceMesh<double>>(
-      ReadObjToSurfaceMesh(mesh_spec.filename(), mesh_spec.scale()));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidObjRepresentation(mesh_spec.filename(), mesh_spec.scale());
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Convex& convex_spec, const ProximityProperties&) {
   // Convex does not use any properties.
-  auto mesh = make_unique<SurfaceMesh<double>>(
-      ReadObjToSurfaceMesh(convex_spec.filename(), convex_spec.scale()));
-
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return MakeRigidObjRepresentation(convex_spec.filename(),
+                                    convex_spec.scale());
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -187,6 +187,15 @@ class RigidMesh {
         bvh_(std::make_unique<Bvh<SurfaceMesh<double>>>(
             *mesh_)) {}
 
+  /* Constructs from a mesh and a hierarchy that was previously built for it
+   (e.g., one restored from the on-disk mesh cache).  */
+  RigidMesh(std::unique_ptr<SurfaceMesh<double>> mesh,
+            std::unique_ptr<Bvh<SurfaceMesh<double>>> bvh)
+      : mesh_(std::move(mesh)), bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr);
+    DRAKE_DEMAND(bvh_ != nullptr);
+  }
+
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
   const SurfaceMesh<double>& mesh() const {
@@ -0,0 +1,350 @@
+#include "drake/geometry/proximity/mesh_cache.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/hash.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using std::make_unique;
+using std::unique_ptr;
+using Node = BvNode<SurfaceMesh<double>>;
+
+// Bump this whenever the layout of an entry, or the way that the mesh or its
+// hierarchy is computed, changes; older entries are then ignored.
+constexpr uint32_t kFormatVersion = 1;
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'M', 'E', 'S', 'H', 'C'};
+
+// An entry is an EntryHeader, followed by num_vertices * 3 doubles (the vertex
+// positions), num_faces * 3 int32_t (the face vertex indices, zero-padded to a
+// multiple of 8 bytes), and num_nodes NodeRecord (the Bvh in pre-order). Every
+// record is a multiple of 8 bytes in size so that every section of the file
+// starts at an offset that is aligned for its type.
+struct EntryHeader {
+  char magic[8];
+  uint32_t version;
+  int32_t num_vertices;
+  uint64_t key;
+  uint64_t content_size;
+  double scale;
+  int32_t num_faces;
+  int32_t num_nodes;
+};
+static_assert(sizeof(EntryHeader) % 8 == 0);
+
+struct NodeRecord {
+  // The pose X_HB of the node's bounding volume, as R_HB (column major)
+  // followed by p_HoBo_H, and the box's half widths.
+  double rotation[9];
+  double translation[3];
+  double half_width[3];
+  // The number of element indices of a leaf node, or -1 for a branch node.
+  // The children of a branch node are the subtrees whose records follow it.
+  int32_t num_index;
+  int32_t indices[Node::kMaxElementPerLeaf];
+};
+static_assert(sizeof(NodeRecord) % 8 == 0);
+
+size_t CalcFaceBytes(int num_faces) {
+  const size_t bytes = sizeof(int32_t) * 3 * num_faces;
+  return (bytes + 7) / 8 * 8;
+}
+
+size_t CalcEntrySize(int num_vertices, int num_faces, int num_nodes) {
+  return sizeof(EntryHeader) + sizeof(double) * 3 * num_vertices +
+         CalcFaceBytes(num_faces) + sizeof(NodeRecord) * num_nodes;
+}
+
+std::string ReadFileContents(const std::string& filename) {
+  std::ifstream input(filename, std::ios::binary);
+  if (!input.is_open()) {
+    throw std::runtime_error("Cannot open file '" + filename + "'");
+  }
+  std::stringstream buffer;
+  buffer << input.rdbuf();
+  return buffer.str();
+}
+
+uint64_t CalcKey(const std::string& content, double scale) {
+  DefaultHasher hasher;
+  hasher(content.data(), content.size());
+  hasher(&scale, sizeof(scale));
+  hasher(&kFormatVersion, sizeof(kFormatVersion));
+  return static_cast<size_t>(hasher);
+}
+
+// Appends the records of the subtree rooted at `node` in pre-order.
+void AppendNodeRecords(const Node& node, std::vector<NodeRecord>* records) {
+  NodeRecord record{};
+  const Obb& bv = node.bv();
+  Eigen::Map<Matrix3d>(record.rotation) = bv.pose().rotation().matrix();
+  Eigen::Map<Vector3d>(record.translation) = bv.pose().translation();
+  Eigen::Map<Vector3d>(record.half_width) = bv.half_width();
+  if (node.is_leaf()) {
+    record.num_index = node.num_element_indices();
+    for (int i = 0; i < record.num_index; ++i) {
+      record.indices[i] = node.element_index(i);
+    }
+    records->push_back(record);
+  } else {
+    record.num_index = -1;
+    records->push_back(record);
+    AppendNodeRecords(node.left(), records);
+    AppendNodeRecords(node.right(), records);
+  }
+}
+
+// Rebuilds the tree whose pre-order records are `records`, or returns nullptr
+// if the records are malformed. The records come from a file and so cannot be
+// trusted; rather than recursing to a depth that the file controls, they are
+// processed in reverse order with an explicit stack of the subtrees built so
+// far. In reverse pre-order, a branch's left subtree is the last one built,
+// and its right subtree is the one before that.
+unique_ptr<Node> ParseNodeRecords(const std::vector<NodeRecord>& records,
+                                  int num_faces) {
+  std::vector<unique_ptr<Node>> subtrees;
+  for (auto record = records.rbegin(); record != records.rend(); ++record) {
+    // The recorded half widths already include the constructor's padding.
+    Obb bv = Obb::MakeUnpadded(
+        RigidTransformd(
+            RotationMatrixd(Eigen::Map<const Matrix3d>(record->rotation)),
+            Eigen::Map<const Vector3d>(record->translation)),
+        Eigen::Map<const Vector3d>(record->half_width));
+    if (record->num_index == -1) {
+      if (subtrees.size() < 2) return nullptr;
+      unique_ptr<Node> left = std::move(subtrees.back());
+      subtrees.pop_back();
+      unique_ptr<Node> right = std::move(subtrees.back());
+      subtrees.pop_back();
+      subtrees.push_back(
+          make_unique<Node>(std::move(bv), std::move(left), std::move(right)));
+      continue;
+    }
+    if (record->num_index < 1 || record->num_index > Node::kMaxElementPerLeaf) {
+      return nullptr;
+    }
+    typename Node::LeafData data{record->num_index, {}};
+    for (int i = 0; i < record->num_index; ++i) {
+      if (record->indices[i] < 0 || record->indices[i] >= num_faces) {
+        return nullptr;
+      }
+      data.indices[i] = SurfaceFaceIndex(record->indices[i]);
+    }
+    subtrees.push_back(make_unique<Node>(std::move(bv), data));
+  }
+  if (subtrees.size() != 1) return nullptr;
+  return std::move(subtrees.back());
+}
+
+// Writes all `size` bytes at `data` to `fd`, or returns false.
+bool WriteAll(int fd, const void* data, size_t size) {
+  const char* cursor = static_cast<const char*>(data);
+  while (size > 0) {
+    const ssize_t written = ::write(fd, cursor, size);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    cursor += written;
+    size -= written;
+  }
+  return true;
+}
+
+// Returns the mesh and hierarchy stored in the entry at `path`, or nullopt if
+// there is no such entry or it does not hold a valid result for the given
+// key, content size, and scale.
+std::optional<ObjSurfaceMeshWithBvh> LoadEntry(const std::string& path,
+                                               uint64_t key,
+                                               uint64_t content_size,
+                                               double scale) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input.is_open()) return std::nullopt;
+  // The size is taken from the opened file (rather than from `path`), which
+  // another process may replace at any time.
+  input.seekg(0, std::ios::end);
+  const std::streamoff size = input.tellg();
+  input.seekg(0, std::ios::beg);
+  auto read = [&input](void* data, size_t bytes) {
+    input.read(static_cast<char*>(data), bytes);
+    return static_cast<size_t>(input.gcount()) == bytes;
+  };
+
+  EntryHeader header;
+  if (size < static_cast<std::streamoff>(sizeof(header)) ||
+      !read(&header, sizeof(header))) {
+    return std::nullopt;
+  }
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kFormatVersion || header.key != key ||
+      header.content_size != content_size || header.scale != scale ||
+      header.num_vertices < 3 || header.num_faces < 1 ||
+      header.num_nodes < 1 ||
+      CalcEntrySize(header.num_vertices, header.num_faces,
+                    header.num_nodes) != static_cast<size_t>(size)) {
+    return std::nullopt;
+  }
+
+  std::vector<double> positions(3 * header.num_vertices);
+  std::vector<int32_t> face_indices(CalcFaceBytes(header.num_faces) /
+                                    sizeof(int32_t));
+  std::vector<NodeRecord> node_records(header.num_nodes);
+  if (!read(positions.data(), sizeof(double) * positions.size()) ||
+      !read(face_indices.data(), sizeof(int32_t) * face_indices.size()) ||
+      !read(node_records.data(), sizeof(NodeRecord) * node_records.size())) {
+    return std::nullopt;
+  }
+
+  std::vector<SurfaceVertex<double>> vertices;
+  vertices.reserve(header.num_vertices);
+  for (int v = 0; v < header.num_vertices; ++v) {
+    vertices.emplace_back(Vector3d(
+        positions[3 * v], positions[3 * v + 1], positions[3 * v + 2]));
+  }
+  std::vector<SurfaceFace> faces;
+  faces.reserve(header.num_faces);
+  for (int f = 0; f < header.num_faces; ++f) {
+    const int32_t* const face = face_indices.data() + 3 * f;
+    for (int i = 0; i < 3; ++i) {
+      if (face[i] < 0 || face[i] >= header.num_vertices) return std::nullopt;
+    }
+    const int v[3] = {face[0], face[1], face[2]};
+    faces.emplace_back(v);
+  }
+
+  unique_ptr<Node> root = ParseNodeRecords(node_records, header.num_faces);
+  if (root == nullptr) return std::nullopt;
+
+  ObjSurfaceMeshWithBvh result;
+  result.mesh = make_unique<SurfaceMesh<double>>(std::move(faces),
+                                                 std::move(vertices));
+  result.bvh = make_unique<Bvh<SurfaceMesh<double>>>(std::move(root));
+  return result;
+}
+
+// Writes `result` as the entry at `path`; see ReadObjToSurfaceMeshWithBvh()
+// for the handling of concurrent writers and of failures.
+void WriteEntry(const std::string& path, uint64_t key, uint64_t content_size,
+                double scale, const ObjSurfaceMeshWithBvh& result) {
+  const SurfaceMesh<double>& mesh = *result.mesh;
+  std::vector<NodeRecord> node_records;
+  AppendNodeRecords(result.bvh->root_node(), &node_records);
+
+  EntryHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.num_vertices = mesh.num_vertices();
+  header.key = key;
+  header.content_size = content_size;
+  header.scale = scale;
+  header.num_faces = mesh.num_faces();
+  header.num_nodes = static_cast<int32_t>(node_records.size());
+
+  std::vector<double> positions;
+  positions.reserve(3 * mesh.num_vertices());
+  for (const SurfaceVertex<double>& vertex : mesh.vertices()) {
+    const Vector3d& r_MV = vertex.r_MV();
+    positions.insert(positions.end(), r_MV.data(), r_MV.data() + 3);
+  }
+  std::vector<int32_t> face_indices(CalcFaceBytes(mesh.num_faces()) /
+                                    sizeof(int32_t), 0);
+  for (int f = 0; f < mesh.num_faces(); ++f) {
+    for (int i = 0; i < 3; ++i) {
+      face_indices[3 * f + i] = mesh.element(SurfaceFaceIndex(f)).vertex(i);
+    }
+  }
+
+  // The temporary file gets a unique name, so that concurrent writers (in
+  // this or other processes) never write to the same file.
+  std::string temp_path = path + ".XXXXXX";
+  const int fd = ::mkstemp(temp_path.data());
+  if (fd < 0) {
+    drake::log()->warn("Unable to write the mesh cache entry '{}'", path);
+    return;
+  }
+  // mkstemp() creates the file readable by its owner only; entries are meant
+  // to be shared.
+  bool written = ::fchmod(fd, 0644) == 0 &&
+                 WriteAll(fd, &header, sizeof(header)) &&
+                 WriteAll(fd, positions.data(),
+                          sizeof(double) * positions.size()) &&
+                 WriteAll(fd, face_indices.data(),
+                          sizeof(int32_t) * face_indices.size()) &&
+                 WriteAll(fd, node_records.data(),
+                          sizeof(NodeRecord) * node_records.size());
+  written = (::close(fd) == 0) && written;
+  if (!written || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    drake::log()->warn("Unable to write the mesh cache entry '{}'", path);
+    std::remove(temp_path.c_str());
+  }
+}
+
+}  // namespace
+
+std::optional<std::string> GetMeshCacheDirectory() {
+  const char* const value = std::getenv("DRAKE_MESH_CACHE_DIR");
+  if (value == nullptr || value[0] == '\0') return std::nullopt;
+  return std::string(value);
+}
+
+ObjSurfaceMeshWithBvh ReadObjToSurfaceMeshWithBvh(
+    const std::string& filename, double scale,
+    const std::string& cache_directory) {
+  const std::string content = ReadFileContents(filename);
+  const uint64_t key = CalcKey(content, scale);
+  const std::string path =
+      fmt::format("{}/obj_{:016x}.bin", cache_directory, key);
+
+  std::optional<ObjSurfaceMeshWithBvh> cached =
+      LoadEntry(path, key, content.size(), scale);
+  if (cached.has_value()) {
+    drake::log()->debug("Loaded '{}' from the mesh cache entry '{}'",
+                        filename, path);
+    return std::move(*cached);
+  }
+
+  std::istringstream input(content);
+  ObjSurfaceMeshWithBvh result;
+  result.mesh = make_unique<SurfaceMesh<double>>(
+      ReadObjToSurfaceMesh(&input, scale));
+  result.bvh = make_unique<Bvh<SurfaceMesh<double>>>(*result.mesh);
+
+  std::error_code error;
+  filesystem::create_directories(cache_directory, error);
+  if (error) {
+    drake::log()->warn("Unable to create the mesh cache directory '{}': {}",
+                       cache_directory, error.message());
+    return result;
+  }
+  WriteEntry(path, key, content.size(), scale, result);
+  return result;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The surface mesh read from a Wavefront .obj file, together with the
+ bounding volume hierarchy built on it.  */
+struct ObjSurfaceMeshWithBvh {
+  std::unique_ptr<SurfaceMesh<double>> mesh;
+  std::unique_ptr<Bvh<SurfaceMesh<double>>> bvh;
+};
+
+/* Returns the directory named by the `DRAKE_MESH_CACHE_DIR` environment
+ variable, or nullopt if that variable is unset or empty.
+
+ When a directory is named, the rigid hydroelastic representations of Mesh and
+ Convex shapes (e.g., the collision geometries that multibody::Parser
+ registers from URDF and SDFormat files) are loaded through
+ ReadObjToSurfaceMeshWithBvh(), so that later processes skip parsing the .obj
+ files and building their hierarchies.  */
+std::optional<std::string> GetMeshCacheDirectory();
+
+/* Reads the Wavefront .obj file `filename` into a surface mesh whose vertex
+ positions are scaled by `scale` (see ReadObjToSurfaceMesh()) and builds its
+ Bvh, reusing the result of a previous call (possibly in another process)
+ stored in `cache_directory` when one is available.
+
+ Cache entries are keyed by a hash of the .obj file's *content* (not its name
+ or modification time) and `scale`, so an edited file simply maps to a new
+ entry. Each entry is a flat binary record of the mesh's vertices and faces
+ followed by the hierarchy's nodes in pre-order. Loading an entry reads it
+ with plain reads and rebuilds the mesh and hierarchy from it, which skips the
+ .obj parsing and the hierarchy construction but still copies the data. An
+ entry that is missing or that fails validation (e.g., it is truncated,
+ malformed, or was written by an incompatible version) is rewritten from a
+ fresh parse of the .obj file. New entries are written to a uniquely named
+ temporary file which is then renamed into place, so that concurrent threads
+ and processes can share `cache_directory`. Failures to create
+ `cache_directory` or to write an entry are logged but are otherwise
+ ignored.
+
+ @throws std::runtime_error if `filename` cannot be read or is not a valid
+         .obj file.  */
+ObjSurfaceMeshWithBvh ReadObjToSurfaceMeshWithBvh(
+    const std::string& filename, double scale,
+    const std::string& cache_directory);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
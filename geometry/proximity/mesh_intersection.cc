@@ -4,6 +4,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -43,6 +44,128 @@ namespace internal {
 //  outside another tetrahedron. Right now it will be considered inside both
 //  tetrahedrons.
 
+namespace {
+
+// The capacity of a FixedCapacityPolygon. Clipping a convex polygon by a half
+// space adds at most one vertex, so clipping a triangle by the four half spaces
+// of a tetrahedron produces at most 3 + 4 = 7 vertices. We round the capacity
+// up to 8 so that the vertex matrix maps evenly onto SIMD registers.
+constexpr int kMaxClippedPolygonSize = 8;
+
+// A polygon (as produced by clipping a triangle by a tetrahedron) stored in a
+// stack buffer. Vertex i is column i of `vertices`; the columns at and beyond
+// `size` carry no meaning but are always initialized, so that arithmetic on
+// the full (fixed-size) matrix is well defined and can be vectorized.
+struct FixedCapacityPolygon {
+  Eigen::Matrix<double, 3, kMaxClippedPolygonSize> vertices{
+      Eigen::Matrix<double, 3, kMaxClippedPolygonSize>::Zero()};
+  int size{0};
+};
+
+// The fixed-capacity counterpart to
+// SurfaceVolumeIntersector<double>::ClipPolygonByHalfSpace(). The half space
+// has outward unit normal `nhat_F` and boundary-plane displacement `d`, and
+// `distances(i)` is the signed distance of vertex i of `input_F` to it. The
+// output is identical to that of the std::vector-based implementation, except
+// that the distances are computed once per vertex instead of twice.
+void ClipFixedCapacityPolygonByHalfSpace(
+    const FixedCapacityPolygon& input_F, const Vector3<double>& nhat_F,
+    double d,
+    const Eigen::Matrix<double, 1, kMaxClippedPolygonSize>& distances,
+    FixedCapacityPolygon* output_F) {
+  DRAKE_ASSERT(output_F != nullptr);
+  output_F->size = 0;
+  const int size = input_F.size;
+  auto push_back = [output_F](const auto& p_FV) {
+    DRAKE_ASSERT(output_F->size < kMaxClippedPolygonSize);
+    output_F->vertices.col(output_F->size++) = p_FV;
+  };
+  // See SurfaceVolumeIntersector::CalcIntersection() for the justification.
+  auto calc_intersection = [&](int current, int previous) {
+    const double a = distances(current);
+    const double b = distances(previous);
+    DRAKE_ASSERT(a * b <= 0 && (a > 0 || b > 0));
+    const double wa = b / (b - a);
+    const double wb = 1.0 - wa;
+    const Vector3<double> intersection = wa * input_F.vertices.col(current) +
+                                         wb * input_F.vertices.col(previous);
+    DRAKE_DEMAND(std::abs(nhat_F.dot(intersection) - d) < 1e-14);
+    return intersection;
+  };
+  for (int i = 0, previous = size - 1; i < size; previous = i++) {
+    const bool current_contained = distances(i) <= 0;
+    const bool previous_contained = distances(previous) <= 0;
+    if (current_contained) {
+      if (!previous_contained) push_back(calc_intersection(i, previous));
+      push_back(input_F.vertices.col(i));
+    } else if (previous_contained) {
+      push_back(calc_intersection(i, previous));
+    }
+  }
+}
+
+// Clips the triangle with vertices `p_MTs` by the tetrahedron with vertices
+// `p_MVs` (in the vertex order documented in ClipTriangleByTetrahedron()),
+// writing the (possibly empty) clipped polygon to `polygon_M`. The polygon may
+// contain duplicate vertices, exactly as the sequence of four
+// ClipPolygonByHalfSpace() calls would produce.
+//
+// The four half spaces are stacked into a 4x3 matrix so that the triangle's
+// vertices are classified against all of them in one product. That lets us
+// reject a triangle that lies entirely outside any face of the tetrahedron
+// before doing any clipping, and skip the faces that the triangle lies
+// entirely inside of. Each remaining clip classifies all of the current
+// polygon's vertices in one fixed-size product.
+void ClipTriangleByTetrahedronFixedCapacity(const Vector3<double> p_MVs[4],
+                                            const Vector3<double> p_MTs[3],
+                                            FixedCapacityPolygon* polygon_M) {
+  DRAKE_ASSERT(polygon_M != nullptr);
+  // See ClipTriangleByTetrahedron() for this encoding of the faces.
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+  Eigen::Matrix<double, 4, 3> nhats_M;
+  Eigen::Vector4d displacements;
+  for (int f = 0; f < 4; ++f) {
+    const Vector3<double>& p_MA = p_MVs[faces[f][0]];
+    const Vector3<double>& p_MB = p_MVs[faces[f][1]];
+    const Vector3<double>& p_MC = p_MVs[faces[f][2]];
+    // We'll allow the PosedHalfSpace to normalize (and validate) our vector.
+    const PosedHalfSpace<double> half_space_M((p_MB - p_MA).cross(p_MC - p_MA),
+                                              p_MA);
+    nhats_M.row(f) = half_space_M.normal().transpose();
+    displacements(f) = half_space_M.normal().dot(p_MA);
+  }
+
+  FixedCapacityPolygon buffers[2];
+  FixedCapacityPolygon* in_M = &buffers[0];
+  FixedCapacityPolygon* out_M = &buffers[1];
+  for (int i = 0; i < 3; ++i) in_M->vertices.col(i) = p_MTs[i];
+  in_M->size = 3;
+
+  polygon_M->size = 0;
+  const Eigen::Matrix<double, 4, 3> triangle_distances =
+      (nhats_M * in_M->vertices.leftCols<3>()).colwise() - displacements;
+  if (((triangle_distances.array() > 0).rowwise().all()).any()) {
+    // The triangle lies strictly outside one of the half spaces.
+    return;
+  }
+
+  for (int f = 0; f < 4; ++f) {
+    const Eigen::Matrix<double, 1, kMaxClippedPolygonSize> distances =
+        (nhats_M.row(f) * in_M->vertices).array() - displacements(f);
+    if ((distances.head(in_M->size).array() <= 0).all()) {
+      // Clipping by this half space would reproduce the input polygon.
+      continue;
+    }
+    ClipFixedCapacityPolygonByHalfSpace(*in_M, nhats_M.row(f).transpose(),
+                                        displacements(f), distances, out_M);
+    std::swap(in_M, out_M);
+    if (in_M->size == 0) return;
+  }
+  *polygon_M = *in_M;
+}
+
+}  // namespace
+
 // TODO(DamrongGuoy): Handle the case that the line is parallel to the plane.
 template <typename T>
 Vector3<T> SurfaceVolumeIntersector<T>::CalcIntersection(
@@ -200,6 +323,22 @@ SurfaceVolumeIntersector<T>::ClipTriangleByTetrahedron(
     VolumeVertexIndex v = volume_M.element(element).vertex(i);
     p_MVs[i] = volume_M.vertex(v).r_MV();
   }
+
+  if constexpr (std::is_same_v<T, double>) {
+    if (use_vectorized_clipping_) {
+      const Vector3<double> p_MTs[3] = {(*polygon_M)[0], (*polygon_M)[1],
+                                        (*polygon_M)[2]};
+      FixedCapacityPolygon clipped_M;
+      ClipTriangleByTetrahedronFixedCapacity(p_MVs, p_MTs, &clipped_M);
+      // polygon_M has reserved enough capacity; this does not allocate.
+      polygon_M->clear();
+      for (int i = 0; i < clipped_M.size; ++i) {
+        polygon_M->push_back(clipped_M.vertices.col(i));
+      }
+      return FinalizeClippedPolygon(polygon_M);
+    }
+  }
+
   // Sets up the four half spaces associated with the four triangular faces of
   // the tetrahedron. Assume the tetrahedron has the fourth vertex seeing the
   // first three vertices in CCW order; for example, a tetrahedron of (Zero(),
@@ -241,7 +380,14 @@ SurfaceVolumeIntersector<T>::ClipTriangleByTetrahedron(
     std::swap(in_M, out_M);
   }
   polygon_M = in_M;
+  return FinalizeClippedPolygon(polygon_M);
+}
 
+template <typename T>
+const std::vector<Vector3<T>>&
+SurfaceVolumeIntersector<T>::FinalizeClippedPolygon(
+    std::vector<Vector3<T>>* polygon_M) {
+  DRAKE_ASSERT(polygon_M != nullptr);
   // TODO(DamrongGuoy): Remove the code below when ClipPolygonByHalfSpace()
   //  stops generating duplicate vertices. See the note in
   //  ClipPolygonByHalfSpace().
@@ -31,7 +31,17 @@ template <typename T> class SurfaceVolumeIntersectorTester;
 template <typename T>
 class SurfaceVolumeIntersector {
  public:
-  SurfaceVolumeIntersector() {
+  /* Constructs the intersector.
+   @param use_vectorized_clipping
+       Only meaningful for T = double. If true (the default), triangles are
+       clipped by tetrahedra with a kernel that keeps the intermediate polygons
+       in fixed-capacity stack buffers and classifies all of a polygon's
+       vertices against a half space in a single vectorized product. If false,
+       the general algorithm used for all other scalar types is used instead.
+       The two produce equivalent polygons (up to rounding); the option exists
+       for testing and benchmarking.  */
+  explicit SurfaceVolumeIntersector(bool use_vectorized_clipping = true)
+      : use_vectorized_clipping_(use_vectorized_clipping) {
     // We know that each contact polygon has at most 7 vertices.
     // Each surface triangle is clipped by four half-spaces of the four
     // triangular faces of a tetrahedron.
@@ -208,6 +218,12 @@ class SurfaceVolumeIntersector {
       SurfaceFaceIndex face, const SurfaceMesh<T>& surface_N,
       const math::RigidTransform<T>& X_MN);
 
+  /* The common tail of ClipTriangleByTetrahedron(): removes the duplicate
+   vertices from the clipped `polygon_M` and empties it if what remains has no
+   area. Returns `*polygon_M`.  */
+  static const std::vector<Vector3<T>>& FinalizeClippedPolygon(
+      std::vector<Vector3<T>>* polygon_M);
+
   /* Determines whether a triangle of a rigid surface N and a tetrahedron of a
    soft volume M are suitable for building contact surface based on the face
    normal vector f_N of the triangle and the pressure gradient vector ∇p_M
@@ -302,6 +318,10 @@ class SurfaceVolumeIntersector {
   // not introduced.
   std::vector<Vector3<T>> polygon_[2];
 
+  // If true and T = double, ClipTriangleByTetrahedron() uses the vectorized
+  // clipping kernel. See the constructor.
+  bool use_vectorized_clipping_{true};
+
   friend class SurfaceVolumeIntersectorTester<T>;
 };
 
@@ -51,6 +51,19 @@ class Obb {
     PadBoundary();
   }
 
+  /* Constructs an oriented bounding box with exactly the given pose and half
+   widths, i.e., without the padding that the constructor applies. This is
+   intended for restoring a box that was constructed earlier (e.g., one
+   read from the on-disk mesh cache), whose half_width() already includes its
+   padding.
+   @pre half_width.x(), half_width.y(), half_width.z() are not negative.  */
+  static Obb MakeUnpadded(const math::RigidTransformd& X_HB,
+                          const Vector3<double>& half_width) {
+    Obb result(X_HB, half_width);
+    result.half_width_ = half_width;
+    return result;
+  }
+
   /* Returns the center of the box -- equivalent to the position vector from
    the hierarchy frame's origin Ho to `this` box's origin Bo: `p_HoBo_H`. */
   const Vector3<double>& center() const { return pose_.translation(); }
@@ -560,6 +560,143 @@ GTEST_TEST(BoundingVolumeHierarchyTest, TestEqual) {
   EXPECT_TRUE(bvh_ellipsoid.Equal(bvh_ellipsoid));
 }
 
+// Returns a copy of `mesh` with the same elements and each vertex moved by
+// `deformation`.
+VolumeMesh<double> DeformMesh(
+    const VolumeMesh<double>& mesh,
+    const std::function<Vector3d(const Vector3d&)>& deformation) {
+  std::vector<VolumeElement> elements = mesh.tetrahedra();
+  std::vector<VolumeVertex<double>> vertices;
+  for (const VolumeVertex<double>& vertex : mesh.vertices()) {
+    vertices.emplace_back(deformation(vertex.r_MV()));
+  }
+  return VolumeMesh<double>(std::move(elements), std::move(vertices));
+}
+
+// Returns true iff every node in the tree rooted at `node` has a bounding
+// volume that contains all the vertices of the elements in its subtree. The
+// element indices in the subtree are appended to `elements`.
+bool BoundsSubtree(const BvNode<VolumeMesh<double>>& node,
+                   const VolumeMesh<double>& mesh,
+                   std::vector<VolumeElementIndex>* elements) {
+  const int first = elements->size();
+  if (node.is_leaf()) {
+    for (int i = 0; i < node.num_element_indices(); ++i) {
+      elements->push_back(node.element_index(i));
+    }
+  } else {
+    if (!BoundsSubtree(node.left(), mesh, elements) ||
+        !BoundsSubtree(node.right(), mesh, elements)) {
+      return false;
+    }
+  }
+  const RigidTransformd X_BM = node.bv().pose().inverse();
+  for (auto it = elements->begin() + first; it != elements->end(); ++it) {
+    for (int v = 0; v < 4; ++v) {
+      const Vector3d p_BV =
+          X_BM * mesh.vertex(mesh.element(*it).vertex(v)).r_MV();
+      if ((p_BV.cwiseAbs().array() > node.bv().half_width().array()).any()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+class BvhRefitTest : public ::testing::Test {
+ public:
+  BvhRefitTest()
+      : ::testing::Test(),
+        mesh_(MakeEllipsoidVolumeMesh<double>(
+            Ellipsoid(1., 2., 3.), 1.0,
+            TessellationStrategy::kDenseInteriorVertices)),
+        bvh_(mesh_) {}
+
+ protected:
+  VolumeMesh<double> mesh_;
+  Bvh<VolumeMesh<double>> bvh_;
+};
+
+// Rigidly translating all vertices translates every box and nothing else.
+TEST_F(BvhRefitTest, Translation) {
+  const Vector3d offset(1., -2., 3.);
+  const VolumeMesh<double> moved =
+      DeformMesh(mesh_, [&offset](const Vector3d& p) { return p + offset; });
+  Bvh<VolumeMesh<double>> refitted(bvh_);
+  refitted.Refit(moved);
+
+  std::function<void(const BvNode<VolumeMesh<double>>&,
+                     const BvNode<VolumeMesh<double>>&)>
+      check_node;
+  check_node = [&](const BvNode<VolumeMesh<double>>& original,
+                   const BvNode<VolumeMesh<double>>& refit) {
+    EXPECT_TRUE(CompareMatrices(refit.bv().pose().rotation().matrix(),
+                                original.bv().pose().rotation().matrix()));
+    EXPECT_TRUE(CompareMatrices(refit.bv().center(),
+                                original.bv().center() + offset, 1e-12));
+    // With the orientation fixed, refitting bounds the contents tightly, so
+    // boxes can only shrink.
+    EXPECT_TRUE(
+        (refit.bv().half_width().array() <=
+         original.bv().half_width().array() + 1e-12).all());
+    ASSERT_EQ(refit.is_leaf(), original.is_leaf());
+    if (original.is_leaf()) {
+      EXPECT_TRUE(refit.EqualLeaf(original));
+    } else {
+      check_node(original.left(), refit.left());
+      check_node(original.right(), refit.right());
+    }
+  };
+  check_node(bvh_.root_node(), refitted.root_node());
+}
+
+// After an arbitrary smooth deformation the refitted boxes still bound their
+// contents and the tree structure is unchanged.
+TEST_F(BvhRefitTest, Deformation) {
+  const VolumeMesh<double> twisted =
+      DeformMesh(mesh_, [](const Vector3d& p) {
+        const double theta = 0.3 * p.z();
+        const double c = std::cos(theta);
+        const double s = std::sin(theta);
+        return Vector3d(1.5 * (c * p.x() - s * p.y()), s * p.x() + c * p.y(),
+                        0.8 * p.z() + 0.1 * p.x() * p.x());
+      });
+  // The original boxes no longer bound the deformed mesh.
+  std::vector<VolumeElementIndex> elements;
+  EXPECT_FALSE(BoundsSubtree(bvh_.root_node(), twisted, &elements));
+
+  Bvh<VolumeMesh<double>> refitted(bvh_);
+  refitted.Refit(twisted);
+  elements.clear();
+  EXPECT_TRUE(BoundsSubtree(refitted.root_node(), twisted, &elements));
+  EXPECT_EQ(elements.size(), twisted.num_elements());
+  EXPECT_EQ(CountAllNodes(refitted.root_node()),
+            CountAllNodes(bvh_.root_node()));
+
+  // The deformation is mild, so no rebuild is needed.
+  Bvh<VolumeMesh<double>> maybe_rebuilt(bvh_);
+  EXPECT_FALSE(maybe_rebuilt.RefitOrRebuild(twisted));
+  EXPECT_TRUE(maybe_rebuilt.Equal(refitted));
+}
+
+// Scrambling the vertices makes sibling boxes overlap heavily, which triggers
+// a rebuild.
+TEST_F(BvhRefitTest, RebuildWhenDegraded) {
+  // Map each vertex to the position of its "mirror" vertex in the reversed
+  // ordering, so that elements are stretched across the whole mesh.
+  std::vector<VolumeVertex<double>> vertices(mesh_.vertices().rbegin(),
+                                             mesh_.vertices().rend());
+  std::vector<VolumeElement> elements = mesh_.tetrahedra();
+  const VolumeMesh<double> scrambled(std::move(elements), std::move(vertices));
+
+  Bvh<VolumeMesh<double>> bvh(bvh_);
+  EXPECT_TRUE(bvh.RefitOrRebuild(scrambled));
+  EXPECT_TRUE(bvh.Equal(Bvh<VolumeMesh<double>>(scrambled)));
+
+  // A second call with the same mesh doesn't rebuild again.
+  EXPECT_FALSE(bvh.RefitOrRebuild(scrambled));
+}
+
 // Simply confirms that an Obb can be built from an autodiff mesh. We apply a
 // limited smoke test to indicate success -- the bounding volume of the root
 // node is the same as if the mesh were double-valued.
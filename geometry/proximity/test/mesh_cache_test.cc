@@ -0,0 +1,195 @@
+#include "drake/geometry/proximity/mesh_cache.h"
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+class MeshCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Each test gets its own (initially missing) cache directory, since the
+    // tests of this program share one temporary directory.
+    cache_directory_ =
+        temp_directory() + "/mesh_cache_" +
+        ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  }
+
+  // Returns the number of entries in the cache directory.
+  int CountEntries() const {
+    int count = 0;
+    for (const auto& entry :
+         filesystem::directory_iterator(cache_directory_)) {
+      if (entry.path().extension() == ".bin") ++count;
+    }
+    return count;
+  }
+
+  // Returns the path of the only entry in the cache directory.
+  std::string OnlyEntry() const {
+    EXPECT_EQ(CountEntries(), 1);
+    return filesystem::directory_iterator(cache_directory_)->path().string();
+  }
+
+  // Returns the inode of `path`; an entry that gets rewritten (by renaming a
+  // new file into place) gets a new inode.
+  static ino_t GetInode(const std::string& path) {
+    struct stat info;
+    EXPECT_EQ(::stat(path.c_str(), &info), 0);
+    return info.st_ino;
+  }
+
+  // Expects `result` to match parsing `filename` and building its Bvh from
+  // scratch.
+  static void ExpectMatchesFreshParse(const ObjSurfaceMeshWithBvh& result,
+                                      const std::string& filename,
+                                      double scale) {
+    ASSERT_NE(result.mesh, nullptr);
+    ASSERT_NE(result.bvh, nullptr);
+    const SurfaceMesh<double> expected_mesh =
+        ReadObjToSurfaceMesh(filename, scale);
+    EXPECT_TRUE(result.mesh->Equal(expected_mesh));
+    EXPECT_TRUE(result.bvh->Equal(Bvh<SurfaceMesh<double>>(expected_mesh)));
+  }
+
+  const std::string obj_file_{
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj")};
+  std::string cache_directory_;
+};
+
+// The first read writes an entry; later reads of the same content (even under
+// another file name) load that entry instead of writing a new one.
+TEST_F(MeshCacheTest, ColdThenWarm) {
+  const double scale = 2.0;
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(obj_file_, scale, cache_directory_),
+      obj_file_, scale);
+  const std::string entry = OnlyEntry();
+  const ino_t inode = GetInode(entry);
+
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(obj_file_, scale, cache_directory_),
+      obj_file_, scale);
+  EXPECT_EQ(GetInode(entry), inode);
+
+  const std::string copy = temp_directory() + "/copy.obj";
+  filesystem::copy_file(obj_file_, copy);
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(copy, scale, cache_directory_), copy, scale);
+  EXPECT_EQ(OnlyEntry(), entry);
+  EXPECT_EQ(GetInode(entry), inode);
+}
+
+// Entries are keyed on the scale and on the file's content.
+TEST_F(MeshCacheTest, KeyedOnScaleAndContent) {
+  ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_);
+  ReadObjToSurfaceMeshWithBvh(obj_file_, 2.0, cache_directory_);
+  EXPECT_EQ(CountEntries(), 2);
+
+  const std::string edited = temp_directory() + "/edited.obj";
+  filesystem::copy_file(obj_file_, edited);
+  std::ofstream(edited, std::ios::app) << "# An edit.\n";
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(edited, 1.0, cache_directory_), edited,
+      1.0);
+  EXPECT_EQ(CountEntries(), 3);
+}
+
+// A corrupt entry is ignored and rewritten.
+TEST_F(MeshCacheTest, CorruptEntryIsRewritten) {
+  ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_);
+  const std::string entry = OnlyEntry();
+  const auto size = filesystem::file_size(entry);
+  filesystem::resize_file(entry, size / 2);
+
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_),
+      obj_file_, 1.0);
+  EXPECT_EQ(filesystem::file_size(entry), size);
+
+  // The rewritten entry is then used as is.
+  const ino_t inode = GetInode(entry);
+  ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_);
+  EXPECT_EQ(GetInode(entry), inode);
+}
+
+// An entry whose hierarchy records are malformed is ignored and rewritten.
+TEST_F(MeshCacheTest, MalformedHierarchyIsRewritten) {
+  ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_);
+  const std::string entry = OnlyEntry();
+  const ino_t inode = GetInode(entry);
+
+  // Turn the last node record (a leaf, in pre-order) into a branch, which then
+  // lacks the subtrees that should follow it. This relies on the layout of
+  // NodeRecord in mesh_cache.cc: 15 doubles, followed by the int32 number of
+  // indices and the int32 indices, padded to a multiple of 8 bytes.
+  constexpr int kNumIndexOffset = 15 * sizeof(double);
+  constexpr int kRecordSize =
+      (kNumIndexOffset +
+       sizeof(int32_t) * (1 + BvNode<SurfaceMesh<double>>::kMaxElementPerLeaf) +
+       7) / 8 * 8;
+  const int32_t branch = -1;
+  {
+    std::fstream file(entry, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(filesystem::file_size(entry) - kRecordSize + kNumIndexOffset);
+    file.write(reinterpret_cast<const char*>(&branch), sizeof(branch));
+    ASSERT_TRUE(file.good());
+  }
+
+  ExpectMatchesFreshParse(
+      ReadObjToSurfaceMeshWithBvh(obj_file_, 1.0, cache_directory_),
+      obj_file_, 1.0);
+  EXPECT_NE(GetInode(entry), inode);
+}
+
+// Threads that miss the cache at the same time write their entries through
+// distinct temporary files, so that every result is valid and exactly one
+// file (the entry) is left behind.
+TEST_F(MeshCacheTest, ConcurrentWriters) {
+  const double scale = 1.5;
+  std::vector<ObjSurfaceMeshWithBvh> results(8);
+  std::vector<std::thread> threads;
+  for (ObjSurfaceMeshWithBvh& result : results) {
+    threads.emplace_back([this, &result, scale]() {
+      result = ReadObjToSurfaceMeshWithBvh(obj_file_, scale, cache_directory_);
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  for (const ObjSurfaceMeshWithBvh& result : results) {
+    ExpectMatchesFreshParse(result, obj_file_, scale);
+  }
+  int num_files = 0;
+  for (const auto& file : filesystem::directory_iterator(cache_directory_)) {
+    EXPECT_EQ(file.path().extension(), ".bin");
+    ++num_files;
+  }
+  EXPECT_EQ(num_files, 1);
+}
+
+TEST_F(MeshCacheTest, MissingFile) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ReadObjToSurfaceMeshWithBvh("no_such_file.obj", 1.0, cache_directory_),
+      std::runtime_error, "Cannot open file 'no_such_file.obj'");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
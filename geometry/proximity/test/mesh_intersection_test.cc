@@ -22,6 +22,9 @@ namespace internal {
 template<typename T>
 class SurfaceVolumeIntersectorTester {
  public:
+  explicit SurfaceVolumeIntersectorTester(bool use_vectorized_clipping = true)
+      : intersect_(use_vectorized_clipping) {}
+
   Vector3<T> CalcIntersection(const Vector3<T>& p_FA, const Vector3<T>& p_FB,
                               const PosedHalfSpace<T>& H_F) {
     return intersect_.CalcIntersection(p_FA, p_FB, H_F);
@@ -706,6 +709,84 @@ GTEST_TEST(MeshIntersectionTest, ClipTriangleByTetrahedronIntoHeptagon) {
   EXPECT_TRUE(CompareConvexPolygon(expect_heptagon_M, polygon_M));
 }
 
+// Confirms that the vectorized, fixed-capacity clipping kernel (the default
+// for double) and the general, std::vector-based kernel produce the same
+// polygons. We reuse the heptagon configuration above and sweep the triangle
+// through a range of poses to cover the empty, triangle, quad, ..., heptagon
+// cases, as well as the early-out and no-op paths of the vectorized kernel.
+GTEST_TEST(MeshIntersectionTest, ClipTriangleByTetrahedronVectorized) {
+  unique_ptr<VolumeMesh<double>> volume_M;
+  {
+    const int element_data[4] = {0, 1, 2, 3};
+    std::vector<VolumeElement> elements{VolumeElement(element_data)};
+    // clang-format off
+    const Vector3d vertex_data[4] = {
+        { 2,  0,  2},
+        {-2,  0,  2},
+        { 0,  2, -2},
+        { 0, -2, -2}
+    };
+    // clang-format on
+    std::vector<VolumeVertex<double>> vertices;
+    for (auto& vertex : vertex_data) {
+      vertices.emplace_back(vertex);
+    }
+    volume_M = std::make_unique<VolumeMesh<double>>(std::move(elements),
+                                                    std::move(vertices));
+  }
+  unique_ptr<SurfaceMesh<double>> surface_N;
+  {
+    const int face_data[3] = {0, 1, 2};
+    std::vector<SurfaceFace> faces{SurfaceFace(face_data)};
+    // clang-format off
+    const Vector3d vertex_data[3] = {
+        {1.5,   1.5, 0.},
+        {-1.5,  0.,  0.},
+        {0.,   -1.5, 0.}};
+    // clang-format on
+    std::vector<SurfaceVertex<double>> vertices;
+    for (auto& vertex : vertex_data) {
+      vertices.emplace_back(vertex);
+    }
+    surface_N = std::make_unique<SurfaceMesh<double>>(std::move(faces),
+                                                      std::move(vertices));
+  }
+  const VolumeElementIndex tetrahedron(0);
+  const SurfaceFaceIndex triangle(0);
+
+  SurfaceVolumeIntersectorTester<double> vectorized(true);
+  SurfaceVolumeIntersectorTester<double> general(false);
+  std::vector<int> size_counts(8, 0);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      for (double z : {-2.5, -1.0, 0.0, 0.7, 1.9}) {
+        const RigidTransformd X_MN(RollPitchYawd(0.3 * i, 0.5 * j, 0.2 * i * j),
+                                   Vector3d(0.1 * i, -0.1 * j, z));
+        const std::vector<Vector3d> expected_M =
+            general.ClipTriangleByTetrahedron(tetrahedron, *volume_M, triangle,
+                                              *surface_N, X_MN);
+        const std::vector<Vector3d> polygon_M =
+            vectorized.ClipTriangleByTetrahedron(tetrahedron, *volume_M,
+                                                 triangle, *surface_N, X_MN);
+        EXPECT_TRUE(CompareConvexPolygon(expected_M, polygon_M));
+        ++size_counts[expected_M.size()];
+      }
+    }
+  }
+  // Confirm that the sweep covered both empty and non-trivial polygons.
+  EXPECT_GT(size_counts[0], 0);
+  EXPECT_GT(size_counts[3] + size_counts[4], 0);
+  EXPECT_GT(size_counts[5] + size_counts[6] + size_counts[7], 0);
+
+  // The heptagon itself.
+  const auto X_MN = RigidTransformd::Identity();
+  EXPECT_TRUE(CompareConvexPolygon(
+      general.ClipTriangleByTetrahedron(tetrahedron, *volume_M, triangle,
+                                        *surface_N, X_MN),
+      vectorized.ClipTriangleByTetrahedron(tetrahedron, *volume_M, triangle,
+                                           *surface_N, X_MN)));
+}
+
 GTEST_TEST(MeshIntersectionTest, IsFaceNormalAlongPressureGradient) {
   // It is ok to use the trivial mesh and trivial mesh field in this test.
   // The function under test asks for the gradient values and operates on it.
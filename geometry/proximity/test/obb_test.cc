@@ -1235,6 +1235,15 @@ GTEST_TEST(ObbTest, TestEqual) {
   EXPECT_TRUE(a.Equal(d));
 }
 
+// Restoring a box from its (already padded) pose and half widths reproduces
+// it exactly.
+GTEST_TEST(ObbTest, MakeUnpadded) {
+  const Obb a{RigidTransformd(Vector3d{0.5, 0.25, -0.75}), Vector3d{1, 2, 3}};
+  const Obb b = Obb::MakeUnpadded(a.pose(), a.half_width());
+  EXPECT_TRUE(a.Equal(b));
+  EXPECT_EQ(b.half_width(), a.half_width());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -15,6 +15,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/proximity/collision_filter_legacy.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
@@ -356,6 +357,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
     collision_filter_ = other.collision_filter_;
+    contact_surface_parallelism_ = other.contact_surface_parallelism_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -379,6 +381,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                           &object_map);
 
     engine->collision_filter_ = this->collision_filter_;
+    engine->contact_surface_parallelism_ = this->contact_surface_parallelism_;
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
@@ -451,6 +454,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_contact_surface_parallelism(int num_parallel_executions) {
+    DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                       num_parallel_executions == kUseHardwareConcurrency);
+    contact_surface_parallelism_ = num_parallel_executions;
+  }
+
+  int contact_surface_parallelism() const {
+    return contact_surface_parallelism_;
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -655,9 +668,20 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return distances;
   }
 
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const {
-    std::vector<PenetrationAsPointPair<double>> contacts;
-    penetration_as_point_pair::CallbackData data{&collision_filter_, &contacts};
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* pairs) const {
+    DRAKE_DEMAND(pairs != nullptr);
+    pairs->clear();
+    // For T = double, the results are written directly into `pairs`, reusing
+    // its storage; otherwise, they are collected in a double-valued scratch.
+    std::vector<PenetrationAsPointPair<double>> scratch;
+    std::vector<PenetrationAsPointPair<double>>* contacts{};
+    if constexpr (std::is_same<T, double>::value) {
+      contacts = pairs;
+    } else {
+      contacts = &scratch;
+    }
+    penetration_as_point_pair::CallbackData data{&collision_filter_, contacts};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, penetration_as_point_pair::Callback);
@@ -667,16 +691,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                penetration_as_point_pair::Callback);
 
-    std::sort(contacts.begin(), contacts.end(), OrderPointPair<double>);
+    std::sort(contacts->begin(), contacts->end(), OrderPointPair<double>);
 
-    if constexpr (std::is_same<T, double>::value) {
-      return contacts;
-    } else {
+    if constexpr (!std::is_same<T, double>::value) {
       // TODO(hongkai.dai): for T != double, compute the contacts for allowable
       // primitives (sphere-to-sphere, sphere-to-box, etc).
-      if (contacts.size() == 0) {
-        return std::vector<PenetrationAsPointPair<T>>();
-      } else {
+      if (contacts->size() != 0) {
         throw std::runtime_error(
             "ComputePointPairPenetration(): Some of the bodies in the model "
             "are in contact. Currently we only support computing penetration "
@@ -725,9 +745,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   vector<ContactSurface<T>> ComputeContactSurfaces(
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     vector<ContactSurface<T>> surfaces;
+    vector<std::pair<GeometryId, GeometryId>> deferred_pairs;
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
-                                       &hydroelastic_geometries_, &surfaces};
+                                       &hydroelastic_geometries_, &surfaces,
+                                       &deferred_pairs};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
@@ -736,6 +758,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // anchored against anchored because those pairs are implicitly filtered.
     FclCollide(dynamic_tree_, anchored_tree_, &data, hydroelastic::Callback<T>);
 
+    CalcDeferredContactSurfaces(X_WGs, deferred_pairs, &surfaces);
+
     std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
 
     return surfaces;
@@ -749,10 +773,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DRAKE_DEMAND(point_pairs);
 
     std::vector<PenetrationAsPointPair<double>> point_pairs_double;
+    vector<std::pair<GeometryId, GeometryId>> deferred_pairs;
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackWithFallbackData<T> data{
         hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
-                                      &hydroelastic_geometries_, surfaces},
+                                      &hydroelastic_geometries_, surfaces,
+                                      &deferred_pairs},
         &point_pairs_double};
 
     // Dynamic vs dynamic and dynamic vs anchored represent all the geometries
@@ -762,6 +788,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                hydroelastic::CallbackWithFallback<T>);
 
+    CalcDeferredContactSurfaces(X_WGs, deferred_pairs, surfaces);
+
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
     std::sort(point_pairs_double.begin(), point_pairs_double.end(),
@@ -1006,6 +1034,32 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     reify_data.fcl_object = make_unique<CollisionObjectd>(shape);
   }
 
+  // Computes the contact surfaces for the geometry pairs deferred by the
+  // broad phase, distributing the pairs across up to
+  // contact_surface_parallelism_ threads. Each pair writes only to its own
+  // slot, and the non-empty results are appended to `surfaces` in pair order;
+  // the caller is responsible for putting `surfaces` into its canonical order.
+  void CalcDeferredContactSurfaces(
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const vector<std::pair<GeometryId, GeometryId>>& pairs,
+      vector<ContactSurface<T>>* surfaces) const {
+    DRAKE_DEMAND(surfaces != nullptr);
+    if (pairs.empty()) return;
+    const int num_pairs = static_cast<int>(pairs.size());
+    vector<unique_ptr<ContactSurface<T>>> results(num_pairs);
+    const int num_threads = drake::internal::SelectNumberOfThreads(
+        contact_surface_parallelism_, num_pairs);
+    drake::internal::ParallelFor(num_pairs, num_threads, [&](int, int i) {
+      results[i] = hydroelastic::CalcContactSurface<T>(
+          hydroelastic_geometries_, X_WGs, pairs[i].first, pairs[i].second);
+    });
+    for (auto& surface : results) {
+      if (surface != nullptr) {
+        surfaces->emplace_back(std::move(*surface));
+      }
+    }
+  }
+
   // The BVH of all dynamic geometries; this depends on *all* inputs.
   // TODO(SeanCurtis-TRI): Ultimately, this should probably be a cache entry.
   fcl::DynamicAABBTreeCollisionManager<double> dynamic_tree_;
@@ -1026,6 +1080,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The number of parallel executions used to compute contact surfaces.
+  // @see ProximityEngine::set_contact_surface_parallelism() for more details.
+  int contact_surface_parallelism_{kNoConcurrency};
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
@@ -1124,6 +1182,17 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_contact_surface_parallelism(
+    int num_parallel_executions) {
+  impl_->set_contact_surface_parallelism(num_parallel_executions);
+}
+
+template <typename T>
+int ProximityEngine<T>::contact_surface_parallelism() const {
+  return impl_->contact_surface_parallelism();
+}
+
 template <typename T>
 std::unique_ptr<ProximityEngine<AutoDiffXd>> ProximityEngine<T>::ToAutoDiffXd()
     const {
@@ -1171,7 +1240,15 @@ bool ProximityEngine<T>::HasCollisions() const {
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration() const {
-  return impl_->ComputePointPairPenetration();
+  std::vector<PenetrationAsPointPair<T>> pairs;
+  impl_->ComputePointPairPenetration(&pairs);
+  return pairs;
+}
+
+template <typename T>
+void ProximityEngine<T>::ComputePointPairPenetration(
+    std::vector<PenetrationAsPointPair<T>>* pairs) const {
+  impl_->ComputePointPairPenetration(pairs);
 }
 
 template <typename T>
@@ -153,6 +153,14 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Implementation of SceneGraph::set_contact_surface_parallelism().
+   @throws std::exception if `num_parallel_executions` is neither positive nor
+           kUseHardwareConcurrency.  */
+  void set_contact_surface_parallelism(int num_parallel_executions);
+
+  /* Implementation of SceneGraph::contact_surface_parallelism().  */
+  int contact_surface_parallelism() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -218,6 +226,11 @@ class ProximityEngine {
   /* Implementation of GeometryState::ComputePointPairPenetration().  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
 
+  /* Implementation of GeometryState::ComputePointPairPenetration() that
+   writes into `pairs`.  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* pairs) const;
+
   /* Implementation of GeometryState::ComputeContactSurfaces().
    This includes `X_WGs`, the current poses of all geometries in World in the
    current scalar type, keyed on each geometry's GeometryId.  */
@@ -113,6 +113,17 @@ QueryObject<T>::ComputePointPairPenetration() const {
   return state.ComputePointPairPenetration();
 }
 
+template <typename T>
+void QueryObject<T>::ComputePointPairPenetration(
+    std::vector<PenetrationAsPointPair<T>>* pairs) const {
+  DRAKE_DEMAND(pairs != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputePointPairPenetration(pairs);
+}
+
 template <typename T>
 std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
     const {
@@ -275,6 +286,16 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(
+    const std::vector<render::RenderImageRequest>& requests) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.RenderImages(requests);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
@@ -11,6 +11,7 @@
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/render/render_camera.h"
+#include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/scene_graph_inspector.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/context.h"
@@ -187,6 +188,17 @@ class QueryObject {
    @throws if T = AutoDiffXd and object actually collides. */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
 
+  /** Variant of ComputePointPairPenetration() that writes the penetrations
+   into `pairs` instead of returning a new vector. Any previous contents of
+   `pairs` are discarded, but its storage is reused; once `pairs` has grown to
+   accommodate the largest set of penetrations, repeated calls perform no heap
+   allocation to store the results. This is intended for callers (e.g.,
+   discrete-time simulations) that evaluate this query at a high rate.
+   @pre `pairs` is not null.
+   @throws if T = AutoDiffXd and object actually collides. */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* pairs) const;
+
   /**
    Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface for hydroelastic contact model.
@@ -586,6 +598,22 @@ class QueryObject {
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
 
+  /** Renders the images of any number of cameras, e.g., all of the cameras
+   of a robot, in a single call. The poses of the geometries are updated once
+   for all of the images, and each render engine receives the images of its
+   cameras all at once, so that it can share work among them (see
+   render::RenderEngine::RenderImages()). The color and label images of a
+   request are rendered by the engine named by its color camera, and its depth
+   image by the engine named by its depth camera.
+
+   @param requests  The cameras, posed in the world frame, and their output
+                    images.
+   @throws std::exception if a camera names a render engine that doesn't
+                          exist, or a request is invalid. */
+  void RenderImages(
+      const std::vector<render::RenderImageRequest>& requests) const;
+
+
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
   const render::RenderEngine* GetRenderEngineByName(
@@ -82,6 +82,35 @@ RenderLabel RenderEngine::GetRenderLabelOrThrow(
   return label;
 }
 
+void RenderEngine::RenderImages(
+    const std::vector<RenderImageRequest>& requests) {
+  for (const RenderImageRequest& request : requests) {
+    auto throw_if_no_camera = [](bool has_camera, const char* image_type) {
+      if (!has_camera) {
+        throw std::logic_error(fmt::format(
+            "Can't render a {} image. The request has no camera for it",
+            image_type));
+      }
+    };
+    if (request.color_image != nullptr) {
+      throw_if_no_camera(request.color_camera.has_value(), "color");
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.color_image, "color");
+    }
+    if (request.depth_image != nullptr) {
+      throw_if_no_camera(request.depth_camera.has_value(), "depth");
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image, "depth");
+    }
+    if (request.label_image != nullptr) {
+      throw_if_no_camera(request.color_camera.has_value(), "label");
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.label_image, "label");
+    }
+  }
+  DoRenderImages(requests);
+}
+
 void RenderEngine::DoRenderColorImage(const ColorRenderCamera& camera,
                                       ImageRgba8U* color_image_out) const {
   if (visited_color_) {
@@ -172,6 +201,22 @@ void RenderEngine::DoRenderLabelImage(const ColorRenderCamera& camera,
 #pragma GCC diagnostic pop
 }
 
+void RenderEngine::DoRenderImages(
+    const std::vector<RenderImageRequest>& requests) {
+  for (const RenderImageRequest& request : requests) {
+    UpdateViewpoint(request.X_WC);
+    if (request.color_image != nullptr) {
+      DoRenderColorImage(*request.color_camera, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      DoRenderDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      DoRenderLabelImage(*request.color_camera, request.label_image);
+    }
+  }
+}
+
 void RenderEngine::SetDefaultLightPosition(const Vector3<double>&) {}
 
 }  // namespace render
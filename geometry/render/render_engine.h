@@ -27,6 +27,21 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** The images of a single camera to be rendered by
+ RenderEngine::RenderImages(). Each of the output images is optional; a
+ `nullptr` image is simply not rendered. The color and label images are
+ rendered with `color_camera` and the depth image with `depth_camera`; a camera
+ is only required if one of its images is requested.  */
+struct RenderImageRequest {
+  /** The pose of the camera frame C in the world frame W.  */
+  math::RigidTransformd X_WC;
+  std::optional<ColorRenderCamera> color_camera;
+  std::optional<DepthRenderCamera> depth_camera;
+  systems::sensors::ImageRgba8U* color_image{};
+  systems::sensors::ImageDepth32F* depth_image{};
+  systems::sensors::ImageLabel16I* label_image{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -343,6 +358,21 @@ class RenderEngine : public ShapeReifier {
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** Renders the images of any number of cameras in a single call, e.g., the
+   color, depth, and label images of every camera of a robot. This is
+   equivalent to calling UpdateViewpoint() and then the Render*Image() methods
+   for each request in turn, but it allows the implementation to share the work
+   among all of the images (e.g., to render them in parallel, or to render the
+   color and label images of a camera in a single pass).
+
+   The viewpoint set by UpdateViewpoint() is unspecified after this call.
+
+   @param requests  The cameras and their output images.
+   @throws std::logic_error if a requested image's camera is missing or the size
+                            of the image doesn't match the size declared in its
+                            camera.  */
+  void RenderImages(const std::vector<RenderImageRequest>& requests);
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
@@ -432,6 +462,15 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for rendering the images of many cameras. When
+   RenderImages calls this, it has already confirmed that every requested image
+   has a camera and that its size is consistent with the camera intrinsics.
+
+   The default implementation renders the requests one at a time with
+   UpdateViewpoint() and the DoRender*Image() methods. Derived classes that can
+   share work among the images should override it.  */
+  virtual void DoRenderImages(const std::vector<RenderImageRequest>& requests);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -0,0 +1,590 @@
+#include "drake/geometry/render/render_engine_ray_cast.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "drake/common/unused.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/geometry/proximity/make_cylinder_mesh.h"
+#include "drake/geometry/proximity/make_ellipsoid_mesh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_cache.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+using Eigen::Vector3d;
+using internal::MakeBoxSurfaceMesh;
+using internal::MakeCylinderSurfaceMesh;
+using internal::MakeEllipsoidSurfaceMesh;
+using internal::MakeSphereSurfaceMesh;
+using math::RigidTransformd;
+using std::make_shared;
+using std::make_unique;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+
+namespace {
+
+using SurfaceBvh = internal::Bvh<SurfaceMesh<double>>;
+using SurfaceBvNode = internal::BvNode<SurfaceMesh<double>>;
+using internal::Obb;
+
+// A ray p(t) = origin + t * direction, measured and expressed in some frame.
+// The direction is not necessarily a unit vector.
+struct Ray {
+  Vector3d origin;
+  Vector3d direction;
+};
+
+// Clips the range [*t_min, *t_max] of the ray parameter to the part of the ray
+// inside the box (the "slab" test). `ray_H` is in the hierarchy frame H in
+// which the box is posed. Returns false if nothing is left of the range.
+bool ClipToObb(const Obb& box, const Ray& ray_H, double* t_min,
+               double* t_max) {
+  const Eigen::Matrix3d& R_HB = box.pose().rotation().matrix();
+  const Vector3d p_BoO_B =
+      R_HB.transpose() * (ray_H.origin - box.pose().translation());
+  const Vector3d d_B = R_HB.transpose() * ray_H.direction;
+  const Vector3d& half_width = box.half_width();
+  for (int i = 0; i < 3; ++i) {
+    if (d_B(i) == 0) {
+      if (std::abs(p_BoO_B(i)) > half_width(i)) return false;
+      continue;
+    }
+    const double inv_d = 1 / d_B(i);
+    double t0 = (-half_width(i) - p_BoO_B(i)) * inv_d;
+    double t1 = (half_width(i) - p_BoO_B(i)) * inv_d;
+    if (t0 > t1) std::swap(t0, t1);
+    *t_min = std::max(*t_min, t0);
+    *t_max = std::min(*t_max, t1);
+    if (*t_min > *t_max) return false;
+  }
+  return true;
+}
+
+// Returns the parameter of the intersection of the ray with the triangle
+// (p0, p1, p2), regardless of the triangle's winding, if it lies in
+// [t_min, t_max) (Möller–Trumbore).
+std::optional<double> IntersectTriangle(const Ray& ray, const Vector3d& p0,
+                                        const Vector3d& p1, const Vector3d& p2,
+                                        double t_min, double t_max) {
+  const Vector3d e1 = p1 - p0;
+  const Vector3d e2 = p2 - p0;
+  const Vector3d p = ray.direction.cross(e2);
+  const double det = e1.dot(p);
+  // The ray is parallel to the triangle.
+  if (det == 0) return std::nullopt;
+  const double inv_det = 1 / det;
+  const Vector3d s = ray.origin - p0;
+  const double b1 = s.dot(p) * inv_det;
+  if (b1 < 0 || b1 > 1) return std::nullopt;
+  const Vector3d q = s.cross(e1);
+  const double b2 = ray.direction.dot(q) * inv_det;
+  if (b2 < 0 || b1 + b2 > 1) return std::nullopt;
+  const double t = e2.dot(q) * inv_det;
+  if (t < t_min || t >= t_max) return std::nullopt;
+  return t;
+}
+
+// Finds the nearest intersection of the ray with the mesh whose parameter lies
+// in [t_min, *t_hit). On success, updates `t_hit` and `face` and returns true.
+// The children of a node are visited nearest first, and nodes that the ray
+// enters beyond the nearest intersection found so far are skipped.
+bool IntersectMesh(const SurfaceMesh<double>& mesh, const SurfaceBvh& bvh,
+                   const Ray& ray, double t_min, double* t_hit,
+                   SurfaceFaceIndex* face) {
+  double t_enter = t_min;
+  double t_exit = *t_hit;
+  if (!ClipToObb(bvh.root_node().bv(), ray, &t_enter, &t_exit)) return false;
+
+  // The nodes yet to be visited, and the parameters at which the ray enters
+  // them. The hierarchy is balanced, so its depth (and the size of this stack)
+  // is logarithmic in the number of faces.
+  std::array<std::pair<const SurfaceBvNode*, double>, 64> stack;
+  int stack_size = 0;
+  stack[stack_size++] = {&bvh.root_node(), t_enter};
+  bool found = false;
+  while (stack_size > 0) {
+    const auto [node, node_t_enter] = stack[--stack_size];
+    if (node_t_enter >= *t_hit) continue;
+    if (node->is_leaf()) {
+      for (int i = 0; i < node->num_element_indices(); ++i) {
+        const SurfaceFaceIndex f = node->element_index(i);
+        const SurfaceFace& triangle = mesh.element(f);
+        const std::optional<double> t = IntersectTriangle(
+            ray, mesh.vertex(triangle.vertex(0)).r_MV(),
+            mesh.vertex(triangle.vertex(1)).r_MV(),
+            mesh.vertex(triangle.vertex(2)).r_MV(), t_min, *t_hit);
+        if (t) {
+          *t_hit = *t;
+          *face = f;
+          found = true;
+        }
+      }
+      continue;
+    }
+    const std::array<const SurfaceBvNode*, 2> children{&node->left(),
+                                                        &node->right()};
+    std::array<double, 2> child_t_enter{t_min, t_min};
+    std::array<bool, 2> child_hit{};
+    for (int k = 0; k < 2; ++k) {
+      double child_t_exit = *t_hit;
+      child_hit[k] = ClipToObb(children[k]->bv(), ray, &child_t_enter[k],
+                               &child_t_exit);
+    }
+    // Push the farther child first so that the nearer one is visited first.
+    const int nearer = child_t_enter[1] < child_t_enter[0] ? 1 : 0;
+    for (int k : {1 - nearer, nearer}) {
+      if (child_hit[k]) {
+        DRAKE_ASSERT(stack_size < static_cast<int>(stack.size()));
+        stack[stack_size++] = {children[k], child_t_enter[k]};
+      }
+    }
+  }
+  return found;
+}
+
+// Returns the parameter of the intersection of the ray with the boundary
+// plane z = 0 of a half space (whose outward normal is +z), if it lies in
+// [t_min, t_max).
+std::optional<double> IntersectHalfSpace(const Ray& ray_G, double t_min,
+                                         double t_max) {
+  if (ray_G.direction.z() == 0) return std::nullopt;
+  const double t = -ray_G.origin.z() / ray_G.direction.z();
+  if (t < t_min || t >= t_max) return std::nullopt;
+  return t;
+}
+
+// A rectangle of pixels, [u_min, u_max] x [v_min, v_max].
+struct PixelBounds {
+  int u_min{};
+  int u_max{};
+  int v_min{};
+  int v_max{};
+
+  bool Contains(int u, int v) const {
+    return u_min <= u && u <= u_max && v_min <= v && v <= v_max;
+  }
+};
+
+// Returns the pixels whose rays may intersect the box, or nullopt if none do.
+// X_CH is the pose of the box's hierarchy frame H in the camera frame C. The
+// bounds are those of the projections of the box's corners, or the whole image
+// if the box extends behind the camera.
+std::optional<PixelBounds> ProjectObb(const Obb& box,
+                                      const RigidTransformd& X_CH,
+                                      const CameraInfo& intrinsics,
+                                      double near, double far) {
+  const RigidTransformd X_CB = X_CH * box.pose();
+  const Vector3d& half_width = box.half_width();
+  double z_min = std::numeric_limits<double>::infinity();
+  double z_max = -z_min;
+  double u_min = z_min, u_max = z_max, v_min = z_min, v_max = z_max;
+  for (int i = 0; i < 8; ++i) {
+    const Vector3d p_BQ((i & 1 ? 1 : -1) * half_width.x(),
+                        (i & 2 ? 1 : -1) * half_width.y(),
+                        (i & 4 ? 1 : -1) * half_width.z());
+    const Vector3d p_CQ = X_CB * p_BQ;
+    z_min = std::min(z_min, p_CQ.z());
+    z_max = std::max(z_max, p_CQ.z());
+    if (p_CQ.z() <= 0) continue;
+    const double u =
+        intrinsics.focal_x() * p_CQ.x() / p_CQ.z() + intrinsics.center_x();
+    const double v =
+        intrinsics.focal_y() * p_CQ.y() / p_CQ.z() + intrinsics.center_y();
+    u_min = std::min(u_min, u);
+    u_max = std::max(u_max, u);
+    v_min = std::min(v_min, v);
+    v_max = std::max(v_max, v);
+  }
+  const int width = intrinsics.width();
+  const int height = intrinsics.height();
+  if (z_max < near || z_min > far) return std::nullopt;
+  if (z_min <= 0) return PixelBounds{0, width - 1, 0, height - 1};
+  if (u_max < 0 || u_min > width - 1 || v_max < 0 || v_min > height - 1) {
+    return std::nullopt;
+  }
+  return PixelBounds{std::max(0, static_cast<int>(std::floor(u_min))),
+                     std::min(width - 1, static_cast<int>(std::ceil(u_max))),
+                     std::max(0, static_cast<int>(std::floor(v_min))),
+                     std::min(height - 1, static_cast<int>(std::ceil(v_max)))};
+}
+
+// Returns a triangle mesh of the capsule, whose axis is the z-axis of its
+// frame: rings of vertices of constant latitude on the two hemispherical caps,
+// joined at the ends of the cylindrical section, with triangles wound so that
+// their normals point outward.
+SurfaceMesh<double> MakeCapsuleSurfaceMesh(const Capsule& capsule,
+                                           double resolution_hint) {
+  const double radius = capsule.radius();
+  const double half_length = capsule.length() / 2;
+  const int num_sides = std::max(
+      3, static_cast<int>(std::ceil(2 * M_PI * radius / resolution_hint)));
+  // The rings of each cap, from its pole to the end of the cylinder.
+  const int num_cap_rings = std::max(1, num_sides / 4);
+  const int num_rings = 2 * num_cap_rings;
+
+  std::vector<SurfaceVertex<double>> vertices;
+  vertices.emplace_back(Vector3d(0, 0, half_length + radius));
+  for (int ring = 0; ring < num_rings; ++ring) {
+    // The polar angle from the nearer pole.
+    const bool top = ring < num_cap_rings;
+    const int k = top ? ring + 1 : num_rings - ring;
+    const double phi = k * M_PI_2 / num_cap_rings;
+    const double z = radius * std::cos(phi) + half_length;
+    const double rho = radius * std::sin(phi);
+    for (int j = 0; j < num_sides; ++j) {
+      const double theta = 2 * M_PI * j / num_sides;
+      vertices.emplace_back(Vector3d(rho * std::cos(theta),
+                                     rho * std::sin(theta), top ? z : -z));
+    }
+  }
+  vertices.emplace_back(Vector3d(0, 0, -half_length - radius));
+
+  auto ring_vertex = [num_sides](int ring, int j) {
+    return SurfaceVertexIndex(1 + ring * num_sides + j % num_sides);
+  };
+  const SurfaceVertexIndex top_pole(0);
+  const SurfaceVertexIndex bottom_pole(vertices.size() - 1);
+  std::vector<SurfaceFace> faces;
+  for (int j = 0; j < num_sides; ++j) {
+    faces.emplace_back(top_pole, ring_vertex(0, j), ring_vertex(0, j + 1));
+    for (int ring = 0; ring + 1 < num_rings; ++ring) {
+      const SurfaceVertexIndex a = ring_vertex(ring, j);
+      const SurfaceVertexIndex b = ring_vertex(ring, j + 1);
+      const SurfaceVertexIndex c = ring_vertex(ring + 1, j + 1);
+      const SurfaceVertexIndex d = ring_vertex(ring + 1, j);
+      faces.emplace_back(a, d, c);
+      faces.emplace_back(a, c, b);
+    }
+    faces.emplace_back(bottom_pole, ring_vertex(num_rings - 1, j + 1),
+                       ring_vertex(num_rings - 1, j));
+  }
+  return SurfaceMesh<double>(std::move(faces), std::move(vertices));
+}
+
+// Reports whether the two cameras cast the same ray through each pixel and
+// clip them to the same range.
+bool SameRays(const RenderCameraCore& a, const RenderCameraCore& b) {
+  const CameraInfo& ai = a.intrinsics();
+  const CameraInfo& bi = b.intrinsics();
+  return ai.width() == bi.width() && ai.height() == bi.height() &&
+         ai.focal_x() == bi.focal_x() && ai.focal_y() == bi.focal_y() &&
+         ai.center_x() == bi.center_x() && ai.center_y() == bi.center_y() &&
+         a.clipping().near() == b.clipping().near() &&
+         a.clipping().far() == b.clipping().far();
+}
+
+// The data passed through the reification of a shape during registration.
+struct RegistrationData {
+  const PerceptionProperties& properties;
+  const RigidTransformd& X_WG;
+  const GeometryId id;
+};
+
+}  // namespace
+
+RenderEngineRayCast::RenderEngineRayCast(
+    const RenderEngineRayCastParams& parameters)
+    : RenderEngine(parameters.default_label ? *parameters.default_label
+                                            : RenderLabel::kUnspecified),
+      default_clear_color_(parameters.default_clear_color),
+      relative_resolution_hint_(parameters.relative_resolution_hint),
+      num_parallel_executions_(parameters.num_parallel_executions) {
+  DRAKE_THROW_UNLESS(relative_resolution_hint_ > 0);
+  DRAKE_THROW_UNLESS(num_parallel_executions_ > 0 ||
+                     num_parallel_executions_ == kUseHardwareConcurrency);
+  if (parameters.default_diffuse) {
+    default_diffuse_ = *parameters.default_diffuse;
+  }
+}
+
+void RenderEngineRayCast::UpdateViewpoint(const RigidTransformd& X_WC) {
+  X_WC_ = X_WC;
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Sphere& sphere,
+                                            void* user_data) {
+  AddGeometry(MakeMeshData(MakeSphereSurfaceMesh<double>(
+                  sphere, relative_resolution_hint_ * sphere.radius())),
+              user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Cylinder& cylinder,
+                                            void* user_data) {
+  AddGeometry(MakeMeshData(MakeCylinderSurfaceMesh<double>(
+                  cylinder, relative_resolution_hint_ * cylinder.radius())),
+              user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const HalfSpace&,
+                                            void* user_data) {
+  AddGeometry(nullptr, user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Box& box, void* user_data) {
+  // The faces of a box are planar, so the coarsest mesh is exact.
+  AddGeometry(MakeMeshData(
+                  MakeBoxSurfaceMesh<double>(box, box.size().maxCoeff())),
+              user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Capsule& capsule,
+                                            void* user_data) {
+  AddGeometry(MakeMeshData(MakeCapsuleSurfaceMesh(
+                  capsule, relative_resolution_hint_ * capsule.radius())),
+              user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Ellipsoid& ellipsoid,
+                                            void* user_data) {
+  const double max_semi_axis =
+      std::max({ellipsoid.a(), ellipsoid.b(), ellipsoid.c()});
+  AddGeometry(MakeMeshData(MakeEllipsoidSurfaceMesh<double>(
+                  ellipsoid, relative_resolution_hint_ * max_semi_axis)),
+              user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Mesh& mesh,
+                                            void* user_data) {
+  AddGeometry(GetObjMesh(mesh.filename(), mesh.scale()), user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Convex& convex,
+                                            void* user_data) {
+  AddGeometry(GetObjMesh(convex.filename(), convex.scale()), user_data);
+}
+
+bool RenderEngineRayCast::DoRegisterVisual(
+    GeometryId id, const Shape& shape, const PerceptionProperties& properties,
+    const RigidTransformd& X_WG) {
+  // Note: the user_data interface on reification requires a non-const pointer.
+  RegistrationData data{properties, X_WG, id};
+  shape.Reify(this, &data);
+  return true;
+}
+
+void RenderEngineRayCast::DoUpdateVisualPose(GeometryId id,
+                                             const RigidTransformd& X_WG) {
+  geometries_.at(id).X_WG = X_WG;
+}
+
+bool RenderEngineRayCast::DoRemoveGeometry(GeometryId id) {
+  return geometries_.erase(id) > 0;
+}
+
+std::unique_ptr<RenderEngine> RenderEngineRayCast::DoClone() const {
+  return std::unique_ptr<RenderEngineRayCast>(new RenderEngineRayCast(*this));
+}
+
+void RenderEngineRayCast::DoRenderColorImage(
+    const ColorRenderCamera& camera, ImageRgba8U* color_image_out) const {
+  CastRays({{&camera.core(), X_WC_, nullptr, color_image_out}});
+}
+
+void RenderEngineRayCast::DoRenderDepthImage(
+    const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
+  CastRays({{&camera.core(), X_WC_, &camera.depth_range(), nullptr,
+             depth_image_out}});
+}
+
+void RenderEngineRayCast::DoRenderLabelImage(
+    const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
+  CastRays({{&camera.core(), X_WC_, nullptr, nullptr, nullptr,
+             label_image_out}});
+}
+
+void RenderEngineRayCast::DoRenderImages(
+    const std::vector<RenderImageRequest>& requests) {
+  std::vector<RenderPass> passes;
+  for (const RenderImageRequest& request : requests) {
+    const bool needs_color_pass =
+        request.color_image != nullptr || request.label_image != nullptr;
+    if (needs_color_pass) {
+      passes.push_back({&request.color_camera->core(), request.X_WC, nullptr,
+                        request.color_image, nullptr, request.label_image});
+    }
+    if (request.depth_image == nullptr) continue;
+    // The depth image shares the rays of the color and label images when the
+    // cameras cast the same rays.
+    const RenderCameraCore& depth_core = request.depth_camera->core();
+    if (!needs_color_pass || !SameRays(depth_core, *passes.back().camera)) {
+      passes.push_back({&depth_core, request.X_WC});
+    }
+    passes.back().depth_range = &request.depth_camera->depth_range();
+    passes.back().depth_image = request.depth_image;
+  }
+  CastRays(passes);
+}
+
+void RenderEngineRayCast::CastRays(
+    const std::vector<RenderPass>& passes) const {
+  auto to_byte = [](double channel) {
+    return static_cast<uint8_t>(std::round(255 * channel));
+  };
+  const std::array<uint8_t, 3> clear_color{to_byte(default_clear_color_(0)),
+                                           to_byte(default_clear_color_(1)),
+                                           to_byte(default_clear_color_(2))};
+
+  // The geometries in view of a pass, each with the pose of the camera in its
+  // frame G and the pixels that it may cover.
+  struct PosedGeometry {
+    const RenderGeometry* geometry;
+    RigidTransformd X_GC;
+    PixelBounds bounds;
+  };
+  std::vector<std::vector<PosedGeometry>> posed(passes.size());
+  // The rows of all of the passes are numbered consecutively; the first row
+  // of pass i is row_offsets[i].
+  std::vector<int> row_offsets(passes.size() + 1, 0);
+  for (size_t i = 0; i < passes.size(); ++i) {
+    const RenderCameraCore& camera = *passes[i].camera;
+    const CameraInfo& intrinsics = camera.intrinsics();
+    const int width = intrinsics.width();
+    const int height = intrinsics.height();
+    row_offsets[i + 1] = row_offsets[i] + height;
+    posed[i].reserve(geometries_.size());
+    for (const auto& [id, geometry] : geometries_) {
+      unused(id);
+      const RigidTransformd X_GC = geometry.X_WG.inverse() * passes[i].X_WC;
+      if (geometry.mesh_data == nullptr) {
+        posed[i].push_back({&geometry, X_GC, {0, width - 1, 0, height - 1}});
+        continue;
+      }
+      const std::optional<PixelBounds> bounds = ProjectObb(
+          geometry.mesh_data->bvh->root_node().bv(), X_GC.inverse(),
+          intrinsics, camera.clipping().near(), camera.clipping().far());
+      if (bounds) posed[i].push_back({&geometry, X_GC, *bounds});
+    }
+  }
+
+  const int num_rows = row_offsets.back();
+  const int num_threads = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions_, num_rows);
+  drake::internal::ParallelFor(num_rows, num_threads, [&](int, int row) {
+    const int i = static_cast<int>(
+        std::upper_bound(row_offsets.begin(), row_offsets.end(), row) -
+        row_offsets.begin() - 1);
+    const RenderPass& pass = passes[i];
+    const CameraInfo& intrinsics = pass.camera->intrinsics();
+    const double near = pass.camera->clipping().near();
+    const double far = pass.camera->clipping().far();
+    const int v = row - row_offsets[i];
+    for (int u = 0; u < intrinsics.width(); ++u) {
+      // The ray through the center of the pixel. Its z-component is one, so
+      // the parameter of a point on the ray is the point's depth.
+      const Vector3d d_C((u - intrinsics.center_x()) / intrinsics.focal_x(),
+                         (v - intrinsics.center_y()) / intrinsics.focal_y(),
+                         1.0);
+      double depth = far;
+      const RenderGeometry* hit = nullptr;
+      // The absolute value of the cosine of the angle between the ray and the
+      // normal of the surface that it hits.
+      double cos_incidence = 0.0;
+      for (const auto& [geometry, X_GC, bounds] : posed[i]) {
+        if (!bounds.Contains(u, v)) continue;
+        const Ray ray_G{X_GC.translation(), X_GC.rotation() * d_C};
+        Vector3d normal_G;
+        if (geometry->mesh_data == nullptr) {
+          const std::optional<double> t =
+              IntersectHalfSpace(ray_G, near, depth);
+          if (!t) continue;
+          depth = *t;
+          normal_G = Vector3d::UnitZ();
+        } else {
+          SurfaceFaceIndex face;
+          const MeshData& data = *geometry->mesh_data;
+          if (!IntersectMesh(*data.mesh, *data.bvh, ray_G, near, &depth,
+                             &face)) {
+            continue;
+          }
+          normal_G = data.mesh->face_normal(face);
+        }
+        hit = geometry;
+        cos_incidence =
+            std::abs(normal_G.dot(ray_G.direction)) / ray_G.direction.norm();
+      }
+
+      if (pass.color_image != nullptr) {
+        uint8_t* pixel = pass.color_image->at(u, v);
+        for (int c = 0; c < 3; ++c) {
+          pixel[c] = hit ? to_byte(hit->diffuse(c) * cos_incidence)
+                         : clear_color[c];
+        }
+        pixel[3] = 255u;
+      }
+      if (pass.depth_image != nullptr) {
+        float& pixel = pass.depth_image->at(u, v)[0];
+        if (hit == nullptr || depth > pass.depth_range->max_depth()) {
+          pixel = InvalidDepth::kTooFar;
+        } else if (depth < pass.depth_range->min_depth()) {
+          pixel = InvalidDepth::kTooClose;
+        } else {
+          pixel = static_cast<float>(depth);
+        }
+      }
+      if (pass.label_image != nullptr) {
+        pass.label_image->at(u, v)[0] = hit ? hit->label : RenderLabel::kEmpty;
+      }
+    }
+  });
+}
+
+RenderEngineRayCast::RenderEngineRayCast(const RenderEngineRayCast& other) =
+    default;
+
+void RenderEngineRayCast::AddGeometry(std::shared_ptr<const MeshData> mesh_data,
+                                      void* user_data) {
+  const RegistrationData& data =
+      *reinterpret_cast<RegistrationData*>(user_data);
+  geometries_.insert_or_assign(
+      data.id,
+      RenderGeometry{std::move(mesh_data), data.X_WG,
+                     GetRenderLabelOrThrow(data.properties),
+                     data.properties.GetPropertyOrDefault(
+                         "phong", "diffuse", default_diffuse_)});
+}
+
+std::shared_ptr<const RenderEngineRayCast::MeshData>
+RenderEngineRayCast::MakeMeshData(SurfaceMesh<double> mesh) {
+  auto data = make_shared<MeshData>();
+  data->mesh = make_unique<SurfaceMesh<double>>(std::move(mesh));
+  data->bvh = make_unique<SurfaceBvh>(*data->mesh);
+  return data;
+}
+
+std::shared_ptr<const RenderEngineRayCast::MeshData>
+RenderEngineRayCast::GetObjMesh(const std::string& filename, double scale) {
+  std::shared_ptr<const MeshData>& mesh_data = obj_meshes_[{filename, scale}];
+  if (mesh_data == nullptr) {
+    if (const std::optional<std::string> cache_directory =
+            internal::GetMeshCacheDirectory()) {
+      internal::ObjSurfaceMeshWithBvh cached =
+          internal::ReadObjToSurfaceMeshWithBvh(filename, scale,
+                                                *cache_directory);
+      auto data = make_shared<MeshData>();
+      data->mesh = std::move(cached.mesh);
+      data->bvh = std::move(cached.bvh);
+      mesh_data = std::move(data);
+    } else {
+      mesh_data =
+          MakeMeshData(ReadObjToSurfaceMesh(filename, scale));
+    }
+  }
+  return mesh_data;
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
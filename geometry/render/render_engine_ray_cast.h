@@ -0,0 +1,185 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/surface_mesh.h"
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_engine_ray_cast_factory.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** See documentation of MakeRenderEngineRayCast().  */
+class RenderEngineRayCast final : public RenderEngine {
+ public:
+  /** \name Does not allow copy, move, or assignment  */
+  //@{
+#ifdef DRAKE_DOXYGEN_CXX
+  // Note: the copy constructor operator is actually private to serve as the
+  // basis for implementing the DoClone() method.
+  RenderEngineRayCast(const RenderEngineRayCast&) = delete;
+#endif
+  RenderEngineRayCast& operator=(const RenderEngineRayCast&) = delete;
+  RenderEngineRayCast(RenderEngineRayCast&&) = delete;
+  RenderEngineRayCast& operator=(RenderEngineRayCast&&) = delete;
+  //@}}
+
+  /** Constructs the render engine from the given `parameters`.
+
+   When one of the optional parameters is omitted, the constructed value will be
+   as documented elsewhere in
+   @ref render_engine_ray_cast_properties "this class".
+   @throws std::exception if `parameters.relative_resolution_hint` is not
+           positive, or `parameters.num_parallel_executions` is neither
+           positive nor kUseHardwareConcurrency.  */
+  explicit RenderEngineRayCast(
+      const RenderEngineRayCastParams& parameters =
+          RenderEngineRayCastParams());
+
+  /** @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) override;
+
+  /** @name    Shape reification  */
+  //@{
+  void ImplementGeometry(const Sphere& sphere, void* user_data) override;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) override;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) override;
+  void ImplementGeometry(const Box& box, void* user_data) override;
+  void ImplementGeometry(const Capsule& capsule, void* user_data) override;
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) override;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) override;
+  void ImplementGeometry(const Convex& convex, void* user_data) override;
+  //@}
+
+  /** @name    Access the default properties
+
+   Provides access to the default values this instance of the render engine is
+   using. These values must be set at construction.  */
+  //@{
+
+  const Eigen::Vector4d& default_diffuse() const { return default_diffuse_; }
+
+  const Eigen::Vector3d& default_clear_color() const {
+    return default_clear_color_;
+  }
+
+  using RenderEngine::default_render_label;
+  //@}
+
+  /** Returns the number of threads that cast the rays of an image.  */
+  int num_parallel_executions() const { return num_parallel_executions_; }
+
+ private:
+  // The triangle mesh of a shape, measured and expressed in the shape's
+  // geometry frame G, and its bounding volume hierarchy. Clones share these.
+  struct MeshData {
+    std::unique_ptr<SurfaceMesh<double>> mesh;
+    std::unique_ptr<internal::Bvh<SurfaceMesh<double>>> bvh;
+  };
+
+  // A registered geometry.
+  struct RenderGeometry {
+    // Null for a HalfSpace, which is intersected analytically.
+    std::shared_ptr<const MeshData> mesh_data;
+    math::RigidTransformd X_WG;
+    RenderLabel label;
+    Eigen::Vector4d diffuse;
+  };
+
+  // The images written by one pass of rays through the pixels of `camera`
+  // posed at X_WC. Any of the images may be null; `depth_range` is required
+  // for the depth image.
+  struct RenderPass {
+    const RenderCameraCore* camera{};
+    math::RigidTransformd X_WC;
+    const DepthRange* depth_range{};
+    systems::sensors::ImageRgba8U* color_image{};
+    systems::sensors::ImageDepth32F* depth_image{};
+    systems::sensors::ImageLabel16I* label_image{};
+  };
+
+  // Copy constructor for the purpose of cloning.
+  RenderEngineRayCast(const RenderEngineRayCast& other);
+
+  // @see RenderEngine::DoRegisterVisual().
+  bool DoRegisterVisual(GeometryId id, const Shape& shape,
+                        const PerceptionProperties& properties,
+                        const math::RigidTransformd& X_WG) override;
+
+  // @see RenderEngine::DoUpdateVisualPose().
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) override;
+
+  // @see RenderEngine::DoRemoveGeometry().
+  bool DoRemoveGeometry(GeometryId id) override;
+
+  // @see RenderEngine::DoClone().
+  std::unique_ptr<RenderEngine> DoClone() const override;
+
+  // @see RenderEngine::DoRenderColorImage().
+  void DoRenderColorImage(
+      const ColorRenderCamera& camera,
+      systems::sensors::ImageRgba8U* color_image_out) const override;
+
+  // @see RenderEngine::DoRenderDepthImage().
+  void DoRenderDepthImage(
+      const DepthRenderCamera& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const override;
+
+  // @see RenderEngine::DoRenderLabelImage().
+  void DoRenderLabelImage(
+      const ColorRenderCamera& camera,
+      systems::sensors::ImageLabel16I* label_image_out) const override;
+
+  // @see RenderEngine::DoRenderImages().
+  void DoRenderImages(const std::vector<RenderImageRequest>& requests) override;
+
+  // Registers the geometry described by `user_data` (the RegistrationData of
+  // DoRegisterVisual()) with the given mesh (null for a HalfSpace).
+  void AddGeometry(std::shared_ptr<const MeshData> mesh_data, void* user_data);
+
+  // Bundles the mesh with its newly built hierarchy.
+  static std::shared_ptr<const MeshData> MakeMeshData(
+      SurfaceMesh<double> mesh);
+
+  // Returns the mesh of the given .obj file, reading it on first use.
+  std::shared_ptr<const MeshData> GetObjMesh(const std::string& filename,
+                                             double scale);
+
+  // For each pass, casts the ray through the center of each pixel of its
+  // camera and writes the nearest intersection within the camera's clipping
+  // range to its images. The rows of all of the images are cast in parallel.
+  void CastRays(const std::vector<RenderPass>& passes) const;
+
+  // Obnoxious bright orange.
+  Eigen::Vector4d default_diffuse_{0.9, 0.45, 0.1, 1.0};
+
+  // The color of the pixels whose rays hit nothing.
+  Eigen::Vector3d default_clear_color_;
+
+  double relative_resolution_hint_{};
+
+  int num_parallel_executions_{};
+
+  // The pose of the camera in the world frame.
+  math::RigidTransformd X_WC_;
+
+  std::unordered_map<GeometryId, RenderGeometry> geometries_;
+
+  // The meshes read from .obj files, keyed by the file name and scale.
+  std::map<std::pair<std::string, double>, std::shared_ptr<const MeshData>>
+      obj_meshes_;
+};
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
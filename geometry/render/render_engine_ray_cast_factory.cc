@@ -0,0 +1,16 @@
+#include "drake/geometry/render/render_engine_ray_cast_factory.h"
+
+#include "drake/geometry/render/render_engine_ray_cast.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+std::unique_ptr<RenderEngine> MakeRenderEngineRayCast(
+    const RenderEngineRayCastParams& params) {
+  return std::make_unique<RenderEngineRayCast>(params);
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
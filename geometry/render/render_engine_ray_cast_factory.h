@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "drake/common/parallelism.h"
+#include "drake/geometry/render/render_engine.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Construction parameters for the RenderEngineRayCast.  */
+struct RenderEngineRayCastParams {
+  /** The (optional) label to apply when none is otherwise specified.  */
+  std::optional<RenderLabel> default_label{};
+
+  /** The (optional) rgba color to apply to the (phong, diffuse) property when
+    none is otherwise specified. Note: the alpha channel is unused by
+    RenderEngineRayCast.  */
+  std::optional<Eigen::Vector4d> default_diffuse{};
+
+  /** The rgb color to which the color image is cleared (each
+   channel in the range [0, 1]). The default value (in byte values) would be
+   [204, 229, 255].  */
+  Eigen::Vector3d default_clear_color{204 / 255., 229 / 255., 255 / 255.};
+
+  /** The length of the edges of the triangles that approximate the curved
+   primitives (Sphere, Cylinder, Capsule, and Ellipsoid), as a fraction of
+   their radius (or largest semi-axis). Smaller values give more faithful
+   silhouettes and depths at the cost of more triangles. Must be positive.  */
+  double relative_resolution_hint{0.1};
+
+  /** The number of threads that cast the rays of an image, either a positive
+   number or kUseHardwareConcurrency.  */
+  int num_parallel_executions{kUseHardwareConcurrency};
+};
+
+/** Constructs a RenderEngine implementation which casts one ray per pixel on
+ the CPU, in parallel, against a bounding volume hierarchy of each geometry's
+ triangle mesh. It needs no OpenGL context, so it can be used on machines
+ without a GPU or a display. It is intended for depth and label images; its
+ color images are flat-shaded (see below).
+
+ To render with it, add it to SceneGraph with SceneGraph::AddRenderer() and
+ name it as the `renderer_name` of the cameras of, e.g., an
+ systems::sensors::RgbdSensor.
+
+ RenderEngine::RenderImages() casts the rays of all of the requested images
+ in parallel, and casts a single ray per pixel for the color, depth, and label
+ images of a request whose color and depth cameras have the same intrinsics and
+ clipping range (as systems::sensors::MultiCameraRgbdSensor requests them).
+
+ @anchor render_engine_ray_cast_properties
+ <h2>Geometry perception properties</h2>
+
+ This RenderEngine implementation looks for the following properties when
+ registering visual geometry, categorized by rendered image type.
+
+ <h3>RGB images</h3>
+
+ | Group name | Property Name | Required |  Property Type  | Property Description |
+ | :--------: | :-----------: | :------: | :-------------: | :------------------- |
+ |    phong   | diffuse       | no¹      | Eigen::Vector4d | The rgba value of the object surface. |
+
+ ¹ If no diffuse value is given, a default rgba value will be applied. The
+   default color is a bright orange. This default value can be changed to a
+   different value at construction.
+
+ Each pixel is lit by a single light at the camera: its color is the diffuse
+ color scaled by the cosine of the angle between the ray and the surface.
+ There are no shadows, and textures (`(phong, diffuse_map)`) are ignored.
+
+ <h3>Depth images</h3>
+
+ No specific properties required.
+
+ <h3>Label images</h3>
+
+ | Group name | Property Name |   Required    |  Property Type  | Property Description |
+ | :--------: | :-----------: | :-----------: | :-------------: | :------------------- |
+ |   label    | id            | configurable² |  RenderLabel    | The label to render into the image. |
+
+ ² %RenderEngineRayCast has a default render label value that is applied to
+ any geometry that doesn't have a (label, id) property at registration. If a
+ value is not explicitly specified, %RenderEngineRayCast uses
+ RenderLabel::kUnspecified as this default value. It can be explicitly set upon
+ construction. The possible values for this default label and the
+ ramifications of that choice are documented
+ @ref render_engine_default_label "here".
+
+ <h3>Geometries accepted by %RenderEngineRayCast</h3>
+
+ %RenderEngineRayCast accepts _all_ geometries (assuming the properties pass
+ validation, e.g., render label validation). HalfSpace is intersected exactly,
+ Box is represented exactly by its triangles, and the other primitives are
+ tessellated according to
+ RenderEngineRayCastParams::relative_resolution_hint. Mesh and Convex must
+ name Wavefront .obj files; as for proximity geometry, the meshes are read
+ through the on-disk mesh cache when `DRAKE_MESH_CACHE_DIR` is set, and a file
+ registered more than once (with the same scale) is only read once.  */
+std::unique_ptr<RenderEngine> MakeRenderEngineRayCast(
+    const RenderEngineRayCastParams& params);
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
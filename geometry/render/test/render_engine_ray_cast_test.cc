@@ -0,0 +1,345 @@
+#include "drake/geometry/render/render_engine_ray_cast.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+
+// The image has an odd size, so that the ray of the center pixel is the
+// optical axis of the camera.
+constexpr int kWidth = 65;
+constexpr int kHeight = 49;
+constexpr int kCenterU = kWidth / 2;
+constexpr int kCenterV = kHeight / 2;
+
+const RenderLabel kBoxLabel(1);
+const RenderLabel kSphereLabel(2);
+const Vector4d kBoxDiffuse(1, 0, 0, 1);
+const Vector4d kSphereDiffuse(0, 1, 0, 1);
+
+PerceptionProperties MakeProperties(RenderLabel label,
+                                    const Vector4d& diffuse) {
+  PerceptionProperties properties;
+  properties.AddProperty("label", "id", label);
+  properties.AddProperty("phong", "diffuse", diffuse);
+  return properties;
+}
+
+RenderCameraCore MakeCameraCore(double near) {
+  return RenderCameraCore("ray_cast", CameraInfo(kWidth, kHeight, M_PI / 4),
+                          ClippingRange(near, 10), RigidTransformd());
+}
+
+DepthRenderCamera MakeDepthCamera(double near = 0.1, double min_depth = 0.1,
+                                  double max_depth = 10) {
+  return DepthRenderCamera(MakeCameraCore(near),
+                           DepthRange(min_depth, max_depth));
+}
+
+ColorRenderCamera MakeColorCamera(double near = 0.1) {
+  return ColorRenderCamera(MakeCameraCore(near));
+}
+
+// The camera is at the world origin, looking along the world's +z axis. A
+// large box fills the view at depth 3.5, and a sphere in front of it covers
+// the center of the image at depth 1.5.
+class RenderEngineRayCastTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    RenderEngineRayCastParams params;
+    params.relative_resolution_hint = 0.05;
+    renderer_ = std::make_unique<RenderEngineRayCast>(params);
+    renderer_->UpdateViewpoint(RigidTransformd());
+    renderer_->RegisterVisual(box_id_, Box(4, 4, 1),
+                              MakeProperties(kBoxLabel, kBoxDiffuse),
+                              RigidTransformd(Vector3d(0, 0, 4)), false);
+    renderer_->RegisterVisual(sphere_id_, Sphere(0.5),
+                              MakeProperties(kSphereLabel, kSphereDiffuse),
+                              RigidTransformd(Vector3d(0, 0, 2)), true);
+  }
+
+  ImageDepth32F RenderDepth(const DepthRenderCamera& camera,
+                            const RenderEngine& renderer) {
+    ImageDepth32F depth(kWidth, kHeight);
+    renderer.RenderDepthImage(camera, &depth);
+    return depth;
+  }
+
+  ImageLabel16I RenderLabels(const ColorRenderCamera& camera,
+                             const RenderEngine& renderer) {
+    ImageLabel16I label(kWidth, kHeight);
+    renderer.RenderLabelImage(camera, &label);
+    return label;
+  }
+
+  std::unique_ptr<RenderEngineRayCast> renderer_;
+  const GeometryId box_id_ = GeometryId::get_new_id();
+  const GeometryId sphere_id_ = GeometryId::get_new_id();
+};
+
+TEST_F(RenderEngineRayCastTest, EmptyScene) {
+  RenderEngineRayCast renderer;
+  const ImageDepth32F depth = RenderDepth(MakeDepthCamera(), renderer);
+  const ImageLabel16I label = RenderLabels(MakeColorCamera(), renderer);
+  ImageRgba8U color(kWidth, kHeight);
+  renderer.RenderColorImage(MakeColorCamera(), &color);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      EXPECT_EQ(depth.at(u, v)[0], InvalidDepth::kTooFar);
+      EXPECT_EQ(label.at(u, v)[0], RenderLabel::kEmpty);
+      EXPECT_EQ(color.at(u, v)[0], 204);
+      EXPECT_EQ(color.at(u, v)[1], 229);
+      EXPECT_EQ(color.at(u, v)[2], 255);
+      EXPECT_EQ(color.at(u, v)[3], 255);
+    }
+  }
+}
+
+TEST_F(RenderEngineRayCastTest, DepthLabelAndColor) {
+  const ImageDepth32F depth = RenderDepth(MakeDepthCamera(), *renderer_);
+  // The sphere is tessellated; the box is exact.
+  EXPECT_NEAR(depth.at(kCenterU, kCenterV)[0], 1.5, 1e-2);
+  EXPECT_NEAR(depth.at(0, 0)[0], 3.5, 1e-6);
+  EXPECT_NEAR(depth.at(kWidth - 1, kHeight - 1)[0], 3.5, 1e-6);
+
+  const ImageLabel16I label = RenderLabels(MakeColorCamera(), *renderer_);
+  EXPECT_EQ(label.at(kCenterU, kCenterV)[0], kSphereLabel);
+  EXPECT_EQ(label.at(0, 0)[0], kBoxLabel);
+
+  ImageRgba8U color(kWidth, kHeight);
+  renderer_->RenderColorImage(MakeColorCamera(), &color);
+  // The ray of the center pixel hits the sphere head on.
+  EXPECT_EQ(color.at(kCenterU, kCenterV)[0], 0);
+  EXPECT_NEAR(color.at(kCenterU, kCenterV)[1], 255, 2);
+  EXPECT_EQ(color.at(kCenterU, kCenterV)[2], 0);
+  // The ray of a corner pixel hits the box obliquely, so it is darker.
+  const CameraInfo& intrinsics = MakeColorCamera().core().intrinsics();
+  const Vector3d ray(intrinsics.center_x() / intrinsics.focal_x(),
+                     intrinsics.center_y() / intrinsics.focal_y(), 1);
+  EXPECT_NEAR(color.at(0, 0)[0], 255 / ray.norm(), 1);
+  EXPECT_EQ(color.at(0, 0)[1], 0);
+  EXPECT_EQ(color.at(0, 0)[3], 255);
+}
+
+TEST_F(RenderEngineRayCastTest, DepthRangeAndClipping) {
+  const ImageDepth32F depth =
+      RenderDepth(MakeDepthCamera(0.1, 2.0, 3.0), *renderer_);
+  EXPECT_EQ(depth.at(kCenterU, kCenterV)[0], InvalidDepth::kTooClose);
+  EXPECT_EQ(depth.at(0, 0)[0], InvalidDepth::kTooFar);
+
+  // The near clipping plane cuts the front of the sphere away, so the rays
+  // see the inside of its back.
+  const ImageDepth32F clipped =
+      RenderDepth(MakeDepthCamera(2.0, 2.0), *renderer_);
+  EXPECT_NEAR(clipped.at(kCenterU, kCenterV)[0], 2.5, 1e-2);
+  EXPECT_EQ(RenderLabels(MakeColorCamera(2.0), *renderer_)
+                .at(kCenterU, kCenterV)[0],
+            kSphereLabel);
+  // Beyond the back of the sphere, only the box is left.
+  EXPECT_EQ(RenderLabels(MakeColorCamera(2.6), *renderer_)
+                .at(kCenterU, kCenterV)[0],
+            kBoxLabel);
+}
+
+TEST_F(RenderEngineRayCastTest, UpdateRemoveAndClone) {
+  // Move the sphere behind the box.
+  renderer_->UpdatePoses(std::unordered_map<GeometryId, RigidTransformd>{
+      {sphere_id_, RigidTransformd(Vector3d(0, 0, 5))}});
+  EXPECT_EQ(RenderLabels(MakeColorCamera(), *renderer_)
+                .at(kCenterU, kCenterV)[0],
+            kBoxLabel);
+
+  // Moving the camera also moves the rays.
+  renderer_->UpdateViewpoint(RigidTransformd(Vector3d(0, 0, 3)));
+  EXPECT_NEAR(RenderDepth(MakeDepthCamera(), *renderer_)
+                  .at(kCenterU, kCenterV)[0],
+              0.5, 1e-6);
+  renderer_->UpdateViewpoint(RigidTransformd());
+
+  std::unique_ptr<RenderEngine> clone = renderer_->Clone();
+  EXPECT_TRUE(renderer_->RemoveGeometry(box_id_));
+  EXPECT_EQ(RenderLabels(MakeColorCamera(), *renderer_)
+                .at(kCenterU, kCenterV)[0],
+            kSphereLabel);
+  EXPECT_NEAR(RenderDepth(MakeDepthCamera(), *renderer_)
+                  .at(kCenterU, kCenterV)[0],
+              4.5, 1e-2);
+
+  // The clone still has the box.
+  EXPECT_EQ(RenderLabels(MakeColorCamera(), *clone).at(kCenterU, kCenterV)[0],
+            kBoxLabel);
+}
+
+TEST_F(RenderEngineRayCastTest, ParallelMatchesSerial) {
+  RenderEngineRayCastParams params;
+  params.relative_resolution_hint = 0.05;
+  params.num_parallel_executions = 1;
+  RenderEngineRayCast serial(params);
+  EXPECT_EQ(serial.num_parallel_executions(), 1);
+  serial.UpdateViewpoint(RigidTransformd());
+  serial.RegisterVisual(box_id_, Box(4, 4, 1),
+                        MakeProperties(kBoxLabel, kBoxDiffuse),
+                        RigidTransformd(Vector3d(0, 0, 4)), false);
+  serial.RegisterVisual(sphere_id_, Sphere(0.5),
+                        MakeProperties(kSphereLabel, kSphereDiffuse),
+                        RigidTransformd(Vector3d(0, 0, 2)), true);
+  EXPECT_EQ(renderer_->num_parallel_executions(), kUseHardwareConcurrency);
+
+  const ImageDepth32F depth = RenderDepth(MakeDepthCamera(), *renderer_);
+  const ImageDepth32F serial_depth = RenderDepth(MakeDepthCamera(), serial);
+  const ImageLabel16I label = RenderLabels(MakeColorCamera(), *renderer_);
+  const ImageLabel16I serial_label = RenderLabels(MakeColorCamera(), serial);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      EXPECT_EQ(depth.at(u, v)[0], serial_depth.at(u, v)[0]);
+      EXPECT_EQ(label.at(u, v)[0], serial_label.at(u, v)[0]);
+    }
+  }
+}
+
+template <typename ImageType>
+void ExpectSameImage(const ImageType& image, const ImageType& expected) {
+  ASSERT_EQ(image.size(), expected.size());
+  EXPECT_TRUE(std::equal(image.at(0, 0), image.at(0, 0) + image.size(),
+                         expected.at(0, 0)));
+}
+
+// Renders the images of two cameras in one call and compares them with the
+// images rendered one at a time. The first camera's images share their rays;
+// the second camera's depth camera clips differently, so it needs its own.
+TEST_F(RenderEngineRayCastTest, RenderImages) {
+  const RigidTransformd X_WC1;
+  const RigidTransformd X_WC2(Vector3d(0.25, 0, 0));
+  ImageRgba8U color1(kWidth, kHeight);
+  ImageDepth32F depth1(kWidth, kHeight);
+  ImageLabel16I label1(kWidth, kHeight);
+  ImageDepth32F depth2(kWidth, kHeight);
+  ImageLabel16I label2(kWidth, kHeight);
+  std::vector<RenderImageRequest> requests(2);
+  requests[0] = {X_WC1, MakeColorCamera(), MakeDepthCamera(), &color1, &depth1,
+                 &label1};
+  requests[1] = {X_WC2, MakeColorCamera(), MakeDepthCamera(2.6, 2.6), nullptr,
+                 &depth2, &label2};
+  renderer_->RenderImages(requests);
+
+  renderer_->UpdateViewpoint(X_WC1);
+  ImageRgba8U expected_color1(kWidth, kHeight);
+  renderer_->RenderColorImage(MakeColorCamera(), &expected_color1);
+  const ImageDepth32F expected_depth1 =
+      RenderDepth(MakeDepthCamera(), *renderer_);
+  const ImageLabel16I expected_label1 =
+      RenderLabels(MakeColorCamera(), *renderer_);
+  renderer_->UpdateViewpoint(X_WC2);
+  const ImageDepth32F expected_depth2 =
+      RenderDepth(MakeDepthCamera(2.6, 2.6), *renderer_);
+  const ImageLabel16I expected_label2 =
+      RenderLabels(MakeColorCamera(), *renderer_);
+  ExpectSameImage(color1, expected_color1);
+  ExpectSameImage(depth1, expected_depth1);
+  ExpectSameImage(label1, expected_label1);
+  ExpectSameImage(depth2, expected_depth2);
+  ExpectSameImage(label2, expected_label2);
+  // The second depth camera sees through the sphere to the box.
+  EXPECT_NEAR(depth2.at(kCenterU, kCenterV)[0], 3.5, 1e-6);
+  EXPECT_EQ(label2.at(kCenterU, kCenterV)[0], kSphereLabel);
+
+  // An image without its camera, or with the wrong size, is rejected.
+  requests.resize(1);
+  requests[0].depth_camera.reset();
+  DRAKE_EXPECT_THROWS_MESSAGE(renderer_->RenderImages(requests),
+                              std::logic_error,
+                              ".*depth image. The request has no camera.*");
+  requests[0].depth_image = nullptr;
+  ImageLabel16I small_label(kWidth - 1, kHeight);
+  requests[0].label_image = &small_label;
+  DRAKE_EXPECT_THROWS_MESSAGE(renderer_->RenderImages(requests),
+                              std::logic_error,
+                              "The label image to write has a size.*");
+}
+
+// Confirms the depth of the point of each shape that is nearest to the camera,
+// with the shape centered on the optical axis at a distance of 3.
+GTEST_TEST(RenderEngineRayCastShapeTest, Shapes) {
+  const std::string box_obj =
+      FindResourceOrThrow("drake/systems/sensors/test/models/meshes/box.obj");
+  struct Case {
+    std::string description;
+    std::unique_ptr<Shape> shape;
+    double expected_depth;
+    double tolerance;
+  };
+  std::vector<Case> cases;
+  cases.push_back({"capsule", std::make_unique<Capsule>(0.5, 1), 2.0, 1e-6});
+  cases.push_back({"cylinder", std::make_unique<Cylinder>(0.5, 1), 2.5, 1e-6});
+  cases.push_back({"ellipsoid", std::make_unique<Ellipsoid>(0.5, 0.5, 0.25),
+                   2.75, 1e-2});
+  cases.push_back({"mesh", std::make_unique<Mesh>(box_obj, 0.5), 2.5, 1e-6});
+  cases.push_back(
+      {"convex", std::make_unique<Convex>(box_obj, 0.5), 2.5, 1e-6});
+  for (const Case& c : cases) {
+    SCOPED_TRACE(c.description);
+    RenderEngineRayCast renderer;
+    renderer.UpdateViewpoint(RigidTransformd());
+    renderer.RegisterVisual(GeometryId::get_new_id(), *c.shape,
+                            MakeProperties(kBoxLabel, kBoxDiffuse),
+                            RigidTransformd(Vector3d(0, 0, 3)), false);
+    ImageDepth32F depth(kWidth, kHeight);
+    renderer.RenderDepthImage(MakeDepthCamera(), &depth);
+    EXPECT_NEAR(depth.at(kCenterU, kCenterV)[0], c.expected_depth,
+                c.tolerance);
+    EXPECT_EQ(depth.at(0, 0)[0], InvalidDepth::kTooFar);
+  }
+}
+
+GTEST_TEST(RenderEngineRayCastShapeTest, HalfSpace) {
+  RenderEngineRayCast renderer;
+  renderer.UpdateViewpoint(RigidTransformd());
+  // The boundary faces the camera at a distance of 5.
+  renderer.RegisterVisual(
+      GeometryId::get_new_id(), HalfSpace(),
+      MakeProperties(kBoxLabel, kBoxDiffuse),
+      HalfSpace::MakePose(Vector3d(0, 0, -1), Vector3d(0, 0, 5)), false);
+  ImageDepth32F depth(kWidth, kHeight);
+  renderer.RenderDepthImage(MakeDepthCamera(), &depth);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      EXPECT_NEAR(depth.at(u, v)[0], 5, 1e-5);
+    }
+  }
+}
+
+GTEST_TEST(RenderEngineRayCastShapeTest, BadParameters) {
+  RenderEngineRayCastParams params;
+  params.relative_resolution_hint = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineRayCast{params}, std::exception,
+                              ".*relative_resolution_hint.*");
+  params = RenderEngineRayCastParams();
+  params.num_parallel_executions = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineRayCast{params}, std::exception,
+                              ".*num_parallel_executions.*");
+}
+
+}  // namespace
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -343,6 +343,49 @@ GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
   });
 }
 
+// Confirms that the default implementation of RenderImages() renders each
+// requested image from its camera's pose, and nothing more, and that requests
+// are validated.
+GTEST_TEST(RenderEngine, RenderImages) {
+  DummyRenderEngine engine;
+  const CameraInfo intrinsics{2, 2, M_PI};
+  const ColorRenderCamera color_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  const RigidTransformd X_WC1(Vector3d(1, 2, 3));
+  const RigidTransformd X_WC2(Vector3d(4, 5, 6));
+  ImageRgba8U color(2, 2);
+  ImageDepth32F depth1(2, 2);
+  ImageDepth32F depth2(2, 2);
+  ImageLabel16I label(2, 2);
+
+  std::vector<RenderImageRequest> requests{
+      {X_WC1, color_camera, depth_camera, &color, &depth1, &label},
+      {X_WC2, std::nullopt, depth_camera, nullptr, &depth2, nullptr}};
+  engine.RenderImages(requests);
+  EXPECT_EQ(engine.num_color_renders(), 1);
+  EXPECT_EQ(engine.num_depth_renders(), 2);
+  EXPECT_EQ(engine.num_label_renders(), 1);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WC2.GetAsMatrix34()));
+
+  // The second request has no color camera for a label image.
+  requests[1].label_image = &label;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(requests), std::logic_error,
+      "Can't render a label image. The request has no camera for it");
+  requests[1].label_image = nullptr;
+  // The first request's color image has the wrong size.
+  ImageRgba8U bad_color(1, 2);
+  requests[0].color_image = &bad_color;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(requests), std::logic_error,
+      "The color image to write has a size different from that specified.*");
+  // Nothing is rendered when a request is invalid.
+  EXPECT_EQ(engine.num_depth_renders(), 2);
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable
 // with both a copy constructor *and* a valid DoClone() implementation.
 class CloneableEngine : public MinimumEngine {
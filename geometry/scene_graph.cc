@@ -362,6 +362,24 @@ void SceneGraph<T>::ExcludeCollisionsBetween(Context<T>* context,
   g_state.ExcludeCollisionsBetween(setA, setB);
 }
 
+template <typename T>
+void SceneGraph<T>::set_contact_surface_parallelism(
+    int num_parallel_executions) {
+  model_.set_contact_surface_parallelism(num_parallel_executions);
+}
+
+template <typename T>
+void SceneGraph<T>::set_contact_surface_parallelism(
+    Context<T>* context, int num_parallel_executions) const {
+  auto& g_state = mutable_geometry_state(context);
+  g_state.set_contact_surface_parallelism(num_parallel_executions);
+}
+
+template <typename T>
+int SceneGraph<T>::contact_surface_parallelism() const {
+  return model_.contact_surface_parallelism();
+}
+
 template <typename T>
 void SceneGraph<T>::SetDefaultState(const Context<T>& context,
                                     State<T>* state) const {
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/geometry_set.h"
 #include "drake/geometry/geometry_state.h"
 #include "drake/geometry/query_object.h"
@@ -906,6 +907,41 @@ class SceneGraph final : public systems::LeafSystem<T> {
                                 const GeometrySet& setB) const;
   //@}
 
+  /** @name         Proximity query configuration
+
+   These methods configure how %SceneGraph evaluates its proximity queries. They
+   affect only the computational strategy; the query results are unchanged.  */
+  //@{
+
+  /** Sets the number of parallel executions used to compute the hydroelastic
+   contact surfaces in QueryObject::ComputeContactSurfaces() and
+   QueryObject::ComputeContactSurfacesWithFallback(). The candidate pairs are
+   still found serially, but the (typically dominant) per-pair contact surface
+   computations are distributed across up to `num_parallel_executions`
+   threads. The returned surfaces are identical, and in the same order, for all
+   values. The default is kNoConcurrency.
+
+   This method modifies the underlying model; only contexts allocated after
+   this call reflect the new value.
+
+   @param num_parallel_executions  Either a positive number of threads or
+                                   kUseHardwareConcurrency.
+   @throws std::exception if `num_parallel_executions` is neither positive nor
+                          kUseHardwareConcurrency.  */
+  void set_contact_surface_parallelism(int num_parallel_executions);
+
+  /** systems::Context-modifying variant of set_contact_surface_parallelism().
+   Rather than modifying %SceneGraph's model, it modifies the copy of the model
+   stored in the provided context.  */
+  void set_contact_surface_parallelism(systems::Context<T>* context,
+                                       int num_parallel_executions) const;
+
+  /** Reports the number of parallel executions configured in %SceneGraph's
+   model for computing contact surfaces.
+   @see set_contact_surface_parallelism().  */
+  int contact_surface_parallelism() const;
+  //@}
+
  private:
   // Friend class to facilitate testing.
   friend class SceneGraphTester;
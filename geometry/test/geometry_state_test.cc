@@ -3417,6 +3417,61 @@ TEST_F(GeometryStateTest, GetRenderEngine) {
                               "No renderer exists with name.*");
 }
 
+// Confirms that RenderImages() gives each render engine the images of the
+// cameras that name it, splitting a request whose cameras name different
+// engines.
+TEST_F(GeometryStateTest, RenderImages) {
+  auto render_engine = make_unique<DummyRenderEngine>();
+  DummyRenderEngine* second_engine = render_engine.get();
+  const std::string second_engine_name = "second_engine";
+  geometry_state_.AddRenderer(second_engine_name, move(render_engine));
+
+  const systems::sensors::CameraInfo intrinsics{2, 2, M_PI};
+  auto make_core = [&intrinsics](const std::string& name) {
+    return render::RenderCameraCore{name, intrinsics, {0.1, 10},
+                                    RigidTransformd{}};
+  };
+  const render::ColorRenderCamera color_camera{make_core(kDummyRenderName)};
+  const render::DepthRenderCamera depth_camera{make_core(kDummyRenderName),
+                                               {1.0, 5.0}};
+  const render::DepthRenderCamera second_depth_camera{
+      make_core(second_engine_name), {1.0, 5.0}};
+  systems::sensors::ImageRgba8U color(2, 2);
+  systems::sensors::ImageLabel16I label(2, 2);
+  systems::sensors::ImageDepth32F depth1(2, 2);
+  systems::sensors::ImageDepth32F depth2(2, 2);
+  const RigidTransformd X_WC1(Vector3d(1, 2, 3));
+  const RigidTransformd X_WC2(Vector3d(4, 5, 6));
+
+  std::vector<render::RenderImageRequest> requests{
+      {X_WC1, color_camera, second_depth_camera, &color, &depth1, &label},
+      {X_WC2, std::nullopt, depth_camera, nullptr, &depth2, nullptr},
+      {X_WC2, color_camera, std::nullopt, nullptr, nullptr, nullptr}};
+  geometry_state_.RenderImages(requests);
+  EXPECT_EQ(render_engine_->num_color_renders(), 1);
+  EXPECT_EQ(render_engine_->num_label_renders(), 1);
+  EXPECT_EQ(render_engine_->num_depth_renders(), 1);
+  EXPECT_TRUE(
+      CompareMatrices(render_engine_->last_updated_X_WC().GetAsMatrix34(),
+                      X_WC2.GetAsMatrix34()));
+  EXPECT_EQ(second_engine->num_color_renders(), 0);
+  EXPECT_EQ(second_engine->num_label_renders(), 0);
+  EXPECT_EQ(second_engine->num_depth_renders(), 1);
+  EXPECT_TRUE(
+      CompareMatrices(second_engine->last_updated_X_WC().GetAsMatrix34(),
+                      X_WC1.GetAsMatrix34()));
+
+  requests[1].depth_camera = render::DepthRenderCamera{make_core("bad name"),
+                                                       {1.0, 5.0}};
+  DRAKE_EXPECT_THROWS_MESSAGE(geometry_state_.RenderImages(requests),
+                              std::logic_error,
+                              "No renderer exists with name.*");
+  requests[1].depth_camera.reset();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RenderImages(requests), std::logic_error,
+      "Can't render images of a request that has no cameras");
+}
+
 // Confirms that the renderer(s) have poses updated properly when
 // FinalizePoseUpdate() is called.
 TEST_F(GeometryStateTest, RendererPoseUpdate) {
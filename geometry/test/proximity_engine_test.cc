@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -1819,6 +1820,47 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that the output-parameter variant of ComputePointPairPenetration()
+// reports the same results as the returning variant, discards any previous
+// contents, and reuses the storage of the output vector.
+GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairIntoExistingStorage) {
+  ProximityEngine<double> engine;
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 4);
+
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  engine.UpdateWorldPoses(poses);
+  const auto expected = engine.ComputePointPairPenetration();
+  ASSERT_EQ(expected.size(), poses.size());
+
+  // Stale contents are discarded.
+  vector<PenetrationAsPointPair<double>> results(7);
+  engine.ComputePointPairPenetration(&results);
+  ASSERT_EQ(results.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(results[i].id_A, expected[i].id_A);
+    EXPECT_EQ(results[i].id_B, expected[i].id_B);
+    EXPECT_EQ(results[i].depth, expected[i].depth);
+  }
+
+  // Repeated evaluations reuse the same storage.
+  const PenetrationAsPointPair<double>* const data = results.data();
+  engine.ComputePointPairPenetration(&results);
+  EXPECT_EQ(results.size(), expected.size());
+  EXPECT_EQ(results.data(), data);
+
+  // AutoDiffXd reports no penetration (without throwing) when there are no
+  // collisions, also clearing the output.
+  ProximityEngine<AutoDiffXd> engine_ad;
+  vector<PenetrationAsPointPair<AutoDiffXd>> results_ad(2);
+  engine_ad.ComputePointPairPenetration(&results_ad);
+  EXPECT_EQ(results_ad.size(), 0);
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -1952,6 +1994,97 @@ GTEST_TEST(ProximityEngineTests,
   }
 }
 
+// Confirms that computing the contact surfaces in parallel produces exactly
+// the same surfaces, in the same order, as the serial computation -- both with
+// and without the point-pair fallback.
+GTEST_TEST(ProximityEngineTests, ComputeContactSurfacesInParallel) {
+  ProximityEngine<double> engine;
+  EXPECT_EQ(engine.contact_surface_parallelism(), kNoConcurrency);
+
+  const double r = 0.5;
+  // The geometries are ordered as: S S R R S S R R ... so that we get both
+  // soft-rigid pairs (contact surfaces) and rigid-rigid pairs (point pairs).
+  const int N = 16;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, N);
+
+  ProximityProperties soft_properties;
+  AddContactMaterial(1e8, {}, {}, {}, &soft_properties);
+  AddSoftHydroelasticProperties(r / 2, &soft_properties);
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(r, &rigid_properties);
+
+  std::vector<GeometryId> ids;
+  for (const auto& pair : poses) {
+    ids.push_back(pair.first);
+  }
+  std::sort(ids.begin(), ids.end());
+
+  int n = 0;
+  const Sphere sphere{r};
+  std::unordered_set<GeometryId> soft_ids;
+  std::unordered_set<GeometryId> rigid_ids;
+  for (const auto& id : ids) {
+    bool is_soft = (n % 4) < 2;
+    engine.AddDynamicGeometry(sphere, {}, id,
+                              is_soft ? soft_properties : rigid_properties);
+    (is_soft ? soft_ids : rigid_ids).insert(id);
+    ++n;
+  }
+  engine.UpdateWorldPoses(poses);
+
+  vector<ContactSurface<double>> surfaces_serial;
+  vector<PenetrationAsPointPair<double>> points_serial;
+  engine.ComputeContactSurfacesWithFallback(poses, &surfaces_serial,
+                                            &points_serial);
+  ASSERT_EQ(surfaces_serial.size(), N / 2);
+  ASSERT_EQ(points_serial.size(), N / 2);
+
+  engine.set_contact_surface_parallelism(4);
+  EXPECT_EQ(engine.contact_surface_parallelism(), 4);
+
+  vector<ContactSurface<double>> surfaces_parallel;
+  vector<PenetrationAsPointPair<double>> points_parallel;
+  engine.ComputeContactSurfacesWithFallback(poses, &surfaces_parallel,
+                                            &points_parallel);
+  ASSERT_EQ(surfaces_parallel.size(), surfaces_serial.size());
+  ASSERT_EQ(points_parallel.size(), points_serial.size());
+  for (size_t i = 0; i < surfaces_serial.size(); ++i) {
+    EXPECT_EQ(surfaces_parallel[i].id_M(), surfaces_serial[i].id_M());
+    EXPECT_EQ(surfaces_parallel[i].id_N(), surfaces_serial[i].id_N());
+    EXPECT_TRUE(surfaces_parallel[i].Equal(surfaces_serial[i]));
+  }
+  for (size_t i = 0; i < points_serial.size(); ++i) {
+    EXPECT_EQ(points_parallel[i].id_A, points_serial[i].id_A);
+    EXPECT_EQ(points_parallel[i].id_B, points_serial[i].id_B);
+  }
+
+  // Without the fallback, the soft-soft and rigid-rigid pairs must be filtered
+  // out so that only the soft-rigid pairs remain.
+  engine.ExcludeCollisionsWithin(soft_ids, {});
+  engine.ExcludeCollisionsWithin(rigid_ids, {});
+  engine.set_contact_surface_parallelism(kNoConcurrency);
+  const auto results_serial = engine.ComputeContactSurfaces(poses);
+  engine.set_contact_surface_parallelism(kUseHardwareConcurrency);
+  const auto results_parallel = engine.ComputeContactSurfaces(poses);
+  ASSERT_EQ(results_serial.size(), N / 2);
+  ASSERT_EQ(results_parallel.size(), results_serial.size());
+  for (size_t i = 0; i < results_serial.size(); ++i) {
+    EXPECT_EQ(results_parallel[i].id_M(), results_serial[i].id_M());
+    EXPECT_EQ(results_parallel[i].id_N(), results_serial[i].id_N());
+    EXPECT_TRUE(results_parallel[i].Equal(results_serial[i]));
+  }
+
+  // The setting survives copying and scalar conversion.
+  ProximityEngine<double> copy(engine);
+  EXPECT_EQ(copy.contact_surface_parallelism(), kUseHardwareConcurrency);
+  EXPECT_EQ(engine.ToAutoDiffXd()->contact_surface_parallelism(),
+            kUseHardwareConcurrency);
+
+  // Invalid values are rejected.
+  EXPECT_THROW(engine.set_contact_surface_parallelism(0), std::exception);
+  EXPECT_THROW(engine.set_contact_surface_parallelism(-2), std::exception);
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
@@ -119,6 +119,53 @@ int BsplineBasis<T>::FindContainingInterval(const T& parameter_value) const {
                                                   less_than_with_cast<T>)));
 }
 
+template <typename T>
+void BsplineBasis<T>::EvaluateActiveBasisFunctions(
+    const std::vector<T>& parameter_values,
+    std::vector<int>* first_active_indices, MatrixX<T>* values) const {
+  DRAKE_THROW_UNLESS(first_active_indices != nullptr);
+  DRAKE_THROW_UNLESS(values != nullptr);
+  const std::vector<T>& t = knots();
+  const int k = order();
+  const int num_values = static_cast<int>(parameter_values.size());
+  first_active_indices->resize(num_values);
+  values->resize(k, num_values);
+  // The distances from t_bar to the knots on its left and right.
+  std::vector<T> left(k);
+  std::vector<T> right(k);
+  int ell = -1;
+  for (int j = 0; j < num_values; ++j) {
+    const T& t_bar = parameter_values[j];
+    DRAKE_DEMAND(t_bar >= initial_parameter_value());
+    DRAKE_DEMAND(t_bar <= final_parameter_value());
+    /* Reuse the interval of the previous parameter value if t_bar lies in
+    [t[ell], t[ell + 1]) short of the final parameter value (whose interval is
+    the one that ends there); otherwise search for it. */
+    if (ell < 0 || less_than_with_cast(t_bar, t[ell]) ||
+        !less_than_with_cast(t_bar, t[ell + 1]) ||
+        !less_than_with_cast(t_bar, final_parameter_value())) {
+      ell = FindContainingInterval(t_bar);
+    }
+    /* The Cox-de Boor recursion, as in Algorithm A2.2 of Piegl and Tiller,
+    "The NURBS Book". After the iteration for degree d, N(r) is the value of
+    the degree-d basis function with index ell - d + r. */
+    auto N = values->col(j);
+    N(0) = 1.0;
+    for (int d = 1; d < k; ++d) {
+      left[d] = t_bar - t[ell + 1 - d];
+      right[d] = t[ell + d] - t_bar;
+      T saved = 0.0;
+      for (int r = 0; r < d; ++r) {
+        const T temp = N(r) / (right[r + 1] + left[d - r]);
+        N(r) = saved + right[r + 1] * temp;
+        saved = left[d - r] * temp;
+      }
+      N(d) = saved;
+    }
+    (*first_active_indices)[j] = ell - (k - 1);
+  }
+}
+
 template <typename T>
 boolean<T> BsplineBasis<T>::operator==(const BsplineBasis<T>& other) const {
   if (this->order() == other.order() &&
@@ -7,6 +7,7 @@
 #include "drake/common/drake_bool.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/name_value.h"
 #include "drake/math/knot_vector_type.h"
 
@@ -179,6 +180,27 @@ class BsplineBasis final {
     return p.front();
   }
 
+  /** Evaluates, at each of the given `parameter_values`, the order() basis
+  functions that may be non-zero there (see
+  ComputeActiveBasisFunctionIndices()). A curve can then be evaluated at all
+  of the parameter values as a weighted sum of its control points, without the
+  intermediate control points that EvaluateCurve() allocates for each
+  parameter value. When consecutive parameter values lie in the same knot
+  interval (e.g., when they are sorted), the interval is reused rather than
+  searched for again.
+  @param parameter_values Parameter values at which to evaluate the basis.
+  @param[out] first_active_indices Resized to parameter_values.size(); element
+  `j` is the index of the first active basis function at
+  `parameter_values[j]`.
+  @param[out] values Resized to order() × parameter_values.size(); element
+  (r, j) is the value of basis function `first_active_indices[j] + r` at
+  `parameter_values[j]`.
+  @pre parameter_value ≥ initial_parameter_value() for each parameter_value
+  @pre parameter_value ≤ final_parameter_value() for each parameter_value */
+  void EvaluateActiveBasisFunctions(const std::vector<T>& parameter_values,
+                                    std::vector<int>* first_active_indices,
+                                    MatrixX<T>* values) const;
+
   /** Returns the value of the `i`-th basis function evaluated at
   `parameter_value`. */
   T EvaluateBasisFunctionI(int i, const T& parameter_value) const;
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/extract_double.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/yaml/yaml_read_archive.h"
@@ -279,6 +280,42 @@ TYPED_TEST(BsplineBasisTests, EvaluateBasisFunctionIScipyComparison) {
   }
 }
 
+// Verifies that EvaluateActiveBasisFunctions() agrees with
+// ComputeActiveBasisFunctionIndices() and EvaluateBasisFunctionI(), for sorted
+// and unsorted parameter values, including repeated knots and the ends.
+TYPED_TEST(BsplineBasisTests, EvaluateActiveBasisFunctionsTest) {
+  using T = TypeParam;
+  const int order = 4;
+  const std::vector<T> knots{0, 0, 0, 0, 0.2, 0.5, 0.5, 0.7, 1, 1, 1, 1};
+  const BsplineBasis<T> basis{order, knots};
+  std::vector<T> parameter_values;
+  for (int i = 0; i <= 40; ++i) parameter_values.push_back(i / 40.0);
+  parameter_values.push_back(0.5);
+  parameter_values.push_back(0.1);
+  parameter_values.push_back(1.0);
+  parameter_values.push_back(0.0);
+
+  std::vector<int> first_active_indices;
+  MatrixX<T> values;
+  basis.EvaluateActiveBasisFunctions(parameter_values, &first_active_indices,
+                                     &values);
+  ASSERT_EQ(first_active_indices.size(), parameter_values.size());
+  ASSERT_EQ(values.rows(), order);
+  ASSERT_EQ(values.cols(), static_cast<int>(parameter_values.size()));
+  for (int j = 0; j < static_cast<int>(parameter_values.size()); ++j) {
+    const T& parameter_value = parameter_values[j];
+    const std::vector<int> active_indices =
+        basis.ComputeActiveBasisFunctionIndices(parameter_value);
+    EXPECT_EQ(first_active_indices[j], active_indices.front());
+    for (int r = 0; r < order; ++r) {
+      EXPECT_NEAR(ExtractDoubleOrThrow(values(r, j)),
+                  ExtractDoubleOrThrow(basis.EvaluateBasisFunctionI(
+                      first_active_indices[j] + r, parameter_value)),
+                  1e-15);
+    }
+  }
+}
+
 // Tests that {initial,final}_parameter_value() behave as expected.
 TYPED_TEST(BsplineBasisTests, InitialAndFinalParameterValueTest) {
   using T = TypeParam;
@@ -5,14 +5,12 @@
 namespace drake {
 namespace multibody {
 namespace internal {
-void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
-                             const systems::Context<double>& context,
-                             const Frame<double>& frameA,
-                             const Frame<double>& frameB,
-                             const Eigen::Vector3d& p_ACa, double distance,
-                             const Eigen::Vector3d& nhat_BA_W,
-                             const Eigen::Ref<const AutoDiffVecXd>& q,
-                             AutoDiffXd* distance_autodiff) {
+Eigen::RowVectorXd CalcDistanceGradient(const MultibodyPlant<double>& plant,
+                                        const systems::Context<double>& context,
+                                        const Frame<double>& frameA,
+                                        const Frame<double>& frameB,
+                                        const Eigen::Vector3d& p_ACa,
+                                        const Eigen::Vector3d& nhat_BA_W) {
   // Derivation to compute the gradient of the signed distance function w.r.t q:
   // The distance is
   // d = n̂_BA_Wᵀ * (p_WCa - p_WCb)             (1)
@@ -36,7 +34,19 @@ void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
   plant.CalcJacobianTranslationalVelocity(context, JacobianWrtVariable::kQDot,
                                           frameA, p_ACa, frameB,
                                           plant.world_frame(), &Jq_v_BCa_W);
-  const Eigen::RowVectorXd ddistance_dq = nhat_BA_W.transpose() * Jq_v_BCa_W;
+  return nhat_BA_W.transpose() * Jq_v_BCa_W;
+}
+
+void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
+                             const systems::Context<double>& context,
+                             const Frame<double>& frameA,
+                             const Frame<double>& frameB,
+                             const Eigen::Vector3d& p_ACa, double distance,
+                             const Eigen::Vector3d& nhat_BA_W,
+                             const Eigen::Ref<const AutoDiffVecXd>& q,
+                             AutoDiffXd* distance_autodiff) {
+  const Eigen::RowVectorXd ddistance_dq =
+      CalcDistanceGradient(plant, context, frameA, frameB, p_ACa, nhat_BA_W);
   distance_autodiff->value() = distance;
   distance_autodiff->derivatives() =
       ddistance_dq * math::autoDiffToGradientMatrix(q);
@@ -6,6 +6,29 @@
 namespace drake {
 namespace multibody {
 namespace internal {
+/**
+ * Computes the gradient of the signed distance d between geometry A and B
+ * w.r.t the generalized position q of @p plant, namely
+ * ∂d/∂q = n̂_BA_Wᵀ * ∂p_CbCa_W/∂q, where ∂p_CbCa_W/∂q is the Jacobian of the
+ * witness point Ca in frame B. It does not differentiate through the geometry
+ * queries.
+ * @param plant The plant for which the distance is computed.
+ * @param context The context containing the generalized position q.
+ * @param frameA The frame to which geometry A is attached.
+ * @param frameB The frame to which geometry B is attached.
+ * @param p_ACa The position of the witness point Ca measured and expressed in
+ * frame A.
+ * @param nhat_BA_W The unit length vector representing the gradient of the
+ * signed distance field to geometry B, expressed in the world frame.
+ * @retval ddistance_dq A row vector of size plant.num_positions().
+ */
+Eigen::RowVectorXd CalcDistanceGradient(const MultibodyPlant<double>& plant,
+                                        const systems::Context<double>& context,
+                                        const Frame<double>& frameA,
+                                        const Frame<double>& frameB,
+                                        const Eigen::Vector3d& p_ACa,
+                                        const Eigen::Vector3d& nhat_BA_W);
+
 /**
  * @param plant The plant for which the distance is computed.
  * @param context The context containing the generalized position for computing
@@ -0,0 +1,117 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_batch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include "drake/multibody/inverse_kinematics/unit_quaternion_constraint.h"
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+}  // namespace
+
+InverseKinematicsBatch::InverseKinematicsBatch(
+    const MultibodyPlant<double>& plant, bool with_joint_limits)
+    : plant_(plant), with_joint_limits_(with_joint_limits) {}
+
+InverseKinematicsBatch::InverseKinematicsBatch(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context, bool with_joint_limits)
+    : plant_(plant),
+      with_joint_limits_(with_joint_limits),
+      root_context_(root_context.Clone()) {
+  // Fail fast if the plant is not part of this context.
+  plant_.GetMyContextFromRoot(*root_context_);
+}
+
+InverseKinematicsBatch::~InverseKinematicsBatch() = default;
+
+void InverseKinematicsBatch::set_num_parallel_executions(
+    int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
+  num_parallel_executions_ = num_parallel_executions;
+}
+
+InverseKinematicsBatchResult InverseKinematicsBatch::Solve(
+    int num_targets, const ProblemSetup& setup,
+    const std::optional<solvers::SolverOptions>& solver_options) {
+  DRAKE_THROW_UNLESS(num_targets >= 0);
+  const Clock::time_point start = Clock::now();
+  InverseKinematicsBatchResult batch_result;
+  batch_result.results.resize(num_targets);
+  batch_result.solve_times.resize(num_targets);
+
+  const int num_threads = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions_, num_targets);
+  while (static_cast<int>(contexts_.size()) < num_threads) {
+    contexts_.push_back(root_context_ ? root_context_->Clone()
+                                      : plant_.CreateDefaultContext());
+  }
+
+  // The problem of each parallel execution, which is populated by `setup`
+  // when the execution solves its first target, and then reused.
+  struct Problem {
+    std::unique_ptr<InverseKinematics> ik;
+    TargetUpdate update;
+    // The initial guess set by `setup`.
+    Eigen::VectorXd initial_guess;
+  };
+  std::vector<Problem> problems(num_threads);
+
+  drake::internal::ParallelFor(
+      num_targets, num_threads, [&](int thread_index, int target_index) {
+        const Clock::time_point target_start = Clock::now();
+        Problem& problem = problems[thread_index];
+        if (problem.ik == nullptr) {
+          systems::Context<double>* context = contexts_[thread_index].get();
+          if (root_context_) {
+            context = &plant_.GetMyMutableContextFromRoot(context);
+          }
+          auto ik = std::make_unique<InverseKinematics>(plant_, context,
+                                                        with_joint_limits_);
+          if (!root_context_) {
+            // Matches InverseKinematics(plant, with_joint_limits).
+            AddUnitQuaternionConstraintOnPlant(plant_, ik->q(),
+                                               ik->get_mutable_prog());
+          }
+          problem.update = setup(ik.get());
+          DRAKE_THROW_UNLESS(problem.update != nullptr);
+          problem.initial_guess = ik->prog().initial_guess();
+          problem.ik = std::move(ik);
+        } else {
+          problem.ik->get_mutable_prog()->SetInitialGuessForAllVariables(
+              problem.initial_guess);
+        }
+        problem.update(target_index, problem.ik.get());
+        batch_result.results[target_index] =
+            solvers::Solve(problem.ik->prog(), std::nullopt, solver_options);
+        batch_result.solve_times[target_index] = SecondsSince(target_start);
+      });
+
+  for (const auto& result : batch_result.results) {
+    if (result.is_success()) {
+      ++batch_result.num_successes;
+    }
+  }
+  const std::vector<double>& times = batch_result.solve_times;
+  if (num_targets > 0) {
+    batch_result.total_solve_time =
+        std::accumulate(times.begin(), times.end(), 0.0);
+    batch_result.min_solve_time = *std::min_element(times.begin(), times.end());
+    batch_result.max_solve_time = *std::max_element(times.begin(), times.end());
+  }
+  batch_result.wall_time = SecondsSince(start);
+  return batch_result;
+}
+}  // namespace multibody
+}  // namespace drake
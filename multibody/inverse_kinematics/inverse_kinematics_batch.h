@@ -0,0 +1,165 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace multibody {
+/**
+ * The results of InverseKinematicsBatch::Solve().
+ */
+struct InverseKinematicsBatchResult {
+  /** The result of each inverse kinematics problem, indexed by the target. */
+  std::vector<solvers::MathematicalProgramResult> results;
+  /** The time (in seconds) taken to set up and solve each problem, indexed by
+   * the target. */
+  std::vector<double> solve_times;
+  /** The number of problems that were solved successfully. */
+  int num_successes{0};
+  /** The wall clock time (in seconds) taken by the whole batch. */
+  double wall_time{0};
+  /** The sum of solve_times. With more than one parallel execution, it
+   * exceeds wall_time. */
+  double total_solve_time{0};
+  /** The shortest of solve_times, or 0 for an empty batch. */
+  double min_solve_time{0};
+  /** The longest of solve_times, or 0 for an empty batch. */
+  double max_solve_time{0};
+};
+
+/**
+ * Solves many inverse kinematics problems on the same MultibodyPlant, e.g.,
+ * the same constraints with a different target posture of the end effector
+ * per problem, optionally in parallel.
+ *
+ * The problems share their structure, and differ only in data that depends
+ * on the target, such as the bounds of a constraint and the initial guess.
+ * Each parallel execution therefore constructs one InverseKinematics, which a
+ * user function populates once with the costs and constraints, and then
+ * adapts that program to each target that it solves, without constructing
+ * new costs or constraints. Rather than creating a new plant context for
+ * each problem (as constructing an InverseKinematics from the plant alone
+ * does), every parallel execution clones one context; the contexts are kept
+ * across calls to Solve().
+ *
+ * @code
+ * InverseKinematicsBatch batch(plant);
+ * batch.set_num_parallel_executions(kUseHardwareConcurrency);
+ * const InverseKinematicsBatchResult batch_result = batch.Solve(
+ *     p_WG_targets.size(), [&](InverseKinematics* ik) {
+ *       auto position = std::make_shared<PositionConstraint>(
+ *           &plant, plant.world_frame(), p_WG_targets[0], p_WG_targets[0],
+ *           gripper_frame, Eigen::Vector3d::Zero(),
+ *           ik->get_mutable_context());
+ *       ik->get_mutable_prog()->AddConstraint(position, ik->q());
+ *       ik->get_mutable_prog()->SetInitialGuess(ik->q(), q_nominal);
+ *       return [&, position](int i, InverseKinematics*) {
+ *         position->set_bounds(p_WG_targets[i], p_WG_targets[i]);
+ *       };
+ *     });
+ * @endcode
+ *
+ * The functions may only access the InverseKinematics they are given, the
+ * costs and constraints of that problem, and data that is safe to read
+ * concurrently. The problems are solved with solvers::Solve(); when more than
+ * one parallel execution is used, the solver that it chooses must support
+ * concurrent calls on different programs.
+ */
+class InverseKinematicsBatch {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(InverseKinematicsBatch)
+
+  /**
+   * Adapts the problem populated by a ProblemSetup to the target
+   * `target_index`, e.g., by changing the bounds of its target-dependent
+   * constraints or its initial guess. Before it is called, the initial guess
+   * of `ik->prog()` is restored to the one set by the ProblemSetup, while all
+   * other changes made for previous targets are kept; it must therefore set
+   * every value that depends on the target.
+   */
+  using TargetUpdate =
+      std::function<void(int target_index, InverseKinematics* ik)>;
+
+  /**
+   * Adds the costs and constraints that all problems share to `ik`, and
+   * optionally sets the initial guess of `ik->prog()`. Returns the
+   * TargetUpdate that adapts `ik` to each target. It is called once per
+   * parallel execution in each call to Solve().
+   */
+  using ProblemSetup = std::function<TargetUpdate(InverseKinematics* ik)>;
+
+  /**
+   * Constructs a batch for a MultibodyPlant. Each parallel execution creates
+   * its own context for @p plant, and every problem is constructed as
+   * InverseKinematics(plant, with_joint_limits) is, including the unit
+   * quaternion constraints on the floating bodies.
+   * @note As with that constructor, the problems do not permit collision
+   * related constraints.
+   */
+  explicit InverseKinematicsBatch(const MultibodyPlant<double>& plant,
+                                  bool with_joint_limits = true);
+
+  /**
+   * Constructs a batch for a MultibodyPlant that is part of a Diagram, so
+   * that the problems permit collision related constraints (like
+   * InverseKinematics::AddMinimumDistanceConstraint()). Each parallel
+   * execution clones @p root_context, and every problem is constructed as
+   * InverseKinematics(plant, plant_context, with_joint_limits) is, with the
+   * plant's context within that clone.
+   * @param root_context The context of the Diagram that contains @p plant.
+   * It is cloned on construction, and need not outlive this object.
+   */
+  InverseKinematicsBatch(const MultibodyPlant<double>& plant,
+                         const systems::Context<double>& root_context,
+                         bool with_joint_limits = true);
+
+  ~InverseKinematicsBatch();
+
+  /**
+   * Solves the problems for the targets 0, ..., num_targets - 1, where
+   * @p setup populates the problem of each parallel execution and the
+   * TargetUpdate that it returns adapts that problem to each target.
+   * @param solver_options The options passed to solvers::Solve() for every
+   * problem, if any.
+   * @throws std::exception if num_targets is negative. If @p setup or a
+   * TargetUpdate throws, the exception is rethrown after all the parallel
+   * executions stop.
+   */
+  InverseKinematicsBatchResult Solve(
+      int num_targets, const ProblemSetup& setup,
+      const std::optional<solvers::SolverOptions>& solver_options =
+          std::nullopt);
+
+  /**
+   * Sets the number of problems that Solve() solves in parallel. It is
+   * kNoConcurrency by default, which solves the problems in order on the
+   * calling thread.
+   * @param num_parallel_executions Either a positive number of threads, or
+   * kUseHardwareConcurrency.
+   * @throws std::exception if @p num_parallel_executions is invalid.
+   */
+  void set_num_parallel_executions(int num_parallel_executions);
+
+  int num_parallel_executions() const { return num_parallel_executions_; }
+
+ private:
+  const MultibodyPlant<double>& plant_;
+  const bool with_joint_limits_;
+  // The context that the contexts of the parallel executions are cloned from,
+  // when the plant is part of a diagram.
+  const std::unique_ptr<systems::Context<double>> root_context_;
+  // The root contexts of the parallel executions.
+  std::vector<std::unique_ptr<systems::Context<double>>> contexts_;
+  int num_parallel_executions_{kNoConcurrency};
+};
+}  // namespace multibody
+}  // namespace drake
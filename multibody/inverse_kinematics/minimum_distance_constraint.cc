@@ -5,6 +5,7 @@
 
 #include <Eigen/Dense>
 
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/distance_constraint_utilities.h"
 #include "drake/multibody/inverse_kinematics/kinematic_constraint_utilities.h"
 
@@ -12,14 +13,12 @@ namespace drake {
 namespace multibody {
 using internal::RefFromPtrOrThrow;
 
-template <typename T, typename S>
-VectorX<S> Distances(const MultibodyPlant<T>& plant,
-                     systems::Context<T>* context,
-                     const Eigen::Ref<const VectorX<S>>& q,
-                     double influence_distance) {
-  internal::UpdateContextConfiguration(context, plant, q);
+namespace {
+template <typename T>
+const geometry::QueryObject<T>& EvalQueryObject(
+    const MultibodyPlant<T>& plant, const systems::Context<T>& context) {
   const auto& query_port = plant.get_geometry_query_input_port();
-  if (!query_port.HasValue(*context)) {
+  if (!query_port.HasValue(context)) {
     throw std::invalid_argument(
         "MinimumDistanceConstraint: Cannot get a valid geometry::QueryObject. "
         "Either the plant geometry_query_input_port() is not properly "
@@ -27,18 +26,88 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
         "incorrect. Please refer to AddMultibodyPlantSceneGraph on connecting "
         "MultibodyPlant to SceneGraph.");
   }
-  const auto& query_object =
-      query_port.template Eval<geometry::QueryObject<T>>(*context);
+  return query_port.template Eval<geometry::QueryObject<T>>(context);
+}
+
+// Collects the distances computed by Distances(), as scalars of type S. Each
+// distance is converted on its own by internal::CalcDistanceDerivatives().
+template <typename T, typename S>
+class DistanceCollector {
+ public:
+  DistanceCollector(int max_num_distances, int)
+      : distances_(max_num_distances) {}
+
+  void Add(const MultibodyPlant<T>& plant, const systems::Context<T>& context,
+           const Frame<T>& frameA, const Frame<T>& frameB,
+           const Vector3<T>& p_ACa, const T& distance,
+           const Vector3<T>& nhat_BA_W, const Eigen::Ref<const VectorX<S>>& q) {
+    internal::CalcDistanceDerivatives(plant, context, frameA, frameB, p_ACa,
+                                      distance, nhat_BA_W, q,
+                                      &distances_(num_distances_++));
+  }
+
+  VectorX<S> Finish(const Eigen::Ref<const VectorX<S>>&) const {
+    return distances_.head(num_distances_);
+  }
+
+ private:
+  VectorX<S> distances_;
+  int num_distances_{0};
+};
+
+// For a MultibodyPlant<double>, the gradient of each distance w.r.t q is
+// assembled from the Jacobian of its witness point, and the chain rule through
+// the derivatives of q is then applied to all the distances with one matrix
+// product, instead of once per distance.
+template <>
+class DistanceCollector<double, AutoDiffXd> {
+ public:
+  DistanceCollector(int max_num_distances, int num_positions)
+      : distances_(max_num_distances),
+        ddistances_dq_(max_num_distances, num_positions) {}
+
+  void Add(const MultibodyPlant<double>& plant,
+           const systems::Context<double>& context,
+           const Frame<double>& frameA, const Frame<double>& frameB,
+           const Eigen::Vector3d& p_ACa, double distance,
+           const Eigen::Vector3d& nhat_BA_W,
+           const Eigen::Ref<const AutoDiffVecXd>&) {
+    distances_(num_distances_) = distance;
+    ddistances_dq_.row(num_distances_) = internal::CalcDistanceGradient(
+        plant, context, frameA, frameB, p_ACa, nhat_BA_W);
+    ++num_distances_;
+  }
+
+  AutoDiffVecXd Finish(const Eigen::Ref<const AutoDiffVecXd>& q) const {
+    return math::initializeAutoDiffGivenGradientMatrix(
+        distances_.head(num_distances_),
+        ddistances_dq_.topRows(num_distances_) *
+            math::autoDiffToGradientMatrix(q));
+  }
+
+ private:
+  Eigen::VectorXd distances_;
+  Eigen::MatrixXd ddistances_dq_;
+  int num_distances_{0};
+};
+
+template <typename T, typename S>
+VectorX<S> Distances(const MultibodyPlant<T>& plant,
+                     systems::Context<T>* context,
+                     const Eigen::Ref<const VectorX<S>>& q,
+                     double influence_distance) {
+  internal::UpdateContextConfiguration(context, plant, q);
+  const geometry::QueryObject<T>& query_object =
+      EvalQueryObject(plant, *context);
+  const geometry::SceneGraphInspector<T>& inspector = query_object.inspector();
 
   const std::vector<geometry::SignedDistancePair<T>> signed_distance_pairs =
       query_object.ComputeSignedDistancePairwiseClosestPoints(
           influence_distance);
-  VectorX<S> distances(signed_distance_pairs.size());
-  int distance_count{0};
+  DistanceCollector<T, S> distances(signed_distance_pairs.size(),
+                                    plant.num_positions());
   for (const auto& signed_distance_pair : signed_distance_pairs) {
     if (signed_distance_pair.distance < influence_distance) {
-      const geometry::SceneGraphInspector<T>& inspector =
-          query_object.inspector();
       const geometry::FrameId frame_A_id =
           inspector.GetFrameId(signed_distance_pair.id_A);
       const geometry::FrameId frame_B_id =
@@ -47,7 +116,7 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
           plant.GetBodyFromFrameId(frame_A_id)->body_frame();
       const Frame<T>& frameB =
           plant.GetBodyFromFrameId(frame_B_id)->body_frame();
-      internal::CalcDistanceDerivatives(
+      distances.Add(
           plant, *context, frameA, frameB,
           // GetPoseInFrame() returns RigidTransform<double> -- we can't
           // multiply across heterogeneous scalar types; so we cast the double
@@ -55,13 +124,12 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
           inspector.GetPoseInFrame(signed_distance_pair.id_A)
                   .template cast<T>() *
               signed_distance_pair.p_ACa,
-          signed_distance_pair.distance, signed_distance_pair.nhat_BA_W, q,
-          &distances(distance_count++));
+          signed_distance_pair.distance, signed_distance_pair.nhat_BA_W, q);
     }
   }
-  distances.resize(distance_count);
-  return distances;
+  return distances.Finish(q);
 }
+}  // namespace
 
 template <typename T>
 void MinimumDistanceConstraint::Initialize(
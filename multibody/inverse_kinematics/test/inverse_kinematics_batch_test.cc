@@ -0,0 +1,143 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_batch.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/inverse_kinematics/position_constraint.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+// The targets are positions of the origin of body1, measured and expressed in
+// the world frame.
+std::vector<Eigen::Vector3d> MakeTargets(int num_targets) {
+  std::vector<Eigen::Vector3d> targets;
+  for (int i = 0; i < num_targets; ++i) {
+    targets.emplace_back(0.1 * i, -0.2 + 0.05 * i, 0.3);
+  }
+  return targets;
+}
+
+// Constrains the origin of body1 to targets[i], counting the calls to the
+// setup in `num_setups`.
+InverseKinematicsBatch::ProblemSetup MakeSetup(
+    const MultibodyPlant<double>& plant,
+    const std::vector<Eigen::Vector3d>& targets,
+    std::atomic<int>* num_setups) {
+  return [&plant, &targets, num_setups](InverseKinematics* ik) {
+    ++(*num_setups);
+    auto position = std::make_shared<PositionConstraint>(
+        &plant, plant.world_frame(), targets[0], targets[0],
+        plant.GetFrameByName("body1"), Eigen::Vector3d::Zero(),
+        ik->get_mutable_context());
+    ik->get_mutable_prog()->AddConstraint(position, ik->q());
+    ik->get_mutable_prog()->SetInitialGuess(ik->q().head<4>(),
+                                            Eigen::Vector4d(1, 0, 0, 0));
+    ik->get_mutable_prog()->SetInitialGuess(ik->q().segment<4>(7),
+                                            Eigen::Vector4d(1, 0, 0, 0));
+    return [&targets, position](int i, InverseKinematics*) {
+      position->set_bounds(targets[i], targets[i]);
+    };
+  };
+}
+
+void CheckResult(const InverseKinematicsBatchResult& batch_result,
+                 const std::vector<Eigen::Vector3d>& targets) {
+  const int num_targets = targets.size();
+  ASSERT_EQ(static_cast<int>(batch_result.results.size()), num_targets);
+  ASSERT_EQ(static_cast<int>(batch_result.solve_times.size()), num_targets);
+  EXPECT_EQ(batch_result.num_successes, num_targets);
+  const double tol = 1E-6;
+  for (int i = 0; i < num_targets; ++i) {
+    const solvers::MathematicalProgramResult& result = batch_result.results[i];
+    EXPECT_TRUE(result.is_success());
+    // The decision variables are the generalized positions of the plant.
+    EXPECT_TRUE(CompareMatrices(result.get_x_val().segment<3>(4), targets[i],
+                                tol));
+    EXPECT_GE(batch_result.solve_times[i], batch_result.min_solve_time);
+    EXPECT_LE(batch_result.solve_times[i], batch_result.max_solve_time);
+  }
+  EXPECT_GE(batch_result.total_solve_time, batch_result.max_solve_time);
+  EXPECT_GT(batch_result.wall_time, 0);
+}
+
+GTEST_TEST(InverseKinematicsBatchTest, Solve) {
+  auto plant = ConstructTwoFreeBodiesPlant<double>();
+  const std::vector<Eigen::Vector3d> targets = MakeTargets(10);
+  std::atomic<int> num_setups{0};
+
+  // Each parallel execution sets up its problem once, and reuses it for all
+  // its targets.
+  InverseKinematicsBatch dut(*plant);
+  EXPECT_EQ(dut.num_parallel_executions(), kNoConcurrency);
+  CheckResult(
+      dut.Solve(targets.size(), MakeSetup(*plant, targets, &num_setups)),
+      targets);
+  EXPECT_EQ(num_setups, 1);
+
+  num_setups = 0;
+  dut.set_num_parallel_executions(3);
+  EXPECT_EQ(dut.num_parallel_executions(), 3);
+  CheckResult(
+      dut.Solve(targets.size(), MakeSetup(*plant, targets, &num_setups)),
+      targets);
+  EXPECT_GE(num_setups, 1);
+  EXPECT_LE(num_setups, 3);
+
+  // An empty batch.
+  num_setups = 0;
+  const InverseKinematicsBatchResult empty =
+      dut.Solve(0, MakeSetup(*plant, targets, &num_setups));
+  EXPECT_TRUE(empty.results.empty());
+  EXPECT_EQ(empty.num_successes, 0);
+  EXPECT_EQ(empty.total_solve_time, 0);
+  EXPECT_EQ(num_setups, 0);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.set_num_parallel_executions(0),
+                              std::exception, ".*num_parallel_executions.*");
+}
+
+GTEST_TEST(InverseKinematicsBatchTest, UpdateThrows) {
+  auto plant = ConstructTwoFreeBodiesPlant<double>();
+  InverseKinematicsBatch dut(*plant);
+  dut.set_num_parallel_executions(2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.Solve(4,
+                [](InverseKinematics*) {
+                  return [](int i, InverseKinematics*) {
+                    if (i == 2) {
+                      throw std::runtime_error("bad target");
+                    }
+                  };
+                }),
+      std::runtime_error, "bad target");
+}
+
+class InverseKinematicsBatchDiagramTest : public TwoFreeBodiesConstraintTest {};
+
+TEST_F(InverseKinematicsBatchDiagramTest, Solve) {
+  const std::vector<Eigen::Vector3d> targets = MakeTargets(6);
+  InverseKinematicsBatch dut(*plant_, *diagram_context_);
+  dut.set_num_parallel_executions(2);
+  std::atomic<int> num_setups{0};
+  CheckResult(
+      dut.Solve(targets.size(), MakeSetup(*plant_, targets, &num_setups)),
+      targets);
+
+  // The context of the plant alone is not the root context.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      (InverseKinematicsBatch(*plant_, *plant_context_)), std::exception,
+      ".*non-root Context.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -157,6 +157,56 @@ TEST_F(TwoFreeSpheresMinimumDistanceTest, QuadraticallySmoothedHingePenalty) {
   CheckConstraintEval(constraint);
 }
 
+// On a MultibodyPlant<double>, the gradient is assembled from the Jacobians of
+// the witness points, with one product through the derivatives of q; it must
+// match the gradient that AutoDiffXd computes through MultibodyPlant and
+// SceneGraph on a MultibodyPlant<AutoDiffXd>.
+TEST_F(TwoFreeSpheresMinimumDistanceTest, GradientMatchesAutoDiffPlant) {
+  const double minimum_distance(0.1);
+  const MinimumDistanceConstraint constraint_double(
+      plant_double_, minimum_distance, plant_context_double_);
+  const MinimumDistanceConstraint constraint_autodiff(
+      plant_autodiff_, minimum_distance, plant_context_autodiff_);
+
+  const Eigen::Vector3d p_WB1(0.1, 0.2, 0.3);
+  const Eigen::Vector3d direction = Eigen::Vector3d(1, 2, 2).normalized();
+  Eigen::MatrixXd dq(kNumPositionsForTwoFreeBodies, 3);
+  for (int i = 0; i < kNumPositionsForTwoFreeBodies; ++i) {
+    dq(i, 0) = std::sin(i + 1);
+    dq(i, 1) = 2 * i - 1;
+    dq(i, 2) = std::cos(0.5 * i);
+  }
+  // The spheres are separated by less than the minimum distance, by a
+  // distance between the minimum and the influence distance, and they
+  // collide.
+  for (const double separation :
+       {0.5 * minimum_distance,
+        0.5 * (constraint_double.influence_distance() + minimum_distance),
+        -0.05}) {
+    const Eigen::Vector3d p_WB2 =
+        p_WB1 + (radius1_ + radius2_ + separation) * direction;
+    Eigen::VectorXd q(kNumPositionsForTwoFreeBodies);
+    q << QuaternionToVectorWxyz(
+             Eigen::Quaterniond(Eigen::AngleAxisd(0.3, direction))),
+        p_WB1, QuaternionToVectorWxyz(Eigen::Quaterniond(0.5, 0.5, -0.5, 0.5)),
+        p_WB2;
+    const AutoDiffVecXd q_autodiff =
+        math::initializeAutoDiffGivenGradientMatrix(q, dq);
+    AutoDiffVecXd y_double_plant, y_autodiff_plant;
+    constraint_double.Eval(q_autodiff, &y_double_plant);
+    constraint_autodiff.Eval(q_autodiff, &y_autodiff_plant);
+    ASSERT_EQ(y_double_plant(0).derivatives().size(), 3);
+    EXPECT_GT(y_double_plant(0).derivatives().norm(), 0);
+    EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_double_plant),
+                                math::autoDiffToValueMatrix(y_autodiff_plant),
+                                1E-12));
+    EXPECT_TRUE(
+        CompareMatrices(math::autoDiffToGradientMatrix(y_double_plant),
+                        math::autoDiffToGradientMatrix(y_autodiff_plant),
+                        1E-10));
+  }
+}
+
 GTEST_TEST(MinimumDistanceConstraintTest,
            MultibodyPlantWithouthGeometrySource) {
   auto plant = ConstructTwoFreeBodiesPlant<double>();
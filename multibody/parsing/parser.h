@@ -13,6 +13,16 @@ namespace multibody {
 
 /// Parses SDF and URDF input files into a MultibodyPlant and (optionally) a
 /// SceneGraph.
+///
+/// When the `DRAKE_MESH_CACHE_DIR` environment variable names a directory,
+/// the rigid hydroelastic representations of the Mesh and Convex collision
+/// geometries registered with the SceneGraph (the surface meshes read from
+/// their .obj files, and the bounding volume hierarchies built on them) are
+/// stored in that directory. Later processes that load the same (unchanged)
+/// files read those results back from disk instead of recomputing them. Cache
+/// entries are keyed by file content, so edited files are picked up
+/// automatically; the directory may be shared by concurrent processes and
+/// deleted at any time.
 class Parser final {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Parser)
@@ -0,0 +1,148 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/plant/tamsi_solver.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+/* @defgroup tamsi_solver_benchmarks TAMSI Solver Benchmarks
+ @ingroup multibody
+
+ The benchmark compares the wall time of TamsiSolver::SolveWithGuess() with
+ the dense and the block sparse factorization of the Newton-Raphson Jacobian
+ (see TamsiSolverParameters::use_block_sparse_factorization) as the number of
+ bodies in the scene grows. The problem emulates a bin of free bodies resting
+ on the ground: each body has six generalized velocities, a diagonal block in
+ the mass matrix and a contact point with the ground. Bodies are arranged in
+ small piles of kBodiesPerPile bodies, where each body also touches the next
+ body in its pile. Contact Jacobians are random but fixed across runs.
+
+ Arguments include:
+ - __bodies__: The number of free bodies in the scene.
+ - __block sparse__: 0 for the dense path, 1 for the block sparse path.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //multibody/plant/benchmarking:tamsi_solver_benchmark
+ ```
+
+ <h2>Interpreting the benchmark</h2>
+
+ The cost of the dense path grows as O(nv³) with the number of generalized
+ velocities nv while the block sparse path grows linearly with the number of
+ piles. For a handful of bodies both paths are comparable; the gap quickly
+ widens as bodies are added. The `iterations/solve` counter reports the number
+ of Newton-Raphson iterations. Both paths compute the same iterates up to
+ round-off, which can occasionally change the count by one. */
+
+constexpr int kBodiesPerPile = 4;
+constexpr double kTimeStep = 1.0e-3;
+
+class TamsiSolverBenchmark : public benchmark::Fixture {
+ public:
+  using benchmark::Fixture::SetUp;
+  void SetUp(const benchmark::State& state) override {
+    const int num_bodies = state.range(0);
+    nv_ = 6 * num_bodies;
+    int nc = num_bodies;  // One contact with the ground per body.
+    for (int b = 0; b < num_bodies; ++b) {
+      if (b % kBodiesPerPile != kBodiesPerPile - 1 && b + 1 < num_bodies) ++nc;
+    }
+
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    auto random_row = [&](int body) {
+      VectorX<double> row = VectorX<double>::Zero(nv_);
+      for (int i = 0; i < 6; ++i) row(6 * body + i) = distribution(generator);
+      return row;
+    };
+
+    M_ = MatrixX<double>::Zero(nv_, nv_);
+    Jn_ = MatrixX<double>::Zero(nc, nv_);
+    Jt_ = MatrixX<double>::Zero(2 * nc, nv_);
+    v0_ = VectorX<double>::Zero(nv_);
+    VectorX<double> tau = VectorX<double>::Zero(nv_);
+    int ic = 0;
+    for (int b = 0; b < num_bodies; ++b) {
+      // A random SPD rotational inertia and unit mass.
+      Matrix3<double> A;
+      for (int i = 0; i < 9; ++i) A(i) = distribution(generator);
+      M_.block<3, 3>(6 * b, 6 * b) =
+          A * A.transpose() + Matrix3<double>::Identity();
+      M_.block<3, 3>(6 * b + 3, 6 * b + 3) = Matrix3<double>::Identity();
+      v0_(6 * b + 3) = 0.1 * distribution(generator);  // Some sliding.
+      v0_(6 * b + 5) = -0.1;  // Falling towards the ground.
+      tau(6 * b + 5) = -9.81;
+
+      // Contact with the ground.
+      Jn_.row(ic) = random_row(b).transpose();
+      Jt_.row(2 * ic) = random_row(b).transpose();
+      Jt_.row(2 * ic + 1) = random_row(b).transpose();
+      ++ic;
+
+      // Contact with the next body in the pile.
+      if (b % kBodiesPerPile != kBodiesPerPile - 1 && b + 1 < num_bodies) {
+        Jn_.row(ic) = (random_row(b + 1) - random_row(b)).transpose();
+        Jt_.row(2 * ic) = (random_row(b + 1) - random_row(b)).transpose();
+        Jt_.row(2 * ic + 1) = (random_row(b + 1) - random_row(b)).transpose();
+        ++ic;
+      }
+    }
+    DRAKE_DEMAND(ic == nc);
+
+    p_star_ = M_ * v0_ + kTimeStep * tau;
+    mu_ = VectorX<double>::Constant(nc, 0.5);
+    stiffness_ = VectorX<double>::Constant(nc, 1.0e5);
+    dissipation_ = VectorX<double>::Constant(nc, 0.1);
+    fn0_ = VectorX<double>::Constant(nc, 10.0);
+  }
+
+ protected:
+  int nv_{0};
+  MatrixX<double> M_, Jn_, Jt_;
+  VectorX<double> v0_, p_star_, mu_, stiffness_, dissipation_, fn0_;
+};
+
+BENCHMARK_DEFINE_F(TamsiSolverBenchmark, SolveWithGuess)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  TamsiSolver<double> solver(nv_);
+  TamsiSolverParameters parameters;
+  parameters.use_block_sparse_factorization = state.range(1) != 0;
+  solver.set_solver_parameters(parameters);
+  solver.SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn0_,
+                                     &stiffness_, &dissipation_, &mu_);
+  int num_iterations = 0;
+  for (auto _ : state) {
+    const TamsiSolverResult result = solver.SolveWithGuess(kTimeStep, v0_);
+    if (result != TamsiSolverResult::kSuccess) {
+      state.SkipWithError("TamsiSolver failed to converge.");
+      break;
+    }
+    num_iterations = solver.get_iteration_statistics().num_iterations;
+  }
+  state.counters["iterations/solve"] = num_iterations;
+}
+BENCHMARK_REGISTER_F(TamsiSolverBenchmark, SolveWithGuess)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgNames({"bodies", "block_sparse"})
+    ->Args({4, 0})     // 4 bodies, dense.
+    ->Args({4, 1})     // 4 bodies, block sparse.
+    ->Args({16, 0})    // 16 bodies, dense.
+    ->Args({16, 1})    // 16 bodies, block sparse.
+    ->Args({64, 0})    // 64 bodies, dense.
+    ->Args({64, 1})    // 64 bodies, block sparse.
+    ->Args({128, 0})   // 128 bodies, dense.
+    ->Args({128, 1});  // 128 bodies, block sparse.
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1101,22 +1101,24 @@ void MultibodyPlant<T>::EstimatePointContactParameters(
 }
 
 template <typename T>
-std::vector<PenetrationAsPointPair<T>>
-MultibodyPlant<T>::CalcPointPairPenetrations(
-    const systems::Context<T>& context) const {
+void MultibodyPlant<T>::CalcPointPairPenetrations(
+    const systems::Context<T>& context,
+    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
   this->ValidateContext(context);
+  DRAKE_DEMAND(point_pairs != nullptr);
   if (num_collision_geometries() > 0) {
     const auto& query_object = EvalGeometryQueryInput(context);
-    return query_object.ComputePointPairPenetration();
+    query_object.ComputePointPairPenetration(point_pairs);
+    return;
   }
-  return std::vector<PenetrationAsPointPair<T>>();
+  point_pairs->clear();
 }
 
 // Specialize this function so that symbolic::Expression throws an error.
 template <>
-std::vector<PenetrationAsPointPair<symbolic::Expression>>
-MultibodyPlant<symbolic::Expression>::CalcPointPairPenetrations(
-    const systems::Context<symbolic::Expression>&) const {
+void MultibodyPlant<symbolic::Expression>::CalcPointPairPenetrations(
+    const systems::Context<symbolic::Expression>&,
+    std::vector<PenetrationAsPointPair<symbolic::Expression>>*) const {
   throw std::logic_error(
       "This method doesn't support T = symbolic::Expression.");
 }
@@ -1847,12 +1849,14 @@ void MultibodyPlant<symbolic::Expression>::CalcHydroelasticWithFallback(
 }
 
 template <typename T>
-std::vector<internal::DiscreteContactPair<T>>
-MultibodyPlant<T>::CalcDiscreteContactPairs(
-    const systems::Context<T>& context) const {
+void MultibodyPlant<T>::CalcDiscreteContactPairs(
+    const systems::Context<T>& context,
+    std::vector<internal::DiscreteContactPair<T>>* contact_pairs) const {
   this->ValidateContext(context);
+  DRAKE_DEMAND(contact_pairs != nullptr);
 
-  if (num_collision_geometries() == 0) return {};
+  contact_pairs->clear();
+  if (num_collision_geometries() == 0) return;
 
   // Only numeric values are supported. We detect that T is a Drake numeric type
   // using scalar_predicate::is_bool. That is true for numeric types and false
@@ -1876,8 +1880,7 @@ MultibodyPlant<T>::CalcDiscreteContactPairs(
     const int num_quadrature_pairs = 0;  // to be included next PR.
     const int num_contact_pairs = num_point_pairs + num_quadrature_pairs;
 
-    std::vector<internal::DiscreteContactPair<T>> contact_pairs;
-    contact_pairs.reserve(num_contact_pairs);
+    contact_pairs->reserve(num_contact_pairs);
 
     const auto& query_object = EvalGeometryQueryInput(context);
     const geometry::SceneGraphInspector<T>& inspector =
@@ -1900,14 +1903,12 @@ MultibodyPlant<T>::CalcDiscreteContactPairs(
         // TODO(amcastro-tri): Consider using stiffness weighted location of
         // point C between Ca and Cb.
         const Vector3<T> p_WC = 0.5 * (pair.p_WCa + pair.p_WCb);
-        contact_pairs.push_back(
+        contact_pairs->push_back(
             {pair.id_A, pair.id_B, p_WC, pair.nhat_BA_W, phi0, fn0, k, d});
       }
     }
 
     // TODO(amcastro-tri): fill in hydroelastic quadrature pairs.
-
-    return contact_pairs;
   } else {
     drake::unused(context);
     throw std::domain_error(fmt::format("This method doesn't support T = {}.",
@@ -1965,8 +1966,8 @@ void MultibodyPlant<T>::CalcTamsiResults(
 
   // Compute all contact pairs, including both penetration pairs and quadrature
   // pairs for discrete hydroelastic.
-  const std::vector<internal::DiscreteContactPair<T>> contact_pairs =
-      CalcDiscreteContactPairs(context0);
+  const std::vector<internal::DiscreteContactPair<T>>& contact_pairs =
+      EvalDiscreteContactPairs(context0);
   const int num_contacts = contact_pairs.size();
 
   // Compute normal and tangential velocity Jacobians at t0.
@@ -2578,7 +2579,7 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
         auto& context = dynamic_cast<const Context<T>&>(context_base);
         auto& point_pairs_cache = cache_value->get_mutable_value<
             std::vector<geometry::PenetrationAsPointPair<T>>>();
-        point_pairs_cache = this->CalcPointPairPenetrations(context);
+        this->CalcPointPairPenetrations(context, &point_pairs_cache);
       },
       {this->configuration_ticket()});
   cache_indexes_.point_pairs = point_pairs_cache_entry.cache_index();
@@ -2600,6 +2601,29 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
       {this->configuration_ticket()});
   cache_indexes_.contact_surfaces = contact_surfaces_cache_entry.cache_index();
 
+  // Cache discrete contact pairs. The vector is refilled in place, reusing
+  // its storage from the previous evaluation.
+  auto& discrete_contact_pairs_cache_entry = this->DeclareCacheEntry(
+      std::string("Discrete contact pairs."),
+      []() {
+        return AbstractValue::Make(
+            std::vector<internal::DiscreteContactPair<T>>());
+      },
+      [this](const systems::ContextBase& context_base,
+             AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& discrete_contact_pairs_cache = cache_value->get_mutable_value<
+            std::vector<internal::DiscreteContactPair<T>>>();
+        this->CalcDiscreteContactPairs(context, &discrete_contact_pairs_cache);
+      },
+      // The contact pairs depend on the point pair penetrations (which depend
+      // on the configuration), on the contact parameters, and on the
+      // proximity properties read through the geometry query input port.
+      {this->configuration_ticket(), this->all_parameters_ticket(),
+       this->input_port_ticket(geometry_query_port_)});
+  cache_indexes_.discrete_contact_pairs =
+      discrete_contact_pairs_cache_entry.cache_index();
+
   // Cache contact Jacobians.
   auto& contact_jacobians_cache_entry = this->DeclareCacheEntry(
       std::string("Contact Jacobians Jn(q) and Jt(q)."),
@@ -2609,9 +2633,8 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
         auto& context = dynamic_cast<const Context<T>&>(context_base);
         auto& contact_jacobians_cache =
             cache_value->get_mutable_value<internal::ContactJacobians<T>>();
-        // TODO(amcastro-tri): consider caching contact_pairs.
-        const std::vector<internal::DiscreteContactPair<T>> contact_pairs =
-            CalcDiscreteContactPairs(context);
+        const std::vector<internal::DiscreteContactPair<T>>& contact_pairs =
+            EvalDiscreteContactPairs(context);
         this->CalcNormalAndTangentContactJacobians(
             context, contact_pairs,
             &contact_jacobians_cache.Jn, &contact_jacobians_cache.Jt,
@@ -13,7 +13,9 @@
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -2258,6 +2260,44 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().EvalBodyPoseInWorld(context, body_B);
   }
 
+  /// Computes the poses `X_WB` of all bodies in the world frame W for each of
+  /// a batch of N configurations. This is equivalent to setting each column of
+  /// `q_batch` into a copy of `context` and calling EvalBodyPoseInWorld() for
+  /// every body. It is a parallel wrapper around that computation rather than
+  /// a vectorized kernel: every sample is still evaluated through a Context
+  /// and its cache, but the samples may be spread over several threads, each
+  /// reusing one private Context for all of its samples.
+  ///
+  /// @param[in] context
+  ///   The context supplying the time and parameters of the model. Its state
+  ///   is not used and it is not modified.
+  /// @param[in] q_batch
+  ///   A `num_positions() x N` matrix whose i-th column holds the generalized
+  ///   positions of the i-th sample.
+  /// @param[out] X_WB_batch
+  ///   On output, holds `num_bodies() * N` poses in body-major order; i.e.,
+  ///   the pose of body B for sample i is stored at index
+  ///   `B.index() * N + i`, so that all samples of a body are contiguous.
+  /// @param[in] num_parallel_executions
+  ///   The number of threads to use, or kUseHardwareConcurrency. Defaults to
+  ///   kNoConcurrency (serial evaluation on the calling thread).
+  /// @param[in,out] workspace
+  ///   Optional scratch storage that keeps the per-worker Contexts between
+  ///   calls; see MultibodyBatchWorkspace. If nullptr, the Contexts are
+  ///   created anew for this call.
+  /// @throws std::exception if `X_WB_batch` is nullptr, if `q_batch` does not
+  ///   have num_positions() rows, or if `num_parallel_executions` is invalid.
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<math::RigidTransform<T>>* X_WB_batch,
+      int num_parallel_executions = kNoConcurrency,
+      MultibodyBatchWorkspace<T>* workspace = nullptr) const {
+    this->ValidateContext(context);
+    internal_tree().CalcAllBodyPosesInWorldBatch(
+        context, q_batch, num_parallel_executions, X_WB_batch, workspace);
+  }
+
   /// Evaluate the spatial velocity `V_WB` of a body B in the world frame W.
   /// @param[in] context
   ///   The context storing the state of the model.
@@ -2573,6 +2613,54 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         context, known_vdot, external_forces);
   }
 
+  /// Evaluates CalcInverseDynamics() for each of N states and accelerations.
+  /// Sample i uses the i-th columns of `q_batch`, `v_batch` and
+  /// `known_vdot_batch`, with the time and parameters taken from `context`,
+  /// and the same `external_forces` applied to every sample. This is a
+  /// parallel wrapper rather than a vectorized kernel: each sample goes
+  /// through CalcInverseDynamics() on a private Context of its worker thread.
+  /// With a `workspace` that is reused across calls, the per-sample cost
+  /// does not include allocation.
+  ///
+  /// @param[in] context
+  ///   The context supplying the time and parameters of the model. Its state
+  ///   is not used and it is not modified.
+  /// @param[in] q_batch
+  ///   A `num_positions() x N` matrix of generalized positions.
+  /// @param[in] v_batch
+  ///   A `num_velocities() x N` matrix of generalized velocities.
+  /// @param[in] known_vdot_batch
+  ///   A `num_velocities() x N` matrix of generalized accelerations.
+  /// @param[in] external_forces
+  ///   The forces applied to every sample; see CalcInverseDynamics().
+  /// @param[out] tau_batch
+  ///   A `num_velocities() x N` matrix whose i-th column is set to the
+  ///   generalized forces for the i-th sample.
+  /// @param[in] num_parallel_executions
+  ///   The number of threads to use, or kUseHardwareConcurrency. Defaults to
+  ///   kNoConcurrency (serial evaluation on the calling thread).
+  /// @param[in,out] workspace
+  ///   Optional scratch storage that keeps the per-worker Contexts between
+  ///   calls; see MultibodyBatchWorkspace. If nullptr, the Contexts are
+  ///   created anew for this call.
+  /// @throws std::exception if any argument has the wrong size or if
+  ///   `num_parallel_executions` is invalid.
+  void CalcInverseDynamicsBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const Eigen::Ref<const MatrixX<T>>& v_batch,
+      const Eigen::Ref<const MatrixX<T>>& known_vdot_batch,
+      const MultibodyForces<T>& external_forces,
+      EigenPtr<MatrixX<T>> tau_batch,
+      int num_parallel_executions = kNoConcurrency,
+      MultibodyBatchWorkspace<T>* workspace = nullptr) const {
+    this->ValidateContext(context);
+    DRAKE_DEMAND(tau_batch != nullptr);
+    internal_tree().CalcInverseDynamicsBatch(
+        context, q_batch, v_batch, known_vdot_batch, external_forces,
+        num_parallel_executions, tau_batch, workspace);
+  }
+
   /// Computes the combined force contribution of ForceElement objects in the
   /// model. A ForceElement can apply forces as a spatial force per body or as
   /// generalized forces, depending on the ForceElement model.
@@ -2760,6 +2848,43 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Evaluates CalcMassMatrix() for each of N configurations. Sample i uses
+  /// the i-th column of `q_batch`, with the time and parameters taken from
+  /// `context`. This is a parallel wrapper rather than a vectorized kernel:
+  /// each sample goes through CalcMassMatrix() on a private Context of its
+  /// worker thread.
+  ///
+  /// @param[in] context
+  ///   The context supplying the time and parameters of the model. Its state
+  ///   is not used and it is not modified.
+  /// @param[in] q_batch
+  ///   A `num_positions() x N` matrix of generalized positions.
+  /// @param[out] M_batch
+  ///   A valid (non-null) pointer to a `n x (n⋅N)` matrix, with n the number
+  ///   of generalized velocities. On output, the mass matrix of the i-th sample
+  ///   is stored in the block of columns `[i⋅n, (i+1)⋅n)`.
+  /// @param[in] num_parallel_executions
+  ///   The number of threads to use, or kUseHardwareConcurrency. Defaults to
+  ///   kNoConcurrency (serial evaluation on the calling thread).
+  /// @param[in,out] workspace
+  ///   Optional scratch storage that keeps the per-worker Contexts between
+  ///   calls; see MultibodyBatchWorkspace. If nullptr, the Contexts are
+  ///   created anew for this call.
+  /// @throws std::exception if any argument has the wrong size or if
+  ///   `num_parallel_executions` is invalid.
+  void CalcMassMatrixBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      EigenPtr<MatrixX<T>> M_batch,
+      int num_parallel_executions = kNoConcurrency,
+      MultibodyBatchWorkspace<T>* workspace = nullptr) const {
+    this->ValidateContext(context);
+    DRAKE_DEMAND(M_batch != nullptr);
+    internal_tree().CalcMassMatrixBatch(context, q_batch,
+                                        num_parallel_executions, M_batch,
+                                        workspace);
+  }
+
   /// Computes the bias term `C(q, v)v` containing Coriolis, centripetal, and
   /// gyroscopic effects in the multibody equations of motion: <pre>
   ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
@@ -3764,6 +3889,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     systems::CacheIndex contact_jacobians;
     systems::CacheIndex contact_results;
     systems::CacheIndex contact_surfaces;
+    systems::CacheIndex discrete_contact_pairs;
     systems::CacheIndex generalized_contact_forces_continuous;
     systems::CacheIndex hydro_fallback;
     systems::CacheIndex point_pairs;
@@ -3836,16 +3962,22 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       throw std::domain_error(
           "This method doesn't support T = symbolic::Expression.");
     }
+    // The property names are converted to strings only once, so that the
+    // per-step lookups below do not allocate.
+    static const never_destroyed<std::string> group(
+        geometry::internal::kMaterialGroup);
+    static const never_destroyed<std::string> stiffness(
+        geometry::internal::kPointStiffness);
+    static const never_destroyed<std::string> dissipation(
+        geometry::internal::kHcDissipation);
     const geometry::ProximityProperties* prop =
         inspector.GetProximityProperties(id);
     DRAKE_DEMAND(prop != nullptr);
     return std::pair(prop->template GetPropertyOrDefault<T>(
-                         geometry::internal::kMaterialGroup,
-                         geometry::internal::kPointStiffness,
+                         group.access(), stiffness.access(),
                          penalty_method_contact_parameters_.geometry_stiffness),
                      prop->template GetPropertyOrDefault<T>(
-                         geometry::internal::kMaterialGroup,
-                         geometry::internal::kHcDissipation,
+                         group.access(), dissipation.access(),
                          penalty_method_contact_parameters_.dissipation));
   }
 
@@ -4030,9 +4162,19 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
 
   // Depending on the ContactModel, this method performs point contact and
   // hydroelastic queries and prepares the results in the form of a list of
-  // DiscreteContactPair to be consummed by our discrete solvers.
-  std::vector<internal::DiscreteContactPair<T>> CalcDiscreteContactPairs(
-      const systems::Context<T>& context) const;
+  // DiscreteContactPair to be consummed by our discrete solvers. Any previous
+  // contents of `contact_pairs` are discarded but its storage is reused, so
+  // that the steady-state evaluation of the (cached) pairs does not allocate.
+  void CalcDiscreteContactPairs(
+      const systems::Context<T>& context,
+      std::vector<internal::DiscreteContactPair<T>>* contact_pairs) const;
+
+  // Eval version of the method CalcDiscreteContactPairs().
+  const std::vector<internal::DiscreteContactPair<T>>& EvalDiscreteContactPairs(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(cache_indexes_.discrete_contact_pairs)
+        .template Eval<std::vector<internal::DiscreteContactPair<T>>>(context);
+  }
 
   // Helper method to fill in the ContactResults given the current context when
   // the model is continuous.
@@ -4205,9 +4347,11 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
 
   // Helper method to compute penetration point pairs for a given `context`.
   // Having this as a separate method allows us to control specializations for
-  // different scalar types.
-  std::vector<geometry::PenetrationAsPointPair<T>>
-  CalcPointPairPenetrations(const systems::Context<T>& context) const;
+  // different scalar types. Any previous contents of `point_pairs` are
+  // discarded but its storage is reused.
+  void CalcPointPairPenetrations(
+      const systems::Context<T>& context,
+      std::vector<geometry::PenetrationAsPointPair<T>>* point_pairs) const;
 
   // This helper method combines the friction properties for each pair of
   // contact points in `point_pairs` according to
@@ -4703,9 +4847,10 @@ template <>
 typename MultibodyPlant<symbolic::Expression>::SceneGraphStub&
 MultibodyPlant<symbolic::Expression>::member_scene_graph();
 template <>
-std::vector<geometry::PenetrationAsPointPair<symbolic::Expression>>
-MultibodyPlant<symbolic::Expression>::CalcPointPairPenetrations(
-    const systems::Context<symbolic::Expression>&) const;
+void MultibodyPlant<symbolic::Expression>::CalcPointPairPenetrations(
+    const systems::Context<symbolic::Expression>&,
+    std::vector<geometry::PenetrationAsPointPair<symbolic::Expression>>*)
+    const;
 template <>
 std::vector<CoulombFriction<double>>
 MultibodyPlant<symbolic::Expression>::CalcCombinedFrictionCoefficients(
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -245,6 +246,46 @@ T TalsLimiter<T>::SolveQuadraticForTheSmallestPositiveRoot(
 
 }  // namespace internal
 
+namespace {
+
+// Returns true if `x` is not a structural zero. Used to infer the sparsity
+// pattern of the problem data. For AutoDiffXd we also look at the derivatives
+// so that the partition of the problem into independent blocks is valid for
+// the gradients as well.
+bool IsStructurallyNonZero(double x) { return x != 0.0; }
+
+bool IsStructurallyNonZero(const AutoDiffXd& x) {
+  return x.value() != 0.0 || !x.derivatives().isZero(0.0);
+}
+
+bool IsStructurallyNonZero(const symbolic::Expression& x) {
+  return !symbolic::is_zero(x);
+}
+
+// Returns the representative of the set containing `i` in the disjoint-set
+// forest `parent`, compressing the path along the way.
+int FindRoot(std::vector<int>* parent, int i) {
+  while ((*parent)[i] != i) {
+    (*parent)[i] = (*parent)[(*parent)[i]];
+    i = (*parent)[i];
+  }
+  return i;
+}
+
+// Merges the sets containing `i` and `j`.
+void MergeSets(std::vector<int>* parent, int i, int j) {
+  const int root_i = FindRoot(parent, i);
+  const int root_j = FindRoot(parent, j);
+  // Keep the smallest index as the root so that the result is deterministic.
+  if (root_i < root_j) {
+    (*parent)[root_j] = root_i;
+  } else {
+    (*parent)[root_i] = root_j;
+  }
+}
+
+}  // namespace
+
 template <typename T>
 TamsiSolver<T>::TamsiSolver(int nv) :
     nv_(nv),
@@ -528,10 +569,12 @@ void TamsiSolver<T>::CalcJacobian(
     const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
     EigenPtr<MatrixX<T>> J) const {
   // Problem sizes.
-  const int nv = nv_;  // Number of generalized velocities.
-  const int nc = nc_;  // Number of contact points.
+  const int nv = M.rows();  // Number of generalized velocities.
+  const int nc = Jn.rows();  // Number of contact points.
   // Size of the friction forces vector ft and tangential velocities vector vt.
   const int nf = 2 * nc;
+  DRAKE_ASSERT(Jt.rows() == nf);
+  DRAKE_ASSERT(static_cast<int>(dft_dvt.size()) >= nc);
 
   // Newton-Raphson Jacobian, i.e. the derivative of the residual with
   // respect to the independent variable which, in this case, is the vector
@@ -581,6 +624,153 @@ void TamsiSolver<T>::CalcJacobian(
   }
 }
 
+template <typename T>
+int TamsiSolver<T>::CalcIndependentBlocks() const {
+  const auto M = problem_data_aliases_.M();
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+
+  // Two generalized velocities belong to the same block if they are coupled by
+  // an off-diagonal entry of M or if they both participate in the velocity of
+  // the same contact point. We compute the blocks as the connected components
+  // of this coupling graph using a disjoint-set forest.
+  std::vector<int> parent(nv_);
+  std::iota(parent.begin(), parent.end(), 0);
+  for (int j = 0; j < nv_; ++j) {
+    for (int i = j + 1; i < nv_; ++i) {
+      if (IsStructurallyNonZero(M(i, j)) || IsStructurallyNonZero(M(j, i))) {
+        MergeSets(&parent, i, j);
+      }
+    }
+  }
+  // For each contact point, the first velocity it depends on; -1 if none.
+  std::vector<int> contact_velocity(nc_, -1);
+  for (int ic = 0; ic < nc_; ++ic) {
+    for (int j = 0; j < nv_; ++j) {
+      if (IsStructurallyNonZero(Jn(ic, j)) ||
+          IsStructurallyNonZero(Jt(2 * ic, j)) ||
+          IsStructurallyNonZero(Jt(2 * ic + 1, j))) {
+        if (contact_velocity[ic] < 0) {
+          contact_velocity[ic] = j;
+        } else {
+          MergeSets(&parent, contact_velocity[ic], j);
+        }
+      }
+    }
+  }
+
+  // Number the blocks in order of their smallest velocity index. Since roots
+  // are always the smallest index in their set, the root of a block is visited
+  // before any other of its velocities.
+  std::vector<int> block_of_root(nv_, -1);
+  int num_blocks = 0;
+  for (int i = 0; i < nv_; ++i) {
+    const int root = FindRoot(&parent, i);
+    if (block_of_root[root] < 0) {
+      block_of_root[root] = num_blocks++;
+      if (static_cast<int>(independent_blocks_.size()) < num_blocks) {
+        independent_blocks_.emplace_back();
+      }
+      independent_blocks_[num_blocks - 1].velocities.clear();
+      independent_blocks_[num_blocks - 1].contacts.clear();
+    }
+    independent_blocks_[block_of_root[root]].velocities.push_back(i);
+  }
+  num_independent_blocks_ = num_blocks;
+  // Contact points whose Jacobian rows are identically zero do not contribute
+  // to either the residual or its Jacobian and are not assigned to any block.
+  for (int ic = 0; ic < nc_; ++ic) {
+    if (contact_velocity[ic] < 0) continue;
+    const int root = FindRoot(&parent, contact_velocity[ic]);
+    independent_blocks_[block_of_root[root]].contacts.push_back(ic);
+  }
+
+  // Gather the problem data restricted to each block. This data remains
+  // constant during the Newton-Raphson iterations.
+  for (int b = 0; b < num_blocks; ++b) {
+    IndependentBlock& block = independent_blocks_[b];
+    const int nv_block = block.velocities.size();
+    const int nc_block = block.contacts.size();
+    block.M.resize(nv_block, nv_block);
+    block.Jn.resize(nc_block, nv_block);
+    block.Jt.resize(2 * nc_block, nv_block);
+    for (int j = 0; j < nv_block; ++j) {
+      const int vj = block.velocities[j];
+      for (int i = 0; i < nv_block; ++i) {
+        block.M(i, j) = M(block.velocities[i], vj);
+      }
+      for (int k = 0; k < nc_block; ++k) {
+        const int ic = block.contacts[k];
+        block.Jn(k, j) = Jn(ic, vj);
+        block.Jt(2 * k, j) = Jt(2 * ic, vj);
+        block.Jt(2 * k + 1, j) = Jt(2 * ic + 1, vj);
+      }
+    }
+    block.Gn.resize(nc_block, nv_block);
+    block.dft_dvt.resize(nc_block);
+    block.t_hat.resize(2 * nc_block);
+    block.mu_vt.resize(nc_block);
+    block.J.resize(nv_block, nv_block);
+    block.residual.resize(nv_block);
+    block.Delta_v.resize(nv_block);
+  }
+
+  return num_blocks;
+}
+
+template <typename T>
+bool TamsiSolver<T>::CalcBlockSparseNewtonUpdate(
+    const Eigen::Ref<const MatrixX<T>>& Gn,
+    const std::vector<Matrix2<T>>& dft_dvt,
+    const Eigen::Ref<const VectorX<T>>& t_hat,
+    const Eigen::Ref<const VectorX<T>>& mu_vt,
+    const Eigen::Ref<const VectorX<T>>& residual, double dt,
+    EigenPtr<VectorX<T>> Delta_v) const {
+  DRAKE_ASSERT(Delta_v != nullptr);
+  for (int b = 0; b < num_independent_blocks_; ++b) {
+    IndependentBlock& block = independent_blocks_[b];
+    const int nv_block = block.velocities.size();
+    const int nc_block = block.contacts.size();
+
+    // Gather the current contact quantities for this block.
+    for (int k = 0; k < nc_block; ++k) {
+      const int ic = block.contacts[k];
+      for (int j = 0; j < nv_block; ++j) {
+        block.Gn(k, j) = Gn(ic, block.velocities[j]);
+      }
+      block.dft_dvt[k] = dft_dvt[ic];
+      block.t_hat.template segment<2>(2 * k) =
+          t_hat.template segment<2>(2 * ic);
+      block.mu_vt(k) = mu_vt(ic);
+    }
+    for (int i = 0; i < nv_block; ++i) {
+      block.residual(i) = residual(block.velocities[i]);
+    }
+
+    // Since no contact point couples this block with any other block, the
+    // rows of J for this block's velocities are zero outside of the diagonal
+    // block and the update can be computed independently.
+    CalcJacobian(block.M, block.Jn, block.Jt, block.Gn, block.dft_dvt,
+                 block.t_hat, block.mu_vt, dt, &block.J);
+    if (has_two_way_coupling()) {
+      block.J_lu.compute(block.J);
+      block.Delta_v = block.J_lu.solve(-block.residual);
+    } else {
+      block.J_ldlt.compute(block.J);
+      if (block.J_ldlt.info() != Eigen::Success) {
+        return false;
+      }
+      block.Delta_v = block.J_ldlt.solve(-block.residual);
+    }
+
+    // Scatter this block's update into the full vector.
+    for (int i = 0; i < nv_block; ++i) {
+      (*Delta_v)(block.velocities[i]) = block.Delta_v(i);
+    }
+  }
+  return true;
+}
+
 template <typename T>
 T TamsiSolver<T>::CalcAlpha(
     const Eigen::Ref<const VectorX<T>>& vt,
@@ -669,6 +859,12 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   double vt_error = 2 * v_contact_tolerance;
   double vn_error = 2 * v_contact_tolerance;
 
+  // Partition the problem into independent blocks, if requested. When there
+  // is a single block the dense path is used since it avoids the overhead of
+  // gathering the problem data.
+  const bool use_block_sparse_update =
+      parameters_.use_block_sparse_factorization && CalcIndependentBlocks() > 1;
+
   // Initialize iteration with the guess provided.
   v = v_guess;
 
@@ -701,14 +897,22 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
     // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+    // The block sparse update only computes the diagonal blocks of J.
+    if (!use_block_sparse_update) {
+      CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
+    }
 
     // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
     // Since we are in a non-linear iteration, an approximate cheap solution
     // is probably best.
     // TODO(amcastro-tri): Consider using a matrix-free iterative method to
     // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
+    if (use_block_sparse_update) {
+      if (!CalcBlockSparseNewtonUpdate(Gn, dft_dvt, t_hat, mu_vt, residual, dt,
+                                       &Delta_v)) {
+        return TamsiSolverResult::kLinearSolverFailed;
+      }
+    } else if (has_two_way_coupling()) {
       auto& J_lu = fixed_size_workspace_.mutable_J_lu();
       J_lu.compute(J);  // Update factorization.
       Delta_v = J_lu.solve(-residual);
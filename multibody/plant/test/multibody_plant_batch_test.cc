@@ -0,0 +1,164 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+
+using math::RigidTransformd;
+using multibody::Parser;
+using systems::Context;
+
+namespace multibody {
+namespace {
+
+constexpr double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+
+// Verifies that the batched kinematics and dynamics computations match the
+// corresponding single-context computations sample by sample, for serial and
+// parallel evaluation alike.
+class MultibodyPlantBatchTest : public ::testing::TestWithParam<int> {
+ public:
+  void SetUp() override {
+    const char kArmSdfPath[] =
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_no_collision.sdf";
+    const char kWsg50SdfPath[] =
+        "drake/manipulation/models/wsg_50_description/sdf/schunk_wsg_50.sdf";
+    Parser parser(&plant_);
+    const ModelInstanceIndex arm_model =
+        parser.AddModelFromFile(FindResourceOrThrow(kArmSdfPath));
+    const ModelInstanceIndex gripper_model =
+        parser.AddModelFromFile(FindResourceOrThrow(kWsg50SdfPath));
+    plant_.WeldFrames(plant_.world_frame(),
+                      plant_.GetFrameByName("iiwa_link_0", arm_model));
+    plant_.WeldFrames(plant_.GetFrameByName("iiwa_link_7", arm_model),
+                      plant_.GetFrameByName("body", gripper_model));
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+
+    // All joints are revolute or prismatic, so any q is a valid configuration.
+    q_batch_ = MatrixX<double>::Random(plant_.num_positions(), kBatchSize);
+    v_batch_ = MatrixX<double>::Random(plant_.num_velocities(), kBatchSize);
+    vdot_batch_ = MatrixX<double>::Random(plant_.num_velocities(), kBatchSize);
+  }
+
+ protected:
+  static constexpr int kBatchSize = 17;
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+  MatrixX<double> q_batch_;
+  MatrixX<double> v_batch_;
+  MatrixX<double> vdot_batch_;
+};
+
+TEST_P(MultibodyPlantBatchTest, MassMatrix) {
+  const int nv = plant_.num_velocities();
+  MatrixX<double> M_batch(nv, nv * kBatchSize);
+  plant_.CalcMassMatrixBatch(*context_, q_batch_, &M_batch, GetParam());
+
+  MatrixX<double> M(nv, nv);
+  for (int i = 0; i < kBatchSize; ++i) {
+    plant_.SetPositions(context_.get(), q_batch_.col(i));
+    plant_.CalcMassMatrix(*context_, &M);
+    EXPECT_TRUE(CompareMatrices(M_batch.middleCols(i * nv, nv), M,
+                                kTolerance * M.norm()));
+  }
+}
+
+TEST_P(MultibodyPlantBatchTest, InverseDynamics) {
+  MultibodyForces<double> forces(plant_);
+  plant_.CalcForceElementsContribution(*context_, &forces);
+  forces.mutable_generalized_forces().setLinSpaced(-1.0, 1.0);
+
+  MatrixX<double> tau_batch(plant_.num_velocities(), kBatchSize);
+  plant_.CalcInverseDynamicsBatch(*context_, q_batch_, v_batch_, vdot_batch_,
+                                  forces, &tau_batch, GetParam());
+
+  for (int i = 0; i < kBatchSize; ++i) {
+    plant_.SetPositions(context_.get(), q_batch_.col(i));
+    plant_.SetVelocities(context_.get(), v_batch_.col(i));
+    const VectorX<double> tau =
+        plant_.CalcInverseDynamics(*context_, vdot_batch_.col(i), forces);
+    EXPECT_TRUE(
+        CompareMatrices(tau_batch.col(i), tau, kTolerance * tau.norm()));
+  }
+}
+
+TEST_P(MultibodyPlantBatchTest, BodyPoses) {
+  std::vector<RigidTransformd> X_WB_batch;
+  plant_.CalcAllBodyPosesInWorldBatch(*context_, q_batch_, &X_WB_batch,
+                                      GetParam());
+  ASSERT_EQ(X_WB_batch.size(), plant_.num_bodies() * kBatchSize);
+
+  for (int i = 0; i < kBatchSize; ++i) {
+    plant_.SetPositions(context_.get(), q_batch_.col(i));
+    for (BodyIndex b(0); b < plant_.num_bodies(); ++b) {
+      const RigidTransformd& X_WB =
+          plant_.EvalBodyPoseInWorld(*context_, plant_.get_body(b));
+      EXPECT_TRUE(X_WB_batch[b * kBatchSize + i].IsNearlyEqualTo(X_WB,
+                                                                 kTolerance));
+    }
+  }
+}
+
+// A workspace keeps its worker Contexts between calls, and the results do not
+// depend on whether it is reused.
+TEST_P(MultibodyPlantBatchTest, ReuseWorkspace) {
+  const int nv = plant_.num_velocities();
+  MultibodyBatchWorkspace<double> workspace;
+  EXPECT_EQ(workspace.num_workers(), 0);
+  MatrixX<double> M_batch(nv, nv * kBatchSize);
+  plant_.CalcMassMatrixBatch(*context_, q_batch_, &M_batch, GetParam(),
+                             &workspace);
+  const int num_workers = workspace.num_workers();
+  EXPECT_GE(num_workers, 1);
+
+  // The same workspace serves a different query on a different batch.
+  MatrixX<double> tau_batch(nv, kBatchSize);
+  plant_.CalcInverseDynamicsBatch(*context_, q_batch_, v_batch_, vdot_batch_,
+                                  MultibodyForces<double>(plant_), &tau_batch,
+                                  GetParam(), &workspace);
+  const MatrixX<double> q_reversed = q_batch_.rowwise().reverse();
+  MatrixX<double> M_reversed(nv, nv * kBatchSize);
+  plant_.CalcMassMatrixBatch(*context_, q_reversed, &M_reversed, GetParam(),
+                             &workspace);
+  EXPECT_EQ(workspace.num_workers(), num_workers);
+
+  MatrixX<double> M_expected(nv, nv * kBatchSize);
+  plant_.CalcMassMatrixBatch(*context_, q_reversed, &M_expected, GetParam());
+  EXPECT_TRUE(CompareMatrices(M_reversed, M_expected, 0.0));
+  MatrixX<double> tau_expected(nv, kBatchSize);
+  plant_.CalcInverseDynamicsBatch(*context_, q_batch_, v_batch_, vdot_batch_,
+                                  MultibodyForces<double>(plant_),
+                                  &tau_expected, GetParam());
+  EXPECT_TRUE(CompareMatrices(tau_batch, tau_expected, 0.0));
+}
+
+TEST_P(MultibodyPlantBatchTest, BadSizes) {
+  const int nv = plant_.num_velocities();
+  MatrixX<double> M_batch(nv, nv * (kBatchSize - 1));
+  EXPECT_THROW(plant_.CalcMassMatrixBatch(*context_, q_batch_, &M_batch,
+                                          GetParam()),
+               std::exception);
+  MatrixX<double> tau_batch(nv, kBatchSize);
+  EXPECT_THROW(plant_.CalcInverseDynamicsBatch(
+                   *context_, q_batch_, v_batch_.leftCols(1), vdot_batch_,
+                   MultibodyForces<double>(plant_), &tau_batch, GetParam()),
+               std::exception);
+}
+
+INSTANTIATE_TEST_SUITE_P(Parallelism, MultibodyPlantBatchTest,
+                         ::testing::Values(kNoConcurrency, 3,
+                                           kUseHardwareConcurrency));
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
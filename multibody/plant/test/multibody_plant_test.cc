@@ -17,8 +17,10 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/geometry/test_utilities/dummy_render_engine.h"
@@ -125,6 +127,12 @@ class MultibodyPlantTester {
       const systems::Context<double>& context) {
     return plant.EvalGeometryQueryInput(context);
   }
+
+  static const std::vector<internal::DiscreteContactPair<double>>&
+  EvalDiscreteContactPairs(const MultibodyPlant<double>& plant,
+                           const systems::Context<double>& context) {
+    return plant.EvalDiscreteContactPairs(context);
+  }
 };
 
 namespace {
@@ -1575,6 +1583,101 @@ GTEST_TEST(MultibodyPlantTest, CollisionGeometryRegistration) {
                   geometry::internal::kHcDissipation) == sphere2_dissipation);
 }
 
+// Verifies that the discrete contact pairs are cached, that they are
+// recomputed when the configuration or the proximity properties change, and
+// that the recomputation refills the same storage without allocating.
+GTEST_TEST(MultibodyPlantTest, DiscreteContactPairsCaching) {
+  const double radius = 0.5;
+  const double penetration = 0.01;
+
+  DiagramBuilder<double> builder;
+  auto items = AddMultibodyPlantSceneGraph(&builder, 1.0e-3);
+  MultibodyPlant<double>& plant = items.plant;
+  SceneGraph<double>& scene_graph = items.scene_graph;
+  plant.RegisterCollisionGeometry(
+      plant.world_body(),
+      geometry::HalfSpace::MakePose(Vector3d::UnitZ(), Vector3d::Zero()),
+      geometry::HalfSpace(), "ground", CoulombFriction<double>(0.5, 0.5));
+  const SpatialInertia<double> M_SSo_S(
+      1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(radius));
+  const RigidBody<double>& sphere = plant.AddRigidBody("Sphere", M_SSo_S);
+  const GeometryId sphere_id = plant.RegisterCollisionGeometry(
+      sphere, RigidTransformd::Identity(), geometry::Sphere(radius),
+      "collision", CoulombFriction<double>(0.5, 0.5));
+  plant.Finalize();
+  unique_ptr<Diagram<double>> diagram = builder.Build();
+  unique_ptr<Context<double>> diagram_context =
+      diagram->CreateDefaultContext();
+  Context<double>& context =
+      plant.GetMyMutableContextFromRoot(diagram_context.get());
+
+  auto set_height = [&](double z) {
+    plant.SetFreeBodyPose(&context, sphere,
+                          RigidTransformd(Vector3d(0.0, 0.0, z)));
+  };
+  auto eval_pairs = [&]()
+      -> const std::vector<internal::DiscreteContactPair<double>>& {
+    return MultibodyPlantTester::EvalDiscreteContactPairs(plant, context);
+  };
+  const double kTolerance = 1.0e-12;
+
+  set_height(radius - penetration);
+  const std::vector<internal::DiscreteContactPair<double>>& pairs =
+      eval_pairs();
+  ASSERT_EQ(pairs.size(), 1);
+  EXPECT_NEAR(pairs[0].phi0, -penetration, kTolerance);
+  const internal::DiscreteContactPair<double>* const storage = pairs.data();
+
+  // An up-to-date evaluation returns the cached pairs.
+  EXPECT_EQ(&eval_pairs(), &pairs);
+  EXPECT_EQ(pairs.data(), storage);
+
+  // Changing the configuration invalidates the pairs, which are recomputed in
+  // the same storage.
+  set_height(radius - 2 * penetration);
+  EXPECT_EQ(&eval_pairs(), &pairs);
+  ASSERT_EQ(pairs.size(), 1);
+  EXPECT_NEAR(pairs[0].phi0, -2 * penetration, kTolerance);
+  EXPECT_EQ(pairs.data(), storage);
+
+  set_height(2 * radius);
+  EXPECT_EQ(eval_pairs().size(), 0);
+
+  set_height(radius - penetration);
+  ASSERT_EQ(eval_pairs().size(), 1);
+  EXPECT_NEAR(pairs[0].phi0, -penetration, kTolerance);
+  EXPECT_EQ(pairs.data(), storage);
+
+  // Once the point pairs are up to date, refilling the discrete contact pairs
+  // does not touch the heap. (The broad-phase query that produces the point
+  // pairs is not covered here; it still allocates.)
+  set_height(radius - 2 * penetration);
+  plant.EvalPointPairPenetrations(context);
+  int num_pairs = 0;
+  {
+    drake::test::LimitMalloc guard;
+    num_pairs = static_cast<int>(eval_pairs().size());
+  }
+  ASSERT_EQ(num_pairs, 1);
+  EXPECT_NEAR(pairs[0].phi0, -2 * penetration, kTolerance);
+  EXPECT_EQ(pairs.data(), storage);
+
+  // Changing the proximity properties in the SceneGraph's context invalidates
+  // the pairs through the geometry query input port.
+  const double stiffness = pairs[0].stiffness;
+  geometry::ProximityProperties properties(
+      *scene_graph.model_inspector().GetProximityProperties(sphere_id));
+  properties.AddProperty(geometry::internal::kMaterialGroup,
+                         geometry::internal::kPointStiffness,
+                         0.5 * stiffness);
+  scene_graph.AssignRole(
+      &scene_graph.GetMyMutableContextFromRoot(diagram_context.get()),
+      *plant.get_source_id(), sphere_id, properties,
+      geometry::RoleAssign::kReplace);
+  ASSERT_EQ(eval_pairs().size(), 1);
+  EXPECT_LT(pairs[0].stiffness, stiffness);
+}
+
 // Verifies the process of visual geometry registration with a SceneGraph.
 // We build a model with two spheres and a ground plane. The ground plane is
 // located at y = 0 with normal in the y-axis direction.
@@ -69,6 +69,12 @@ class TamsiSolverTester {
   static int get_capacity(const TamsiSolver<double>& solver) {
     return solver.variable_size_workspace_.capacity();
   }
+
+  /// Returns the number of independent blocks found by the last call to
+  /// SolveWithGuess() with the block sparse factorization enabled.
+  static int get_num_independent_blocks(const TamsiSolver<double>& solver) {
+    return solver.num_independent_blocks_;
+  }
 };
 namespace {
 
@@ -1100,6 +1106,125 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// A set of planar cylinders, each with three generalized velocities
+// [vx, vy, ω], that impact the ground after being dropped with different
+// horizontal velocities so that some stick and some slide. Optionally, the
+// first two cylinders are also in contact with each other. The mass matrix is
+// block diagonal and thus the problem is a good candidate for the block sparse
+// factorization, which we verify gives the same result as the dense path.
+class IndependentCylinders : public ::testing::Test {
+ public:
+  // Sets up the problem data. When `couple_first_two` is true, an additional
+  // contact point between the first two cylinders couples their velocities.
+  void SetProblem(bool couple_first_two) {
+    const int nc = kNumCylinders + (couple_first_two ? 1 : 0);
+    M_ = MatrixX<double>::Zero(nv_, nv_);
+    Jn_ = MatrixX<double>::Zero(nc, nv_);
+    Jt_ = MatrixX<double>::Zero(2 * nc, nv_);
+    v0_.resize(nv_);
+    VectorX<double> tau = VectorX<double>::Zero(nv_);
+    for (int i = 0; i < kNumCylinders; ++i) {
+      const int iv = 3 * i;
+      M_.block<3, 3>(iv, iv) = Vector3<double>(m_, m_, I_).asDiagonal();
+      // Horizontal velocities below and above the transition to sliding.
+      v0_.segment<3>(iv) = Vector3<double>(0.3 * (i + 1), -3.0, 0.0);
+      tau(iv + 1) = -m_ * g_;
+      // Contact with the ground at the bottom of the cylinder.
+      Jn_.block<1, 3>(i, iv) = RowVector3<double>(0.0, 1.0, 0.0);
+      Jt_.block<2, 3>(2 * i, iv) << 1.0, 0.0, R_,
+                                    0.0, 0.0, 0.0;
+    }
+    if (couple_first_two) {
+      // The first cylinder touches the second one on its right side.
+      const int ic = kNumCylinders;
+      Jn_.block<1, 6>(ic, 0) << -1.0, 0.0, 0.0, 1.0, 0.0, 0.0;
+      Jt_.block<1, 6>(2 * ic, 0) << 0.0, -1.0, -R_, 0.0, 1.0, -R_;
+    }
+    p_star_ = M_ * v0_ + dt_ * tau;
+    mu_ = VectorX<double>::Constant(nc, mu_value_);
+    x0_ = VectorX<double>::Constant(nc, 1.0e-4);
+    stiffness_ = VectorX<double>::Constant(nc, 1.0e6);
+    dissipation_ = VectorX<double>::Constant(nc, 1.0);
+    fn0_ = stiffness_.array() * x0_.array();
+    fn_ = VectorX<double>::Constant(nc, m_ * g_);
+  }
+
+  // Solves the current problem with and without the block sparse
+  // factorization and verifies both give the same results.
+  void SolveAndCompare(bool two_way_coupling, int expected_num_blocks) {
+    TamsiSolver<double> dense_solver(nv_);
+    TamsiSolver<double> block_solver(nv_);
+    TamsiSolverParameters parameters;
+    parameters.stiction_tolerance = 1.0e-5;
+    dense_solver.set_solver_parameters(parameters);
+    parameters.use_block_sparse_factorization = true;
+    block_solver.set_solver_parameters(parameters);
+    for (TamsiSolver<double>* solver : {&dense_solver, &block_solver}) {
+      if (two_way_coupling) {
+        solver->SetTwoWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn0_,
+                                            &stiffness_, &dissipation_, &mu_);
+      } else {
+        solver->SetOneWayCoupledProblemData(&M_, &Jn_, &Jt_, &p_star_, &fn_,
+                                            &mu_);
+      }
+      ASSERT_EQ(solver->SolveWithGuess(dt_, v0_), TamsiSolverResult::kSuccess);
+    }
+    EXPECT_EQ(TamsiSolverTester::get_num_independent_blocks(block_solver),
+              expected_num_blocks);
+    EXPECT_EQ(block_solver.get_iteration_statistics().num_iterations,
+              dense_solver.get_iteration_statistics().num_iterations);
+    const double kTolerance = 1.0e-12;
+    EXPECT_TRUE(CompareMatrices(block_solver.get_generalized_velocities(),
+                                dense_solver.get_generalized_velocities(),
+                                kTolerance, MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(
+        block_solver.get_generalized_contact_forces(),
+        dense_solver.get_generalized_contact_forces(),
+        kTolerance * stiffness_(0), MatrixCompareType::absolute));
+  }
+
+ protected:
+  static constexpr int kNumCylinders = 4;
+  const double m_{1.0};
+  const double R_{1.0};
+  const double I_{R_ * R_ * m_};
+  const double g_{9.0};
+  const double mu_value_{0.1};
+  const double dt_{1.0e-3};
+  const int nv_{3 * kNumCylinders};
+
+  MatrixX<double> M_, Jn_, Jt_;
+  VectorX<double> v0_, p_star_, mu_;
+  VectorX<double> x0_, stiffness_, dissipation_, fn0_, fn_;
+};
+
+TEST_F(IndependentCylinders, OneWayCoupled) {
+  SetProblem(false /* couple_first_two */);
+  SolveAndCompare(false /* two_way_coupling */, kNumCylinders);
+  SetProblem(true /* couple_first_two */);
+  SolveAndCompare(false /* two_way_coupling */, kNumCylinders - 1);
+}
+
+TEST_F(IndependentCylinders, TwoWayCoupled) {
+  SetProblem(false /* couple_first_two */);
+  SolveAndCompare(true /* two_way_coupling */, kNumCylinders);
+  SetProblem(true /* couple_first_two */);
+  SolveAndCompare(true /* two_way_coupling */, kNumCylinders - 1);
+}
+
+// When all velocities are coupled there is a single block and the solver takes
+// the dense path.
+TEST_F(RollingCylinder, BlockSparseFallsBackToDense) {
+  const double dt = 1.0e-3;
+  const Vector3<double> v0(0.5, -3.0, 0.0);
+  SetImpactProblem(v0, Vector3<double>(0.0, -m_ * g_, 0.0), mu_, 0.5, dt);
+  TamsiSolverParameters parameters;
+  parameters.use_block_sparse_factorization = true;
+  solver_.set_solver_parameters(parameters);
+  ASSERT_EQ(solver_.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+  EXPECT_EQ(TamsiSolverTester::get_num_independent_blocks(solver_), 1);
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_algebra.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+namespace internal {
+template <typename T>
+class MultibodyTree;
+}  // namespace internal
+
+/// Caller-owned scratch storage for the batch queries of MultibodyPlant, such
+/// as MultibodyPlant::CalcMassMatrixBatch(). The batch queries evaluate each
+/// sample with the ordinary Context-based computations, using one private
+/// Context per worker thread. Passing the same workspace to successive batch
+/// queries keeps those Contexts (and the other per-worker arrays) alive
+/// between calls, so that only the first call -- or a call that uses more
+/// workers than any before it -- allocates them.
+///
+/// A workspace is tied to the plant that it is first used with; using it with
+/// another plant discards its contents. A workspace must not be used by
+/// concurrent batch queries.
+///
+/// @tparam_default_scalar
+template <typename T>
+class MultibodyBatchWorkspace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultibodyBatchWorkspace)
+
+  /// Constructs an empty workspace.
+  MultibodyBatchWorkspace() = default;
+
+  /// Returns the number of workers for which storage has been allocated.
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  friend class internal::MultibodyTree<T>;
+
+  // Scratch data owned by a single worker while evaluating a batch of samples.
+  struct Worker {
+    std::unique_ptr<systems::Context<T>> context;
+    std::vector<SpatialAcceleration<T>> A_WB;
+    std::vector<SpatialForce<T>> F_BMo_W;
+    VectorX<T> vdot;
+    VectorX<T> tau;
+  };
+
+  // The tree whose Contexts are held in workers_, if any.
+  const internal::MultibodyTree<T>* tree_{nullptr};
+  std::vector<Worker> workers_;
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -9,6 +9,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
@@ -474,6 +475,38 @@ void MultibodyTree<T>::CalcAllBodyPosesInWorld(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcAllBodyPosesInWorldBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    int num_parallel_executions,
+    std::vector<RigidTransform<T>>* X_WB_batch,
+    MultibodyBatchWorkspace<T>* workspace) const {
+  DRAKE_THROW_UNLESS(X_WB_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int batch_size = q_batch.cols();
+  const int num_workers = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions, batch_size);
+  X_WB_batch->resize(num_bodies() * batch_size, RigidTransform<T>::Identity());
+  MultibodyBatchWorkspace<T> owned_workspace;
+  auto& workers = PrepareBatchWorkspace(
+      context, num_workers, workspace ? workspace : &owned_workspace);
+  drake::internal::ParallelFor(
+      batch_size, num_workers, [&](int worker, int sample) {
+        systems::Context<T>* worker_context = workers[worker].context.get();
+        get_mutable_positions(worker_context) = q_batch.col(sample);
+        const PositionKinematicsCache<T>& pc =
+            EvalPositionKinematics(*worker_context);
+        // Body-major layout: all of a body's samples are contiguous.
+        for (BodyIndex body_index(0); body_index < num_bodies();
+             ++body_index) {
+          const BodyNodeIndex node_index = get_body(body_index).node_index();
+          (*X_WB_batch)[body_index * batch_size + sample] =
+              pc.get_X_WB(node_index);
+        }
+      });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
     const systems::Context<T>& context,
@@ -1130,6 +1163,105 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    int num_parallel_executions,
+    EigenPtr<MatrixX<T>> M_batch,
+    MultibodyBatchWorkspace<T>* workspace) const {
+  DRAKE_DEMAND(M_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int nv = num_velocities();
+  const int batch_size = q_batch.cols();
+  DRAKE_THROW_UNLESS(M_batch->rows() == nv);
+  DRAKE_THROW_UNLESS(M_batch->cols() == nv * batch_size);
+  const int num_workers = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions, batch_size);
+  MultibodyBatchWorkspace<T> owned_workspace;
+  auto& workers = PrepareBatchWorkspace(
+      context, num_workers, workspace ? workspace : &owned_workspace);
+  drake::internal::ParallelFor(
+      batch_size, num_workers, [&](int worker, int sample) {
+        systems::Context<T>* worker_context = workers[worker].context.get();
+        get_mutable_positions(worker_context) = q_batch.col(sample);
+        auto M = M_batch->middleCols(sample * nv, nv);
+        CalcMassMatrix(*worker_context, &M);
+      });
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    const Eigen::Ref<const MatrixX<T>>& v_batch,
+    const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+    const MultibodyForces<T>& external_forces,
+    int num_parallel_executions,
+    EigenPtr<MatrixX<T>> tau_batch,
+    MultibodyBatchWorkspace<T>* workspace) const {
+  DRAKE_DEMAND(tau_batch != nullptr);
+  const int batch_size = q_batch.cols();
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  DRAKE_THROW_UNLESS(v_batch.rows() == num_velocities());
+  DRAKE_THROW_UNLESS(vdot_batch.rows() == num_velocities());
+  DRAKE_THROW_UNLESS(v_batch.cols() == batch_size);
+  DRAKE_THROW_UNLESS(vdot_batch.cols() == batch_size);
+  DRAKE_THROW_UNLESS(tau_batch->rows() == num_velocities());
+  DRAKE_THROW_UNLESS(tau_batch->cols() == batch_size);
+  DRAKE_THROW_UNLESS(external_forces.CheckHasRightSizeForModel(*this));
+  const int num_workers = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions, batch_size);
+  MultibodyBatchWorkspace<T> owned_workspace;
+  auto& workers = PrepareBatchWorkspace(
+      context, num_workers, workspace ? workspace : &owned_workspace);
+  drake::internal::ParallelFor(
+      batch_size, num_workers, [&](int worker_index, int sample) {
+        auto& worker = workers[worker_index];
+        systems::Context<T>* worker_context = worker.context.get();
+        Eigen::VectorBlock<VectorX<T>> x =
+            GetMutablePositionsAndVelocities(worker_context);
+        x.head(num_positions()) = q_batch.col(sample);
+        x.tail(num_velocities()) = v_batch.col(sample);
+        worker.vdot = vdot_batch.col(sample);
+        CalcInverseDynamics(*worker_context, worker.vdot,
+                            external_forces.body_forces(),
+                            external_forces.generalized_forces(),
+                            &worker.A_WB, &worker.F_BMo_W, &worker.tau);
+        tau_batch->col(sample) = worker.tau;
+      });
+}
+
+template <typename T>
+std::vector<typename MultibodyBatchWorkspace<T>::Worker>&
+MultibodyTree<T>::PrepareBatchWorkspace(
+    const systems::Context<T>& context, int num_workers,
+    MultibodyBatchWorkspace<T>* workspace) const {
+  DRAKE_DEMAND(workspace != nullptr);
+  if (workspace->tree_ != this) {
+    workspace->workers_.clear();
+    workspace->tree_ = this;
+  }
+  if (workspace->num_workers() < num_workers) {
+    workspace->workers_.resize(num_workers);
+  }
+  // Each worker gets a private root Context, so that their caches may be
+  // evaluated concurrently. Only the Contexts of the workers that are used are
+  // refreshed with the time, state and parameters of `context`.
+  for (int i = 0; i < num_workers; ++i) {
+    auto& worker = workspace->workers_[i];
+    if (worker.context == nullptr) {
+      worker.context = tree_system().CreateDefaultContext();
+      worker.A_WB.resize(num_bodies());
+      worker.F_BMo_W.resize(num_bodies());
+      worker.vdot.resize(num_velocities());
+      worker.tau.resize(num_velocities());
+    }
+    worker.context->SetTimeStateAndParametersFrom(context);
+  }
+  return workspace->workers_;
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -21,6 +21,7 @@
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/multibody_batch_workspace.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
@@ -1256,6 +1257,14 @@ class MultibodyTree {
       const systems::Context<T>& context,
       std::vector<math::RigidTransform<T>>* X_WB) const;
 
+  /// See MultibodyPlant method.
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      int num_parallel_executions,
+      std::vector<math::RigidTransform<T>>* X_WB_batch,
+      MultibodyBatchWorkspace<T>* workspace) const;
+
   /// See MultibodyPlant method.
   void CalcAllBodySpatialVelocitiesInWorld(
       const systems::Context<T>& context,
@@ -1790,6 +1799,24 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  /// See MultibodyPlant method.
+  void CalcMassMatrixBatch(const systems::Context<T>& context,
+                           const Eigen::Ref<const MatrixX<T>>& q_batch,
+                           int num_parallel_executions,
+                           EigenPtr<MatrixX<T>> M_batch,
+                           MultibodyBatchWorkspace<T>* workspace) const;
+
+  /// See MultibodyPlant method.
+  void CalcInverseDynamicsBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const Eigen::Ref<const MatrixX<T>>& v_batch,
+      const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+      const MultibodyForces<T>& external_forces,
+      int num_parallel_executions,
+      EigenPtr<MatrixX<T>> tau_batch,
+      MultibodyBatchWorkspace<T>* workspace) const;
+
   /// See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
@@ -2688,6 +2715,13 @@ class MultibodyTree {
   // that the error message can include that detail.
   void ThrowIfNotFinalized(const char* source_method) const;
 
+  // Readies the first `num_workers` workers of `workspace` (allocating them
+  // if needed) for a batch query of this tree, with the time, state and
+  // parameters of `context`, and returns its workers.
+  std::vector<typename MultibodyBatchWorkspace<T>::Worker>&
+  PrepareBatchWorkspace(const systems::Context<T>& context, int num_workers,
+                        MultibodyBatchWorkspace<T>* workspace) const;
+
   // Evaluates the cache entry stored in context with the spatial inertias
   // M_Bo_W(q) for each body in the system. These will be updated as needed.
   const std::vector<SpatialInertia<T>>& EvalSpatialInertiaInWorldCache(
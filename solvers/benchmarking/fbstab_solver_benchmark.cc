@@ -0,0 +1,119 @@
+#include <limits>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/solvers/fbstab_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using symbolic::Expression;
+
+/* @defgroup fbstab_solver_benchmarks FBstab Solver Benchmarks
+ @ingroup solvers
+
+ The benchmark measures the time to solve an input-constrained linear-quadratic
+ optimal control problem with FbstabSolver, whose Newton steps are computed
+ with a Riccati recursion, and with OsqpSolver, which factorizes the sparse
+ KKT matrix of the whole program.
+
+ Arguments include:
+ - __horizon__: The number of steps N of the problem. The program has
+   3(N + 1) decision variables.
+ - __solver__: 0 for FbstabSolver, 1 for OsqpSolver.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //solvers/benchmarking:fbstab_solver_benchmark
+ ```
+
+ Rows that use OSQP are skipped if it is not available.
+
+ <h2>Interpreting the benchmark</h2>
+
+ Compare how the "Time" column grows with `horizon` for each solver. Only
+ Solve() is timed; the program is built once per row. The `iterations` counter
+ reports the Newton iterations of FBstab or the ADMM iterations of OSQP. */
+
+// A double integrator, x(k+1) = A x(k) + B u(k), driven from x(0) = (1, 0) to
+// the origin with inputs bounded by |u(k)| ≤ 0.5.
+std::unique_ptr<MathematicalProgram> MakeProblem(int num_steps) {
+  auto prog = std::make_unique<MathematicalProgram>();
+  Eigen::Matrix2d A;
+  A << 1, 0.1, 0, 1;
+  const Eigen::Vector2d B(0.005, 0.1);
+  const auto x = prog->NewContinuousVariables(2, num_steps + 1, "x");
+  const auto u = prog->NewContinuousVariables(1, num_steps + 1, "u");
+  prog->AddLinearEqualityConstraint(Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(1, 0), x.col(0));
+  for (int k = 0; k <= num_steps; ++k) {
+    const VectorX<Expression> x_k = x.col(k).cast<Expression>();
+    const VectorX<Expression> u_k = u.col(k).cast<Expression>();
+    if (k < num_steps) {
+      prog->AddLinearEqualityConstraint(x.col(k + 1) == A * x_k + B * u_k);
+    }
+    prog->AddQuadraticCost(x_k.dot(x_k) + u_k.dot(u_k));
+    prog->AddBoundingBoxConstraint(-0.5, 0.5, u.col(k));
+  }
+  return prog;
+}
+
+void SolveOptimalControl(benchmark::State& state) {  // NOLINT
+  const int num_steps = state.range(0);
+  const bool use_osqp = state.range(1) != 0;
+  const std::unique_ptr<MathematicalProgram> prog = MakeProblem(num_steps);
+  std::unique_ptr<SolverBase> solver;
+  if (use_osqp) {
+    solver = std::make_unique<OsqpSolver>();
+    // Match the accuracy of FBstab's default tolerances.
+    prog->SetSolverOption(OsqpSolver::id(), "eps_abs", 1E-6);
+    prog->SetSolverOption(OsqpSolver::id(), "eps_rel", 1E-6);
+  } else {
+    solver = std::make_unique<FbstabSolver>();
+  }
+  if (!solver->available()) {
+    state.SkipWithError("The solver is not available.");
+    return;
+  }
+  double num_iterations = 0;
+  MathematicalProgramResult result;
+  for (auto _ : state) {
+    solver->Solve(*prog, {}, {}, &result);
+    if (use_osqp) {
+      num_iterations += result.get_solver_details<OsqpSolver>().iter;
+    } else {
+      num_iterations += result.get_solver_details<FbstabSolver>().newton_iters;
+    }
+  }
+  if (!result.is_success()) {
+    state.SkipWithError("The solver failed.");
+  }
+  state.counters["iterations"] =
+      benchmark::Counter(num_iterations, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(SolveOptimalControl)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgNames({"horizon", "solver"})
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({50, 0})
+    ->Args({50, 1})
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({200, 0})
+    ->Args({200, 1})
+    ->Args({500, 0})
+    ->Args({500, 1});
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,12 +1,20 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
 #include <limits>
+#include <optional>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -300,6 +308,13 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
+  // Warm-start the children from the solution of this node, which only
+  // differs from theirs in the fixed binary variable.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    const Eigen::VectorXd& x_val = prog_result_->get_x_val();
+    left_child_->prog_->SetInitialGuessForAllVariables(x_val);
+    right_child_->prog_->SetInitialGuessForAllVariables(x_val);
+  }
   left_child_->solution_result_ = SolveProgramWithSolver(
       *left_child_->prog_, left_child_->solver_id_,
       left_child_->prog_result_.get());
@@ -360,7 +375,23 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+  // The number of nodes is not known in advance, so only the requested
+  // parallelism limits the number of workers.
+  const int num_threads = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions_, std::numeric_limits<int>::max());
+  if (num_threads > 1) {
+    if (node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+      throw std::runtime_error(
+          "The user defined node selection function is not supported when "
+          "branching on nodes in parallel.");
+    }
+    SolveInParallel(num_threads);
+    if (HasConverged()) {
+      return SolutionResult::kSolutionFound;
+    }
+  }
+  MixedIntegerBranchAndBoundNode* branching_node =
+      num_threads > 1 ? nullptr : PickBranchingNode();
   while (branching_node) {
     // Found a branching node, branch on this node. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
@@ -565,6 +596,61 @@ double BestLowerBoundInSubTree(
   }
 }
 
+// The lower bound that a leaf node contributes to the best lower bound. A
+// failed solve bounds nothing, and its optimal cost may be NaN, which would
+// break the ordering of the lower bounds in SolveInParallel(); it contributes
+// -infinity instead.
+double LeafNodeLowerBound(const MixedIntegerBranchAndBoundNode& leaf_node) {
+  switch (leaf_node.solution_result()) {
+    case SolutionResult::kSolutionFound:
+      return leaf_node.prog_result()->get_optimal_cost();
+    case SolutionResult::kInfeasibleConstraints:
+      return std::numeric_limits<double>::infinity();
+    default:
+      return -std::numeric_limits<double>::infinity();
+  }
+}
+
+// Rounds the remaining binary variables of the solution in `node` to the
+// nearest integer, and solves for the continuous variables. Returns true and
+// sets `solution` and `cost` if this program has a solution, which is then an
+// integral solution of the mixed-integer program.
+bool FindIntegralSolutionByRounding(const MixedIntegerBranchAndBoundNode& node,
+                                    Eigen::VectorXd* solution, double* cost) {
+  // Only searches integral solution by rounding, if the optimization program
+  // in this node has an optimal solution, and that solution is non-integral.
+  if (node.solution_result() == SolutionResult::kSolutionFound &&
+      !node.optimal_solution_is_integral()) {
+    // Create a new program that fix the remaining binary variables to either 0
+    // or 1, and solve for the continuous variables. If this optimization
+    // problem is feasible, then the optimal solution is a feasible
+    // solution to the MIP, and we get an upper bound on the MIP optimal cost.
+    auto new_prog = node.prog()->Clone();
+    // Go through each remaining binary variables, and constrain them to either
+    // 0 or 1 by rounding the solution to the integer.
+    for (const auto& remaining_binary_variable :
+         node.remaining_binary_variables()) {
+      // Notice that roundoff_integer_val is of type double here. This is
+      // because AddBoundingBoxConstraint(...) requires bounds of type double.
+      const double roundoff_integer_val =
+          std::round(node.prog_result()->GetSolution(
+              remaining_binary_variable));
+      new_prog->AddBoundingBoxConstraint(roundoff_integer_val,
+                                         roundoff_integer_val,
+                                         remaining_binary_variable);
+    }
+    MathematicalProgramResult result;
+    SolveProgramWithSolver(*new_prog, node.solver_id(), &result);
+    if (result.is_success()) {
+      // Found integral solution.
+      *solution = result.GetSolution(new_prog->decision_variables());
+      *cost = result.get_optimal_cost();
+      return true;
+    }
+  }
+  return false;
+}
+
 const symbolic::Variable* PickMostOrLeastAmbivalentAsBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node,
     MixedIntegerBranchAndBound::VariableSelectionMethod
@@ -721,37 +807,208 @@ bool MixedIntegerBranchAndBound::HasConverged() const {
 
 void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
     const MixedIntegerBranchAndBoundNode& node) {
-  // Only searches integral solution by rounding, if the optimization program
-  // in this node has an optimal solution, and that solution is non-integral.
-  if (node.solution_result() == SolutionResult::kSolutionFound &&
-      !node.optimal_solution_is_integral()) {
-    // Create a new program that fix the remaining binary variables to either 0
-    // or 1, and solve for the continuous variables. If this optimization
-    // problem is feasible, then the optimal solution is a feasible
-    // solution to the MIP, and we get an upper bound on the MIP optimal cost.
-    auto new_prog = node.prog()->Clone();
-    // Go through each remaining binary variables, and constrain them to either
-    // 0 or 1 by rounding the solution to the integer.
-    for (const auto& remaining_binary_variable :
-         node.remaining_binary_variables()) {
-      // Notice that roundoff_integer_val is of type double here. This is
-      // because AddBoundingBoxConstraint(...) requires bounds of type double.
-      const double roundoff_integer_val =
-          std::round(node.prog_result()->GetSolution(
-              remaining_binary_variable));
-      new_prog->AddBoundingBoxConstraint(roundoff_integer_val,
-                                         roundoff_integer_val,
-                                         remaining_binary_variable);
+  Eigen::VectorXd solution;
+  double cost;
+  if (FindIntegralSolutionByRounding(node, &solution, &cost)) {
+    UpdateIntegralSolution(solution, cost);
+  }
+}
+
+void MixedIntegerBranchAndBound::set_num_parallel_executions(
+    int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
+  num_parallel_executions_ = num_parallel_executions;
+}
+
+void MixedIntegerBranchAndBound::SolveInParallel(int num_threads) {
+  using Node = MixedIntegerBranchAndBoundNode;
+  // All the state below is guarded by mutex_. The optimization programs of the
+  // nodes are solved without holding it.
+  // queues[i] is the queue of un-fathomed leaf nodes of worker i.
+  std::vector<std::deque<Node*>> queues(num_threads);
+  // The lower bounds of the nodes in the queues or being branched on.
+  std::multiset<double> open_lower_bounds;
+  // The smallest lower bound of the fathomed leaf nodes.
+  double fathomed_lower_bound = std::numeric_limits<double>::infinity();
+  int num_busy_workers = 0;
+  bool stop = false;
+  std::condition_variable work_changed;
+
+  // Removes the lower bound of a node from open_lower_bounds.
+  auto close_node = [&open_lower_bounds](const Node& node) {
+    const auto it = open_lower_bounds.find(LeafNodeLowerBound(node));
+    if (it != open_lower_bounds.end()) {
+      open_lower_bounds.erase(it);
     }
-    MathematicalProgramResult result;
-    SolveProgramWithSolver(*new_prog, node.solver_id(), &result);
-    if (result.is_success()) {
-      // Found integral solution.
-      UpdateIntegralSolution(
-          result.GetSolution(new_prog->decision_variables()),
-          result.get_optimal_cost());
+  };
+  // Updates best_lower_bound_, and stops the workers once converged.
+  auto update_lower_bound = [&]() {
+    best_lower_bound_ = fathomed_lower_bound;
+    if (!open_lower_bounds.empty()) {
+      best_lower_bound_ =
+          std::min(best_lower_bound_, *open_lower_bounds.begin());
+    }
+    if (HasConverged()) {
+      stop = true;
+    }
+  };
+
+  // Distributes the un-fathomed leaf nodes of the current tree to the workers.
+  std::vector<Node*> leaf_nodes;
+  std::vector<Node*> stack{root_.get()};
+  while (!stack.empty()) {
+    Node* node = stack.back();
+    stack.pop_back();
+    if (node->IsLeaf()) {
+      leaf_nodes.push_back(node);
+    } else {
+      stack.push_back(node->mutable_right_child());
+      stack.push_back(node->mutable_left_child());
     }
   }
+  for (Node* leaf_node : leaf_nodes) {
+    if (IsLeafNodeFathomed(*leaf_node)) {
+      fathomed_lower_bound =
+          std::min(fathomed_lower_bound, LeafNodeLowerBound(*leaf_node));
+    } else {
+      queues[open_lower_bounds.size() % num_threads].push_back(leaf_node);
+      open_lower_bounds.insert(LeafNodeLowerBound(*leaf_node));
+    }
+  }
+  update_lower_bound();
+
+  auto branch_nodes = [&](int worker) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_changed.wait(lock, [&]() {
+        return stop || num_busy_workers == 0 ||
+               std::any_of(queues.begin(), queues.end(),
+                           [](const auto& queue) { return !queue.empty(); });
+      });
+      if (stop) {
+        return;
+      }
+      // Take the newest node of this worker's queue, or steal the oldest node
+      // of another worker's queue.
+      Node* node = nullptr;
+      if (!queues[worker].empty()) {
+        node = queues[worker].back();
+        queues[worker].pop_back();
+      } else {
+        for (int i = 1; i < num_threads && !node; ++i) {
+          auto& queue = queues[(worker + i) % num_threads];
+          if (!queue.empty()) {
+            node = queue.front();
+            queue.pop_front();
+          }
+        }
+      }
+      if (!node) {
+        // No node is queued, and no worker can add one.
+        stop = true;
+        work_changed.notify_all();
+        return;
+      }
+      if (IsLeafNodeFathomed(*node)) {
+        // Fathomed by an integral solution found since it was queued.
+        close_node(*node);
+        fathomed_lower_bound =
+            std::min(fathomed_lower_bound, LeafNodeLowerBound(*node));
+        update_lower_bound();
+        work_changed.notify_all();
+        continue;
+      }
+      const symbolic::Variable branching_variable =
+          *PickBranchingVariable(*node);
+      ++num_busy_workers;
+
+      lock.unlock();
+      node->Branch(branching_variable);
+      std::vector<Node*> children{node->mutable_left_child(),
+                                  node->mutable_right_child()};
+      std::vector<std::optional<std::pair<Eigen::VectorXd, double>>>
+          rounded_solutions(children.size());
+      if (search_integral_solution_by_rounding_) {
+        for (int i = 0; i < static_cast<int>(children.size()); ++i) {
+          Eigen::VectorXd solution;
+          double cost;
+          if (FindIntegralSolutionByRounding(*children[i], &solution, &cost)) {
+            rounded_solutions[i].emplace(solution, cost);
+          }
+        }
+      }
+      lock.lock();
+
+      --num_busy_workers;
+      close_node(*node);
+      for (int i = 0; i < static_cast<int>(children.size()); ++i) {
+        const Node& child = *children[i];
+        if (child.solution_result() == SolutionResult::kSolutionFound &&
+            child.optimal_solution_is_integral()) {
+          const MathematicalProgramResult& result = *child.prog_result();
+          UpdateIntegralSolution(
+              result.GetSolution(child.prog()->decision_variables()),
+              result.get_optimal_cost());
+        }
+        if (rounded_solutions[i]) {
+          UpdateIntegralSolution(rounded_solutions[i]->first,
+                                 rounded_solutions[i]->second);
+        }
+        NodeCallback(child);
+      }
+      // The queue is last in, first out, so the child to explore first is
+      // queued last.
+      if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound &&
+          LeafNodeLowerBound(*children[0]) < LeafNodeLowerBound(*children[1])) {
+        std::swap(children[0], children[1]);
+      }
+      for (Node* child : children) {
+        if (IsLeafNodeFathomed(*child)) {
+          fathomed_lower_bound =
+              std::min(fathomed_lower_bound, LeafNodeLowerBound(*child));
+        } else {
+          queues[worker].push_back(child);
+          open_lower_bounds.insert(LeafNodeLowerBound(*child));
+        }
+      }
+      update_lower_bound();
+      work_changed.notify_all();
+    }
+  };
+
+  auto worker_body = [&](int worker) {
+    try {
+      branch_nodes(worker);
+    } catch (...) {
+      // Ask the other workers to stop; the exception reaches the caller
+      // through the future.
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop = true;
+      }
+      work_changed.notify_all();
+      throw;
+    }
+  };
+  std::vector<std::future<void>> workers;
+  workers.reserve(num_threads);
+  for (int worker = 0; worker < num_threads; ++worker) {
+    workers.emplace_back(std::async(std::launch::async, worker_body, worker));
+  }
+  std::exception_ptr first_exception;
+  for (auto& worker : workers) {
+    try {
+      worker.get();
+    } catch (...) {
+      if (!first_exception) {
+        first_exception = std::current_exception();
+      }
+    }
+  }
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
 }
 }  // namespace solvers
 }  // namespace drake
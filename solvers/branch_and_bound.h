@@ -3,9 +3,11 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 
@@ -506,6 +508,36 @@ class MixedIntegerBranchAndBound {
     node_callback_userfun_ = fun;
   }
 
+  /**
+   * Sets the number of nodes that Solve() can branch on concurrently. With
+   * the default value, kNoConcurrency, Solve() branches on one node at a time
+   * on the calling thread, in the order given by the node selection method.
+   *
+   * Otherwise Solve() launches this many workers (one per hardware thread for
+   * kUseHardwareConcurrency), since the optimization programs of different
+   * nodes can be solved independently. Each worker keeps its own queue of
+   * un-fathomed leaf nodes. It branches on the node it added last to its own
+   * queue, and when its queue is empty, it steals the node added first to the
+   * queue of another worker. The children of a node are added to the queue of
+   * the worker that branched on it; with NodeSelectionMethod::kMinLowerBound,
+   * the child with the smaller optimal cost is branched on first. The
+   * solutions and the best upper bound are shared by all workers, so a node is
+   * not branched on once its optimal cost exceeds the cost of an integral
+   * solution found by any worker.
+   *
+   * @note The user defined variable selection function and the node callback
+   * function are never called concurrently, but other workers can modify the
+   * tree while they run, so they should not traverse the tree.
+   * NodeSelectionMethod::kUserDefined is not supported with more than one
+   * worker; Solve() throws std::runtime_error in that case.
+   * @throws std::exception if @p num_parallel_executions is neither positive
+   * nor kUseHardwareConcurrency.
+   */
+  void set_num_parallel_executions(int num_parallel_executions);
+
+  /** Getter for the number of parallel executions. */
+  int num_parallel_executions() const { return num_parallel_executions_; }
+
   /**
    * If a leaf node is fathomed, then there is no need to branch on this node
    * any more. A leaf node is fathomed is any of the following conditions are
@@ -635,6 +667,13 @@ class MixedIntegerBranchAndBound {
   void SearchIntegralSolutionByRounding(
       const MixedIntegerBranchAndBoundNode& node);
 
+  /**
+   * Branches on the un-fathomed leaf nodes with `num_threads` workers, until
+   * every leaf node is fathomed or the branch-and-bound has converged. See
+   * set_num_parallel_executions().
+   */
+  void SolveInParallel(int num_threads);
+
   // The root node of the tree.
   std::unique_ptr<MixedIntegerBranchAndBoundNode> root_;
 
@@ -690,6 +729,12 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  int num_parallel_executions_{kNoConcurrency};
+
+  // Guards the bounds, the solutions, the node queues and the user defined
+  // functions while SolveInParallel() runs.
+  std::mutex mutex_;
 };
 }  // namespace solvers
 }  // namespace drake
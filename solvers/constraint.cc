@@ -253,6 +253,24 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LinearConstraint::DoEvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::VectorXd* gradient_values) const {
+  *y = A_ * x;
+  const auto& pattern = gradient_sparsity_pattern();
+  if (pattern.has_value()) {
+    gradient_values->resize(pattern->size());
+    for (int k = 0; k < static_cast<int>(pattern->size()); ++k) {
+      (*gradient_values)(k) = A_((*pattern)[k].first, (*pattern)[k].second);
+    }
+  } else {
+    gradient_values->resize(A_.size());
+    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                              Eigen::RowMajor>>(gradient_values->data(),
+                                                A_.rows(), A_.cols()) = A_;
+  }
+}
+
 std::ostream& LinearConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "LinearConstraint", vars, false);
@@ -438,54 +456,39 @@ ExpressionConstraint::ExpressionConstraint(
 
   derivatives_ = symbolic::Jacobian(expressions_, vars_);
 
-  // Setup the environment.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_.insert(vars_[i], 0.0);
-  }
+  // The values and the derivatives share many subexpressions, so they are
+  // compiled together for DoEval() on AutoDiffXd.
+  compiled_values_ = symbolic::CompiledExpression(expressions_, vars_);
+  MatrixX<symbolic::Expression> values_and_derivatives(expressions_.rows(),
+                                                       1 + vars_.rows());
+  values_and_derivatives << expressions_, derivatives_;
+  compiled_values_and_derivatives_ =
+      symbolic::CompiledExpression(values_and_derivatives, vars_);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
-
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
-  }
-
-  // Evaluate into the output, y.
-  y->resize(num_constraints());
-  for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i] = expressions_[i].Evaluate(environment_);
-  }
+  Eigen::MatrixXd values;
+  compiled_values_.Eval(x, &values);
+  *y = values.col(0);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
-
-  // Set environment with current x values.
-  for (int i = 0; i < vars_.size(); i++) {
-    environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
-  }
+  Eigen::MatrixXd values_and_derivatives;
+  compiled_values_and_derivatives_.Eval(math::autoDiffToValueMatrix(x),
+                                        &values_and_derivatives);
 
   // Evaluate value and derivatives into the output, y.
   // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
+  const Eigen::MatrixXd dydz = values_and_derivatives.rightCols(x.size()) *
+                               math::autoDiffToGradientMatrix(x);
   y->resize(num_constraints());
-  Eigen::VectorXd dyidx(x.size());
   for (int i = 0; i < num_constraints(); i++) {
-    (*y)[i].value() = expressions_[i].Evaluate(environment_);
-    for (int k = 0; k < x.size(); k++) {
-      dyidx[k] = derivatives_(i, k).Evaluate(environment_);
-    }
-
-    (*y)[i].derivatives().resize(x(0).derivatives().size());
-    for (int j = 0; j < x(0).derivatives().size(); j++) {
-      (*y)[i].derivatives()[j] = 0.0;
-      for (int k = 0; k < x.size(); k++) {
-        (*y)[i].derivatives()[j] += dyidx[k] * x(k).derivatives()[j];
-      }
-    }
+    (*y)[i].value() = values_and_derivatives(i, 0);
+    (*y)[i].derivatives() = dydz.row(i).transpose();
   }
 }
 
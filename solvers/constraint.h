@@ -566,6 +566,12 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  // The gradient is A, so it is read off directly rather than through
+  // AutoDiffXd.
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::VectorXd* gradient_values) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -929,8 +935,9 @@ class ExpressionConstraint : public Constraint {
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
 
-  // Only for caching, does not carrying hidden state.
-  mutable symbolic::Environment environment_;
+  // expressions_, and [expressions_, derivatives_], compiled over vars_.
+  symbolic::CompiledExpression compiled_values_;
+  symbolic::CompiledExpression compiled_values_and_derivatives_;
 };
 
 /**
@@ -1,6 +1,11 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
+#include <cmath>
 #include <set>
+#include <stdexcept>
+
+#include <fmt/format.h>
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/nice_type_name.h"
@@ -84,6 +89,127 @@ void EvaluatorBase::SetGradientSparsityPattern(
                                  num_vars());
   }
   gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
+
+  // Greedily assign each column to the first group that has no entry in any
+  // of the column's rows.
+  int num_cols = std::max(num_vars(), 0);
+  for (const auto& nonzero_entry : gradient_sparsity_pattern) {
+    num_cols = std::max(num_cols, nonzero_entry.second + 1);
+  }
+  std::vector<std::vector<int>> rows_of_column(num_cols);
+  for (const auto& nonzero_entry : gradient_sparsity_pattern) {
+    rows_of_column[nonzero_entry.second].push_back(nonzero_entry.first);
+  }
+  gradient_column_group_.assign(num_cols, -1);
+  // group_uses_row[g][i] is true if a column in group g has an entry in row i.
+  std::vector<std::vector<bool>> group_uses_row;
+  for (int j = 0; j < num_cols; ++j) {
+    if (rows_of_column[j].empty()) {
+      continue;
+    }
+    int group = 0;
+    for (; group < static_cast<int>(group_uses_row.size()); ++group) {
+      bool conflict = false;
+      for (int row : rows_of_column[j]) {
+        conflict = conflict || group_uses_row[group][row];
+      }
+      if (!conflict) {
+        break;
+      }
+    }
+    if (group == static_cast<int>(group_uses_row.size())) {
+      group_uses_row.emplace_back(num_outputs(), false);
+    }
+    for (int row : rows_of_column[j]) {
+      group_uses_row[group][row] = true;
+    }
+    gradient_column_group_[j] = group;
+  }
+  num_gradient_column_groups_ = static_cast<int>(group_uses_row.size());
+}
+
+void EvaluatorBase::DoEvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::VectorXd* gradient_values) const {
+  const int num_x = x.rows();
+  AutoDiffVecXd y_autodiff(num_outputs());
+  if (!gradient_sparsity_pattern_.has_value()) {
+    DoEval(math::initializeAutoDiff(x), &y_autodiff);
+    *y = math::autoDiffToValueMatrix(y_autodiff);
+    gradient_values->resize(num_outputs() * num_x);
+    for (int i = 0; i < num_outputs(); ++i) {
+      const Eigen::VectorXd& dyi = y_autodiff(i).derivatives();
+      for (int j = 0; j < num_x; ++j) {
+        (*gradient_values)(i * num_x + j) = dyi.size() > 0 ? dyi(j) : 0.0;
+      }
+    }
+    return;
+  }
+
+  // Seed each column with the derivative of its group. The columns without
+  // any entry in the pattern do not affect the gradient entries we report.
+  const int num_groups = num_gradient_column_groups_;
+  AutoDiffVecXd x_autodiff(num_x);
+  for (int j = 0; j < num_x; ++j) {
+    x_autodiff(j).value() = x(j);
+    x_autodiff(j).derivatives() = Eigen::VectorXd::Zero(num_groups);
+    if (j < static_cast<int>(gradient_column_group_.size()) &&
+        gradient_column_group_[j] >= 0) {
+      x_autodiff(j).derivatives()(gradient_column_group_[j]) = 1;
+    }
+  }
+  DoEval(x_autodiff, &y_autodiff);
+  *y = math::autoDiffToValueMatrix(y_autodiff);
+  const std::vector<std::pair<int, int>>& pattern = *gradient_sparsity_pattern_;
+  gradient_values->resize(pattern.size());
+  for (int k = 0; k < static_cast<int>(pattern.size()); ++k) {
+    const Eigen::VectorXd& dyi = y_autodiff(pattern[k].first).derivatives();
+    (*gradient_values)(k) =
+        dyi.size() > 0 ? dyi(gradient_column_group_[pattern[k].second]) : 0.0;
+  }
+}
+
+void EvaluatorBase::CheckSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::VectorXd& gradient_values) const {
+  if (!gradient_sparsity_pattern_.has_value()) {
+    return;
+  }
+  const int num_x = x.rows();
+  AutoDiffVecXd y_autodiff(num_outputs());
+  DoEval(math::initializeAutoDiff(x), &y_autodiff);
+  Eigen::MatrixXd dense(num_outputs(), num_x);
+  for (int i = 0; i < num_outputs(); ++i) {
+    const Eigen::VectorXd& dyi = y_autodiff(i).derivatives();
+    dense.row(i) = dyi.size() > 0 ? dyi : Eigen::VectorXd::Zero(num_x);
+  }
+  // The two evaluations may sum the same terms in a different order.
+  const double tolerance = 1e-10 * std::max(1.0, dense.cwiseAbs().maxCoeff());
+  const std::vector<std::pair<int, int>>& pattern = *gradient_sparsity_pattern_;
+  for (int k = 0; k < static_cast<int>(pattern.size()); ++k) {
+    const auto [i, j] = pattern[k];
+    if (std::abs(gradient_values(k) - dense(i, j)) > tolerance) {
+      throw std::logic_error(fmt::format(
+          "EvaluatorBase::EvalWithSparseGradient(): {} reported ∂y{}/∂x{} = {} "
+          "but its dense gradient is {}; its gradient sparsity pattern is "
+          "probably incomplete.",
+          NiceTypeName::RemoveNamespaces(NiceTypeName::Get(*this)), i, j,
+          gradient_values(k), dense(i, j)));
+    }
+    dense(i, j) = 0;
+  }
+  // What remains are the entries missing from the pattern.
+  for (int i = 0; i < num_outputs(); ++i) {
+    for (int j = 0; j < num_x; ++j) {
+      if (std::abs(dense(i, j)) > tolerance) {
+        throw std::logic_error(fmt::format(
+            "EvaluatorBase::EvalWithSparseGradient(): the gradient sparsity "
+            "pattern of {} does not contain ({}, {}), but ∂y{}/∂x{} = {}.",
+            NiceTypeName::RemoveNamespaces(NiceTypeName::Get(*this)), i, j, i,
+            j, dense(i, j)));
+      }
+    }
+  }
 }
 
 std::ostream& operator<<(std::ostream& os, const EvaluatorBase& e) {
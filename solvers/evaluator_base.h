@@ -119,6 +119,13 @@ class EvaluatorBase {
    * y value in Eval, w.r.t x in Eval) . gradient_sparsity_pattern contains
    * *all* the pairs of (row_index, col_index) for which the corresponding
    * entries could have non-zero value in the gradient matrix ∂y/∂x.
+   *
+   * @warning The pattern must be complete. EvalWithSparseGradient() evaluates
+   * several columns of the gradient at once, on the assumption that the
+   * entries missing from the pattern are zero; if one of them is not, then it
+   * is silently dropped or added into the entries that are reported, and
+   * solvers receive the wrong gradient. In builds where DRAKE_ASSERT is armed,
+   * EvalWithSparseGradient() checks its result against the dense gradient.
    */
   void SetGradientSparsityPattern(
       const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
@@ -136,6 +143,45 @@ class EvaluatorBase {
     return gradient_sparsity_pattern_;
   }
 
+  /**
+   * Evaluates the expression together with the entries of its gradient ∂y/∂x
+   * that could be non-zero.
+   *
+   * If gradient_sparsity_pattern() has a value, then `gradient_values` has one
+   * entry for each pair in that pattern and in the same order, namely
+   * gradient_values(k) = ∂yᵢ/∂xⱼ where (i, j) = gradient_sparsity_pattern()[k].
+   * Otherwise `gradient_values` is the dense gradient in row-major order,
+   * namely gradient_values(i * x.rows() + j) = ∂yᵢ/∂xⱼ.
+   *
+   * Solvers call this method rather than Eval() on AutoDiffXd, whose
+   * derivatives are always as wide as `x`.
+   *
+   * In builds where DRAKE_ASSERT is armed, the result is also compared with
+   * the dense gradient from Eval() on AutoDiffXd, which catches an incomplete
+   * gradient_sparsity_pattern(); that doubles the cost of each call.
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] gradient_values The gradient entries described above.
+   * @throws std::exception if DRAKE_ASSERT is armed and the result does not
+   * match the dense gradient.
+   */
+  void EvalWithSparseGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::VectorXd* y,
+                              Eigen::VectorXd* gradient_values) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DRAKE_ASSERT(y != nullptr);
+    DRAKE_ASSERT(gradient_values != nullptr);
+    DoEvalWithSparseGradient(x, y, gradient_values);
+    DRAKE_ASSERT(y->rows() == num_outputs_);
+    DRAKE_ASSERT(gradient_values->rows() ==
+                 (gradient_sparsity_pattern_.has_value()
+                      ? static_cast<int>(gradient_sparsity_pattern_->size())
+                      : num_outputs_ * static_cast<int>(x.rows())));
+    if (kDrakeAssertIsArmed) {
+      CheckSparseGradient(x, *gradient_values);
+    }
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -181,6 +227,25 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements EvalWithSparseGradient().
+   *
+   * The default implementation calls the AutoDiffXd overload of DoEval(). If
+   * gradient_sparsity_pattern() has a value, the columns of the gradient are
+   * first (greedily) partitioned into groups of columns that have no row in
+   * common in that pattern, and each group shares a single derivative, so that
+   * the derivatives are only as wide as the number of groups. This relies on
+   * the pattern containing *every* entry that could be non-zero.
+   *
+   * Subclasses that can compute their gradient directly may override this.
+   * @pre x must be of size `num_vars` x 1.
+   * @post y will be of size `num_outputs` x 1, and gradient_values will be
+   * sized as documented in EvalWithSparseGradient().
+   */
+  virtual void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::VectorXd* gradient_values) const;
+
   /**
    * NVI implementation of Display. The default implementation will report
    * the NiceTypeName, get_description, and list the bound variables.
@@ -209,6 +274,18 @@ class EvaluatorBase {
   // false, the gradient matrix is regarded as non-sparse, i.e., every entry of
   // the gradient matrix can be non-zero.
   std::optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  // When gradient_sparsity_pattern_ has a value, gradient_column_group_[j] is
+  // the group (see DoEvalWithSparseGradient()) of the j'th column of the
+  // gradient, or -1 if that column has no entries in the pattern. No two
+  // columns in the same group have an entry in the same row.
+  std::vector<int> gradient_column_group_;
+  int num_gradient_column_groups_{0};
+
+  // Throws unless `gradient_values`, as returned by EvalWithSparseGradient(x),
+  // matches the dense gradient of Eval() at `x`: each entry of the pattern must
+  // match, and each entry missing from the pattern must be zero.
+  void CheckSparseGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                           const Eigen::VectorXd& gradient_values) const;
 };
 
 /**
@@ -0,0 +1,698 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/unused.h"
+#include "drake/solvers/fbstab/fbstab_mpc.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+using Eigen::VectorXd;
+
+// A linear equality constraint M * v = b, whose variables v are the distinct
+// decision variables of the binding, sorted by their index in the program.
+struct EqualityBlock {
+  int rows() const { return M.rows(); }
+
+  std::vector<int> vars;
+  MatrixXd M;
+  VectorXd b;
+};
+
+EqualityBlock MakeEqualityBlock(
+    const MathematicalProgram& prog,
+    const Binding<LinearEqualityConstraint>& binding) {
+  const std::vector<int> indices =
+      prog.FindDecisionVariableIndices(binding.variables());
+  EqualityBlock block;
+  block.vars = indices;
+  std::sort(block.vars.begin(), block.vars.end());
+  block.vars.erase(std::unique(block.vars.begin(), block.vars.end()),
+                   block.vars.end());
+  const MatrixXd& A = binding.evaluator()->A();
+  block.M = MatrixXd::Zero(A.rows(), block.vars.size());
+  for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+    const int column =
+        std::lower_bound(block.vars.begin(), block.vars.end(), indices[j]) -
+        block.vars.begin();
+    block.M.col(column) += A.col(j);
+  }
+  block.b = binding.evaluator()->lower_bound();
+  return block;
+}
+
+// Returns the columns of `block.M` of the variables `vars`, in their order.
+// The columns of variables that `block` does not involve are zero.
+MatrixXd GetColumns(const EqualityBlock& block, const std::vector<int>& vars) {
+  MatrixXd columns = MatrixXd::Zero(block.rows(), vars.size());
+  for (int j = 0; j < static_cast<int>(vars.size()); ++j) {
+    const auto it =
+        std::lower_bound(block.vars.begin(), block.vars.end(), vars[j]);
+    if (it != block.vars.end() && *it == vars[j]) {
+      columns.col(j) = block.M.col(it - block.vars.begin());
+    }
+  }
+  return columns;
+}
+
+// Returns true if the sorted `vars` includes all of `subset`.
+bool Includes(const std::vector<int>& vars, std::vector<int> subset) {
+  std::sort(subset.begin(), subset.end());
+  return std::includes(vars.begin(), vars.end(), subset.begin(),
+                       subset.end());
+}
+
+bool IsInvertible(const MatrixXd& M) {
+  return M.rows() == M.cols() && M.fullPivLu().isInvertible();
+}
+
+// Returns the stage (per `stage_of`) of the variables `vars` with nonzero
+// `coefficients`, -1 if there are none, or -2 if they span more than one
+// stage.
+int FindStage(const std::vector<int>& stage_of, const std::vector<int>& vars,
+              const Eigen::Ref<const VectorXd>& coefficients) {
+  int stage = -1;
+  for (int i = 0; i < static_cast<int>(vars.size()); ++i) {
+    if (coefficients(i) == 0) continue;
+    const int stage_i = stage_of[vars[i]];
+    if (stage != -1 && stage != stage_i) return -2;
+    stage = stage_i;
+  }
+  return stage;
+}
+
+// Returns true if every row of `A`, whose columns are the variables `vars`,
+// only involves the variables of a single stage.
+bool IsStageWise(const std::vector<int>& stage_of, const std::vector<int>& vars,
+                 const MatrixXd& A) {
+  for (int i = 0; i < A.rows(); ++i) {
+    if (FindStage(stage_of, vars, A.row(i).transpose()) == -2) return false;
+  }
+  return true;
+}
+
+// The stage-wise structure of a program, as documented in FbstabSolver.
+struct Stages {
+  int N{};
+  int nx{};
+  int nu{};
+  // The linear equality constraints of the program.
+  std::vector<EqualityBlock> blocks;
+  // The indices in `blocks` of the initial state and of the dynamics of each
+  // step.
+  int initial{-1};
+  std::vector<int> dynamics;
+  // The decision variables of x(k) and u(k), for k = 0, ..., N.
+  std::vector<std::vector<int>> X, U;
+  // The index in `blocks` of the constraint between u(N) and u(N-1) that is
+  // eliminated by substitution, or -1.
+  int final_inputs{-1};
+  // The indices in `blocks` of the other constraints.
+  std::vector<int> other_blocks;
+  // The stage of each decision variable; u(N) belongs to stage N - 1 when it
+  // is substituted.
+  std::vector<int> stage_of;
+};
+
+// Finds the stages of `prog` with the equality constraint `blocks[initial]`
+// as the initial state, where `blocks_of[v]` lists the blocks that involve
+// decision variable v. Returns nullopt if `prog` does not have the structure
+// documented in FbstabSolver. The returned `blocks` is empty.
+std::optional<Stages> FindStagesFrom(
+    const MathematicalProgram& prog, const std::vector<EqualityBlock>& blocks,
+    const std::vector<std::vector<int>>& blocks_of, int initial) {
+  const int num_blocks = blocks.size();
+  const int nx = blocks[initial].vars.size();
+  std::vector<bool> used(num_blocks, false);
+  used[initial] = true;
+  Stages stages;
+  stages.nx = nx;
+  stages.initial = initial;
+  std::vector<std::vector<int>>& X = stages.X;
+  std::vector<std::vector<int>>& U = stages.U;
+  // The stage of each decision variable, or -1.
+  std::vector<int>& stage_of = stages.stage_of;
+  stage_of.assign(prog.num_vars(), -1);
+  X.push_back(blocks[initial].vars);
+  for (int v : X[0]) stage_of[v] = 0;
+  int nu = -1;
+
+  // Returns the unused block with nx rows that involves all of `x`, -1 if
+  // there is none, or -2 if there are several. Only the blocks that involve
+  // x[0] are searched.
+  auto find_dynamics = [&](const std::vector<int>& x) {
+    int found = -1;
+    for (int j : blocks_of[x[0]]) {
+      if (!used[j] && blocks[j].rows() == nx && Includes(blocks[j].vars, x)) {
+        if (found != -1) return -2;
+        found = j;
+      }
+    }
+    return found;
+  };
+
+  // The number of variables that each block shares with the current step,
+  // and the blocks with a nonzero count.
+  std::vector<int> num_shared(num_blocks, 0);
+  std::vector<int> sharing;
+  // The positions of x(k) in the `others` of the previous step.
+  std::vector<int> positions;
+  while (true) {
+    const int k = X.size() - 1;
+    const int block_index = find_dynamics(X[k]);
+    if (block_index == -2) return std::nullopt;
+    if (block_index == -1) break;
+    const EqualityBlock& block = blocks[block_index];
+    std::vector<int> x_sorted = X[k];
+    std::sort(x_sorted.begin(), x_sorted.end());
+    std::vector<int> others;
+    std::set_difference(block.vars.begin(), block.vars.end(),
+                        x_sorted.begin(), x_sorted.end(),
+                        std::back_inserter(others));
+    if (std::any_of(others.begin(), others.end(),
+                    [&](int v) { return stage_of[v] != -1; })) {
+      return std::nullopt;
+    }
+    if (nu == -1) {
+      nu = others.size() - nx;
+      if (nu <= 0) return std::nullopt;
+    } else if (static_cast<int>(others.size()) != nx + nu) {
+      return std::nullopt;
+    }
+    used[block_index] = true;
+
+    // Candidates for x(k+1): the variables shared with another unused block
+    // with nx rows. At the last step, x(N) is shared with no other block, so
+    // the candidates are the variables at the positions in `others` that
+    // x(k) had at the previous step, then the first and the last nx.
+    std::vector<std::vector<int>> candidates;
+    for (int v : others) {
+      for (int j : blocks_of[v]) {
+        if (used[j] || blocks[j].rows() != nx) continue;
+        if (num_shared[j]++ == 0) sharing.push_back(j);
+      }
+    }
+    for (int j : sharing) {
+      if (num_shared[j] == nx) {
+        std::vector<int> shared;
+        std::set_intersection(others.begin(), others.end(),
+                              blocks[j].vars.begin(), blocks[j].vars.end(),
+                              std::back_inserter(shared));
+        candidates.push_back(std::move(shared));
+      }
+      num_shared[j] = 0;
+    }
+    sharing.clear();
+    if (!positions.empty()) {
+      std::vector<int> same_positions;
+      for (int i : positions) same_positions.push_back(others[i]);
+      candidates.push_back(std::move(same_positions));
+    }
+    candidates.emplace_back(others.begin(), others.begin() + nx);
+    candidates.emplace_back(others.end() - nx, others.end());
+
+    // Take the first candidate whose matrix is invertible, and after which
+    // the chain either ends or continues with a block of the right size.
+    std::optional<std::vector<int>> x_next;
+    for (const std::vector<int>& candidate : candidates) {
+      if (!IsInvertible(GetColumns(block, candidate))) continue;
+      const int next = find_dynamics(candidate);
+      if (next == -2) continue;
+      if (next >= 0) {
+        const int num_next_vars = blocks[next].vars.size();
+        if (num_next_vars != nx + nx + nu) continue;
+      }
+      x_next = candidate;
+      break;
+    }
+    if (!x_next) return std::nullopt;
+    std::vector<int> u;
+    std::vector<int> sorted_x_next = *x_next;
+    std::sort(sorted_x_next.begin(), sorted_x_next.end());
+    std::set_difference(others.begin(), others.end(), sorted_x_next.begin(),
+                        sorted_x_next.end(), std::back_inserter(u));
+    positions.clear();
+    for (int v : *x_next) {
+      positions.push_back(
+          std::lower_bound(others.begin(), others.end(), v) - others.begin());
+    }
+    for (int v : u) stage_of[v] = k;
+    for (int v : *x_next) stage_of[v] = k + 1;
+    U.push_back(std::move(u));
+    X.push_back(std::move(*x_next));
+    stages.dynamics.push_back(block_index);
+  }
+  const int N = stages.dynamics.size();
+  if (N == 0) return std::nullopt;
+  stages.N = N;
+  stages.nu = nu;
+
+  // The remaining variables are u(N).
+  std::vector<int> u_final;
+  for (int v = 0; v < prog.num_vars(); ++v) {
+    if (stage_of[v] == -1) u_final.push_back(v);
+  }
+  if (!u_final.empty() && static_cast<int>(u_final.size()) != nu) {
+    return std::nullopt;
+  }
+  for (int v : u_final) stage_of[v] = N;
+  U.push_back(u_final);
+
+  // Finds the equality constraint between u(N) and u(N-1), if any.
+  if (!u_final.empty()) {
+    std::vector<int> allowed(U[N - 1]);
+    allowed.insert(allowed.end(), u_final.begin(), u_final.end());
+    std::sort(allowed.begin(), allowed.end());
+    for (int j : blocks_of[u_final[0]]) {
+      const EqualityBlock& block = blocks[j];
+      if (!used[j] && block.rows() == nu && Includes(block.vars, u_final) &&
+          Includes(allowed, block.vars) &&
+          FindStage(stage_of, block.vars, VectorXd::Ones(block.vars.size())) ==
+              -2 &&
+          IsInvertible(GetColumns(block, u_final))) {
+        stages.final_inputs = j;
+        used[j] = true;
+        for (int v : u_final) stage_of[v] = N - 1;
+        break;
+      }
+    }
+  }
+
+  // Every row of the other constraints and every cost must only involve a
+  // single stage. (Each row of a bounding box constraint involves a single
+  // variable.)
+  for (int j = 0; j < num_blocks; ++j) {
+    if (used[j]) continue;
+    if (!IsStageWise(stage_of, blocks[j].vars, blocks[j].M)) {
+      return std::nullopt;
+    }
+    stages.other_blocks.push_back(j);
+  }
+  for (const auto& binding : prog.linear_constraints()) {
+    if (!IsStageWise(stage_of,
+                     prog.FindDecisionVariableIndices(binding.variables()),
+                     binding.evaluator()->A())) {
+      return std::nullopt;
+    }
+  }
+  for (const auto& binding : prog.quadratic_costs()) {
+    const std::vector<int> vars =
+        prog.FindDecisionVariableIndices(binding.variables());
+    if (FindStage(stage_of, vars, VectorXd::Ones(vars.size())) == -2) {
+      return std::nullopt;
+    }
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const std::vector<int> vars =
+        prog.FindDecisionVariableIndices(binding.variables());
+    if (FindStage(stage_of, vars, VectorXd::Ones(vars.size())) == -2) {
+      return std::nullopt;
+    }
+  }
+  return stages;
+}
+
+// Finds the stages of `prog`, or returns nullopt if `prog` does not have the
+// structure documented in FbstabSolver. The cost is linear in the size of
+// the program: the blocks of each variable are indexed once, and at most two
+// initial states are tried.
+std::optional<Stages> FindStages(const MathematicalProgram& prog) {
+  std::vector<EqualityBlock> blocks;
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    blocks.push_back(MakeEqualityBlock(prog, binding));
+  }
+  const int num_blocks = blocks.size();
+  std::vector<std::vector<int>> blocks_of(prog.num_vars());
+  for (int j = 0; j < num_blocks; ++j) {
+    for (int v : blocks[j].vars) blocks_of[v].push_back(j);
+  }
+
+  // Returns true if the variables of `blocks[i]` are involved in exactly one
+  // other block, with as many rows, as x(0) is in the dynamics of step 0.
+  // The state at the other end of the horizon may qualify as well.
+  auto is_end_of_chain = [&](int i) {
+    int other = -1;
+    for (int v : blocks[i].vars) {
+      if (blocks_of[v].size() != 2) return false;
+      const int j = blocks_of[v][0] == i ? blocks_of[v][1] : blocks_of[v][0];
+      if (other != -1 && other != j) return false;
+      other = j;
+    }
+    return blocks[other].rows() == blocks[i].rows();
+  };
+
+  int num_tried = 0;
+  for (int i = 0; i < num_blocks && num_tried < 2; ++i) {
+    const EqualityBlock& block = blocks[i];
+    if (block.rows() == 0 ||
+        block.rows() != static_cast<int>(block.vars.size()) ||
+        !is_end_of_chain(i) || !IsInvertible(block.M)) {
+      continue;
+    }
+    ++num_tried;
+    std::optional<Stages> stages = FindStagesFrom(prog, blocks, blocks_of, i);
+    if (stages) {
+      stages->blocks = std::move(blocks);
+      return stages;
+    }
+  }
+  return std::nullopt;
+}
+
+// The value of decision variable is `offset + coefficients · w(stage)`,
+// where w(stage) = [x(stage); u(stage)].
+struct VariableMap {
+  int stage{-1};
+  RowVectorXd coefficients;
+  double offset{0};
+};
+
+// The quadratic program in the form of FBstabMpc (see its documentation),
+// together with the map from the decision variables of a MathematicalProgram
+// to its variables.
+struct StageWiseQp {
+  int N{};
+  int nx{};
+  int nu{};
+  int nc{};
+  std::vector<MatrixXd> Q, R, S, A, B, E, L;
+  std::vector<VectorXd> q, r, c, d;
+  VectorXd x0;
+  std::vector<VariableMap> variables;
+};
+
+// Lowers `prog`, whose stages are `stages`, to a StageWiseQp.
+StageWiseQp LowerToStageWiseQp(const MathematicalProgram& prog,
+                               const Stages& stages) {
+  const int N = stages.N;
+  const int nx = stages.nx;
+  const int nu = stages.nu;
+  const std::vector<EqualityBlock>& blocks = stages.blocks;
+  const std::vector<std::vector<int>>& X = stages.X;
+  const std::vector<std::vector<int>>& U = stages.U;
+  StageWiseQp qp;
+  qp.N = N;
+  qp.nx = nx;
+  qp.nu = nu;
+  const int nw = nx + nu;
+  qp.variables.resize(prog.num_vars());
+  for (int k = 0; k <= N; ++k) {
+    for (int i = 0; i < static_cast<int>(X[k].size()); ++i) {
+      VariableMap& map = qp.variables[X[k][i]];
+      map.stage = k;
+      map.coefficients = RowVectorXd::Unit(nw, i);
+    }
+    for (int i = 0; i < static_cast<int>(U[k].size()); ++i) {
+      VariableMap& map = qp.variables[U[k][i]];
+      map.stage = k;
+      map.coefficients = RowVectorXd::Unit(nw, nx + i);
+    }
+  }
+
+  // The initial state and dynamics.
+  const EqualityBlock& initial_block = blocks[stages.initial];
+  qp.x0 = initial_block.M.fullPivLu().solve(initial_block.b);
+  for (int k = 0; k < N; ++k) {
+    const EqualityBlock& block = blocks[stages.dynamics[k]];
+    const auto M_next = GetColumns(block, X[k + 1]).fullPivLu();
+    qp.A.push_back(-M_next.solve(GetColumns(block, X[k])));
+    qp.B.push_back(-M_next.solve(GetColumns(block, U[k])));
+    qp.c.push_back(M_next.solve(block.b));
+  }
+
+  // Eliminates the equality constraint between u(N) and u(N-1), if any.
+  if (stages.final_inputs != -1) {
+    const EqualityBlock& block = blocks[stages.final_inputs];
+    const auto M_final = GetColumns(block, U[N]).fullPivLu();
+    // u(N) = G u(N-1) + g.
+    const MatrixXd G = -M_final.solve(GetColumns(block, U[N - 1]));
+    const VectorXd g = M_final.solve(block.b);
+    for (int i = 0; i < nu; ++i) {
+      VariableMap& map = qp.variables[U[N][i]];
+      map.stage = N - 1;
+      map.coefficients = RowVectorXd::Zero(nw);
+      map.coefficients.tail(nu) = G.row(i);
+      map.offset = g(i);
+    }
+  }
+
+  // Returns the matrix T and vector t such that the variables `vars` of a
+  // single stage are T * w(stage) + t.
+  auto map_variables = [&](const std::vector<int>& vars, int* stage) {
+    *stage = FindStage(stages.stage_of, vars, VectorXd::Ones(vars.size()));
+    DRAKE_DEMAND(*stage != -2);
+    MatrixXd T(vars.size(), nw);
+    VectorXd t(vars.size());
+    for (int i = 0; i < static_cast<int>(vars.size()); ++i) {
+      T.row(i) = qp.variables[vars[i]].coefficients;
+      t(i) = qp.variables[vars[i]].offset;
+    }
+    return std::make_pair(std::move(T), std::move(t));
+  };
+
+  // The costs.
+  std::vector<MatrixXd> H(N + 1, MatrixXd::Zero(nw, nw));
+  std::vector<VectorXd> f(N + 1, VectorXd::Zero(nw));
+  if (U[N].empty() || stages.final_inputs != -1) {
+    // The inputs u(N) of FBstab have no variables of their own, and are fixed
+    // at zero by a unit cost.
+    H[N].bottomRightCorner(nu, nu).setIdentity();
+  }
+  for (const auto& binding : prog.quadratic_costs()) {
+    int stage{};
+    const auto [T, t] = map_variables(
+        prog.FindDecisionVariableIndices(binding.variables()), &stage);
+    if (stage == -1) continue;
+    const MatrixXd Q =
+        0.5 * (binding.evaluator()->Q() + binding.evaluator()->Q().transpose());
+    H[stage] += T.transpose() * Q * T;
+    f[stage] += T.transpose() * (Q * t + binding.evaluator()->b());
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    int stage{};
+    const auto Tt = map_variables(
+        prog.FindDecisionVariableIndices(binding.variables()), &stage);
+    if (stage == -1) continue;
+    f[stage] += Tt.first.transpose() * binding.evaluator()->a();
+  }
+  for (int k = 0; k <= N; ++k) {
+    qp.Q.push_back(H[k].topLeftCorner(nx, nx));
+    qp.R.push_back(H[k].bottomRightCorner(nu, nu));
+    qp.S.push_back(H[k].bottomLeftCorner(nu, nx));
+    qp.q.push_back(f[k].head(nx));
+    qp.r.push_back(f[k].tail(nu));
+  }
+
+  // The inequality constraints, as rows e * w(stage) + d <= 0.
+  std::vector<std::vector<std::pair<RowVectorXd, double>>> rows(N + 1);
+  auto add_rows = [&](const std::vector<int>& vars, const MatrixXd& A,
+                      const VectorXd& lower, const VectorXd& upper) {
+    for (int i = 0; i < A.rows(); ++i) {
+      int stage = FindStage(stages.stage_of, vars, A.row(i).transpose());
+      DRAKE_DEMAND(stage != -2);
+      if (stage == -1) stage = 0;
+      RowVectorXd e = RowVectorXd::Zero(nw);
+      double offset = 0;
+      for (int j = 0; j < static_cast<int>(vars.size()); ++j) {
+        if (A(i, j) == 0) continue;
+        e += A(i, j) * qp.variables[vars[j]].coefficients;
+        offset += A(i, j) * qp.variables[vars[j]].offset;
+      }
+      if (std::isfinite(upper(i))) {
+        rows[stage].emplace_back(e, offset - upper(i));
+      }
+      if (std::isfinite(lower(i))) {
+        rows[stage].emplace_back(-e, lower(i) - offset);
+      }
+    }
+  };
+  for (int j : stages.other_blocks) {
+    add_rows(blocks[j].vars, blocks[j].M, blocks[j].b, blocks[j].b);
+  }
+  for (const auto& binding : prog.linear_constraints()) {
+    add_rows(prog.FindDecisionVariableIndices(binding.variables()),
+             binding.evaluator()->A(), binding.evaluator()->lower_bound(),
+             binding.evaluator()->upper_bound());
+  }
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    const std::vector<int> vars =
+        prog.FindDecisionVariableIndices(binding.variables());
+    add_rows(vars, MatrixXd::Identity(vars.size(), vars.size()),
+             binding.evaluator()->lower_bound(),
+             binding.evaluator()->upper_bound());
+  }
+  qp.nc = 1;
+  for (const auto& stage_rows : rows) {
+    qp.nc = std::max<int>(qp.nc, stage_rows.size());
+  }
+  for (int k = 0; k <= N; ++k) {
+    // Stages with fewer rows are padded with 0 <= 1.
+    MatrixXd EL = MatrixXd::Zero(qp.nc, nw);
+    VectorXd d = VectorXd::Constant(qp.nc, -1.0);
+    for (int i = 0; i < static_cast<int>(rows[k].size()); ++i) {
+      EL.row(i) = rows[k][i].first;
+      d(i) = rows[k][i].second;
+    }
+    qp.E.push_back(EL.leftCols(nx));
+    qp.L.push_back(EL.rightCols(nu));
+    qp.d.push_back(std::move(d));
+  }
+  return qp;
+}
+
+void SetFbstabOptions(const SolverOptions& solver_options,
+                      fbstab::FBstabMpc* solver) {
+  solver->SetDisplayLevel(fbstab::FBstabAlgoMpc::Display::OFF);
+  for (const auto& [name, value] :
+       solver_options.GetOptionsDouble(FbstabSolver::id())) {
+    solver->UpdateOption(name.c_str(), value);
+  }
+  for (const auto& [name, value] :
+       solver_options.GetOptionsInt(FbstabSolver::id())) {
+    if (name == "display_level") {
+      solver->SetDisplayLevel(
+          static_cast<fbstab::FBstabAlgoMpc::Display>(value));
+    } else if (name == "check_feasibility" || name == "record_solve_time") {
+      solver->UpdateOption(name.c_str(), value != 0);
+    } else {
+      solver->UpdateOption(name.c_str(), value);
+    }
+  }
+}
+}  // namespace
+
+FbstabSolver::FbstabSolver()
+    : SolverBase(&id, &is_available, &is_enabled,
+                 &ProgramAttributesSatisfied) {}
+
+FbstabSolver::~FbstabSolver() = default;
+
+SolverId FbstabSolver::id() {
+  static const never_destroyed<SolverId> singleton{"FBstab"};
+  return singleton.access();
+}
+
+bool FbstabSolver::is_available() { return true; }
+
+bool FbstabSolver::is_enabled() { return true; }
+
+bool FbstabSolver::ProgramAttributesSatisfied(const MathematicalProgram& prog) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kLinearCost, ProgramAttribute::kQuadraticCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  return AreRequiredAttributesSupported(prog.required_capabilities(),
+                                        solver_capabilities.access()) &&
+         FindStages(prog).has_value();
+}
+
+void FbstabSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  unused(initial_guess);
+  FbstabSolverDetails& solver_details =
+      result->SetSolverDetailsType<FbstabSolverDetails>();
+
+  const std::optional<Stages> stages = FindStages(prog);
+  DRAKE_THROW_UNLESS(stages.has_value());
+  const StageWiseQp qp = LowerToStageWiseQp(prog, *stages);
+  solver_details.horizon = qp.N;
+  solver_details.num_states = qp.nx;
+  solver_details.num_inputs = qp.nu;
+  solver_details.num_stage_constraints = qp.nc;
+
+  fbstab::FBstabMpc::QPData data;
+  data.Q = &qp.Q;
+  data.R = &qp.R;
+  data.S = &qp.S;
+  data.q = &qp.q;
+  data.r = &qp.r;
+  data.A = &qp.A;
+  data.B = &qp.B;
+  data.c = &qp.c;
+  data.E = &qp.E;
+  data.L = &qp.L;
+  data.d = &qp.d;
+  data.x0 = &qp.x0;
+
+  const int nw = qp.nx + qp.nu;
+  VectorXd z = VectorXd::Zero(nw * (qp.N + 1));
+  VectorXd l = VectorXd::Zero(qp.nx * (qp.N + 1));
+  VectorXd v = VectorXd::Zero(qp.nc * (qp.N + 1));
+  VectorXd y = VectorXd::Zero(qp.nc * (qp.N + 1));
+  fbstab::FBstabMpc::QPVariable variables;
+  variables.z = &z;
+  variables.l = &l;
+  variables.v = &v;
+  variables.y = &y;
+
+  fbstab::FBstabMpc solver(qp.N, qp.nx, qp.nu, qp.nc);
+  SetFbstabOptions(merged_options, &solver);
+  // The zero initial guess is passed explicitly; FBstab initializes the
+  // constraint margin y itself.
+  const fbstab::SolverOut out =
+      solver.Solve(data, &variables, true /* use_initial_guess */);
+  solver_details.exit_flag = static_cast<int>(out.eflag);
+  solver_details.residual = out.residual;
+  solver_details.newton_iters = out.newton_iters;
+  solver_details.prox_iters = out.prox_iters;
+
+  VectorXd x_val(prog.num_vars());
+  for (int i = 0; i < prog.num_vars(); ++i) {
+    const VariableMap& map = qp.variables[i];
+    x_val(i) = map.offset +
+               map.coefficients.dot(z.segment(map.stage * nw, nw));
+  }
+  result->set_x_val(x_val);
+
+  switch (out.eflag) {
+    case fbstab::ExitFlag::SUCCESS: {
+      double optimal_cost = 0;
+      for (const auto& binding : prog.GetAllCosts()) {
+        optimal_cost += prog.EvalBinding(binding, x_val)(0);
+      }
+      result->set_optimal_cost(optimal_cost);
+      result->set_solution_result(SolutionResult::kSolutionFound);
+      break;
+    }
+    case fbstab::ExitFlag::PRIMAL_INFEASIBLE:
+    case fbstab::ExitFlag::PRIMAL_DUAL_INFEASIBLE: {
+      result->set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+      result->set_solution_result(SolutionResult::kInfeasibleConstraints);
+      break;
+    }
+    case fbstab::ExitFlag::DUAL_INFEASIBLE: {
+      result->set_optimal_cost(MathematicalProgram::kUnboundedCost);
+      result->set_solution_result(SolutionResult::kDualInfeasible);
+      break;
+    }
+    case fbstab::ExitFlag::MAXITERATIONS: {
+      result->set_solution_result(SolutionResult::kIterationLimit);
+      break;
+    }
+    case fbstab::ExitFlag::DIVERGENCE: {
+      result->set_solution_result(SolutionResult::kUnknownError);
+      break;
+    }
+  }
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * The FBstab solver details after calling Solve() function. The user can call
+ * MathematicalProgramResult::get_solver_details<FbstabSolver>() to obtain the
+ * details.
+ */
+struct FbstabSolverDetails {
+  /// The exit flag of FBstab, see fbstab::ExitFlag (0 means success).
+  int exit_flag{};
+  /// The norm of the optimality residual at termination.
+  double residual{};
+  /// Number of Newton iterations taken.
+  int newton_iters{};
+  /// Number of proximal point iterations taken.
+  int prox_iters{};
+  /// The horizon length N of the detected optimal control problem.
+  int horizon{};
+  /// The number of states nx per stage.
+  int num_states{};
+  /// The number of inputs nu per stage.
+  int num_inputs{};
+  /// The number of inequality constraints nc per stage, including the
+  /// (trivially satisfied) rows that pad stages with fewer constraints.
+  int num_stage_constraints{};
+};
+
+/**
+ * Solves convex quadratic programs that have the stage-wise (block-banded)
+ * structure of a linear-quadratic optimal control problem, such as the ones
+ * built by systems::trajectory_optimization::DirectTranscription for a linear
+ * system or by systems::controllers::LinearModelPredictiveController, with
+ * the FBstab solver for model predictive control (fbstab::FBstabMpc). Its
+ * Newton steps are computed with a Riccati recursion, whose cost is linear in
+ * the horizon length N.
+ *
+ * The stages are detected from the linear equality constraints of the
+ * program, whose variables are partitioned into states x(0), ..., x(N) and
+ * inputs u(0), ..., u(N):
+ * - The initial state x(0) is the set of variables of a linear equality
+ *   constraint that has as many rows as variables and an invertible matrix,
+ *   and whose variables are involved in exactly one other linear equality
+ *   constraint (the dynamics of step 0), with as many rows.
+ * - Given x(k), the dynamics of step k are the only other linear equality
+ *   constraint with nx = |x(k)| rows that involves all of x(k). Its other
+ *   variables are x(k+1) and u(k), where x(k+1) are the variables it shares
+ *   with the dynamics of step k+1. At the last step, x(N) takes the positions
+ *   (in the order of the program's decision variables) that x(N-1) had among
+ *   the variables of the previous step, or else is the first or the last nx
+ *   of them. The matrix of x(k+1) must be invertible, and all steps must have
+ *   the same number of inputs. The horizon N is the number of such steps.
+ * - The remaining variables, if any, are the inputs u(N). A linear equality
+ *   constraint between u(N) and u(N-1) (as DirectTranscription adds for its
+ *   final two inputs) is eliminated by substitution.
+ * - Every row of the other constraints (linear, linear equality, and bounding
+ *   box constraints) and every cost (linear and quadratic) must only involve
+ *   the variables of a single stage.
+ *
+ * ProgramAttributesSatisfied() returns false for programs without this
+ * structure; detecting it takes time linear in the size of the program, and
+ * does not build FBstab's data, which Solve() does once. The solver does not
+ * use the initial guess, and does not set the dual solutions.
+ *
+ * The double-valued and integer-valued solver options are passed to
+ * FBstab by name (e.g., "abs_tol", "max_newton_iters"); see
+ * fbstab::FBstabAlgorithm::UpdateOption(). The integer options
+ * "check_feasibility" and "record_solve_time" are interpreted as booleans,
+ * and "display_level" sets fbstab::FBstabAlgorithm::Display (0, i.e. no
+ * output, by default).
+ */
+class FbstabSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FbstabSolver)
+
+  /// Type of details stored in MathematicalProgramResult.
+  using Details = FbstabSolverDetails;
+
+  FbstabSolver();
+  ~FbstabSolver() final;
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+};
+}  // namespace solvers
+}  // namespace drake
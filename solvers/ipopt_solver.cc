@@ -137,7 +137,11 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern().has_value()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -152,6 +156,9 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// described in
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
+/// The entries are listed in the order of the gradient values from
+/// EvaluatorBase::EvalWithSparseGradient().
+///
 /// @return the number of row/column pairs filled in.
 size_t GetGradientMatrix(
     const MathematicalProgram& prog, const Constraint& c,
@@ -160,10 +167,21 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  const std::vector<int> var_indices =
+      prog.FindDecisionVariableIndices(variables);
+  if (c.gradient_sparsity_pattern().has_value()) {
+    for (const auto& nonzero_entry : c.gradient_sparsity_pattern().value()) {
+      iRow[grad_index] = constraint_idx + nonzero_entry.first;
+      jCol[grad_index] = var_indices[nonzero_entry.second];
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
-      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
+      jCol[grad_index] = var_indices[j];
       grad_index++;
     }
   }
@@ -190,7 +208,7 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
                           const VectorXDecisionVariable& variables,
                           Number* result, Number* grad) {
   // For constraints which don't use all of the variables in the X
-  // input, extract a subset into the AutoDiffVecXd this_x to evaluate
+  // input, extract a subset into this_x to evaluate
   // the constraint (we actually do this for all constraints.  One
   // potential optimization might be to detect if the initial "tx" has
   // the correct geometry (e.g. the constraint uses all decision
@@ -217,34 +235,23 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   }
 
   // Run the version which calculates gradients.
-
-  AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::initializeAutoDiff(this_x), &ty);
+  Eigen::VectorXd ty;
+  Eigen::VectorXd gradient_values;
+  c.EvalWithSparseGradient(this_x, &ty, &gradient_values);
 
   // Store the results.  Since IPOPT directly knows the bounds of the
   // constraint, we don't need to apply any bounding information here.
   for (int i = 0; i < c.num_constraints(); i++) {
-    result[i] = ty(i).value();
+    result[i] = ty(i);
   }
 
-  // Extract the appropriate derivatives from our result into the
-  // gradient array.
-  size_t grad_idx = 0;
-
-  DRAKE_ASSERT(ty.rows() == c.num_constraints());
-  for (int i = 0; i < ty.rows(); i++) {
-    if (ty(i).derivatives().size() > 0) {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = ty(i).derivatives()(j);
-      }
-    } else {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = 0;
-      }
-    }
+  // The gradient values are already in the order of the entries from
+  // GetGradientMatrix.
+  for (int k = 0; k < gradient_values.rows(); k++) {
+    grad[k] = gradient_values(k);
   }
 
-  return grad_idx;
+  return gradient_values.rows();
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.  When
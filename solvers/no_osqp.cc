@@ -7,8 +7,20 @@
 namespace drake {
 namespace solvers {
 
+struct OsqpSolver::Workspace {};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &is_enabled,
+                 &ProgramAttributesSatisfied) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return false; }
 
+void OsqpSolver::set_persistent_workspace(bool enabled) {
+  persistent_workspace_ = enabled;
+}
+
 void OsqpSolver::DoSolve(
     const MathematicalProgram&,
     const Eigen::VectorXd&,
@@ -1,24 +1,45 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
 
 #include "drake/common/text_logging.h"
-#include "drake/math/eigen_sparse_triplet.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/sparse_matrix_cache.h"
 
 namespace drake {
 namespace solvers {
 namespace {
+// Returns the triplets of the nonzero entries of `M`, column by column. Exact
+// zeros are left out, so that a coefficient which becomes zero (or nonzero)
+// changes the sparsity pattern of the assembled matrix.
+std::vector<Eigen::Triplet<double>> NonzeroTriplets(const Eigen::MatrixXd& M) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int j = 0; j < M.cols(); ++j) {
+    for (int i = 0; i < M.rows(); ++i) {
+      if (M(i, j) != 0) {
+        triplets.emplace_back(i, j, M(i, j));
+      }
+    }
+  }
+  return triplets;
+}
+
+// Computes the triplets of the Hessian matrix P, the linear cost q, and the
+// constant cost term.
 void ParseQuadraticCosts(const MathematicalProgram& prog,
-                         Eigen::SparseMatrix<c_float>* P,
+                         std::vector<Eigen::Triplet<c_float>>* P_triplets,
                          std::vector<c_float>* q, double* constant_cost_term) {
   DRAKE_ASSERT(static_cast<int>(q->size()) == prog.num_vars());
 
   // Loop through each quadratic costs in prog, and compute the Hessian matrix
   // P, the linear cost q, and the constant cost term.
-  std::vector<Eigen::Triplet<c_float>> P_triplets;
   for (const auto& quadratic_cost : prog.quadratic_costs()) {
     const VectorXDecisionVariable& x = quadratic_cost.variables();
     // x_indices are the indices of the variables x (the variables bound with
@@ -27,8 +48,8 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
 
     // Add quadratic_cost.Q to the Hessian P.
     const std::vector<Eigen::Triplet<double>> Qi_triplets =
-        math::SparseMatrixToTriplets(quadratic_cost.evaluator()->Q());
-    P_triplets.reserve(P_triplets.size() + Qi_triplets.size());
+        NonzeroTriplets(quadratic_cost.evaluator()->Q());
+    P_triplets->reserve(P_triplets->size() + Qi_triplets.size());
     for (int i = 0; i < static_cast<int>(Qi_triplets.size()); ++i) {
       // Unpack the field of the triplet (for clarity below).
       const int row = x_indices[Qi_triplets[i].row()];
@@ -37,7 +58,7 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
       // Since OSQP 0.6.0 the P matrix is required to be upper triangular, so
       // we only add upper triangular entries to P_triplets.
       if (row <= col) {
-        P_triplets.emplace_back(row, col, static_cast<c_float>(value));
+        P_triplets->emplace_back(row, col, static_cast<c_float>(value));
       }
     }
 
@@ -49,8 +70,6 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
     // Add quadratic_cost.c to constant term
     *constant_cost_term += quadratic_cost.evaluator()->c();
   }
-  P->resize(prog.num_vars(), prog.num_vars());
-  P->setFromTriplets(P_triplets.begin(), P_triplets.end());
 }
 
 void ParseLinearCosts(const MathematicalProgram& prog, std::vector<c_float>* q,
@@ -98,7 +117,7 @@ void ParseLinearConstraints(
     const std::vector<int> x_indices =
         prog.FindDecisionVariableIndices(constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        NonzeroTriplets(constraint.evaluator()->A());
     const Binding<Constraint> constraint_cast =
         internal::BindingDynamicCast<Constraint>(constraint);
     constraint_start_row->emplace(constraint_cast, *num_A_rows);
@@ -148,21 +167,20 @@ void ParseBoundingBoxConstraints(
 }
 
 void ParseAllLinearConstraints(
-    const MathematicalProgram& prog, Eigen::SparseMatrix<c_float>* A,
-    std::vector<c_float>* l, std::vector<c_float>* u,
+    const MathematicalProgram& prog,
+    std::vector<Eigen::Triplet<c_float>>* A_triplets, std::vector<c_float>* l,
+    std::vector<c_float>* u, int* num_A_rows,
     std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
-  std::vector<Eigen::Triplet<c_float>> A_triplets;
+  A_triplets->clear();
   l->clear();
   u->clear();
-  int num_A_rows = 0;
-  ParseLinearConstraints(prog, prog.linear_constraints(), &A_triplets, l, u,
-                         &num_A_rows, constraint_start_row);
-  ParseLinearConstraints(prog, prog.linear_equality_constraints(), &A_triplets,
-                         l, u, &num_A_rows, constraint_start_row);
-  ParseBoundingBoxConstraints(prog, &A_triplets, l, u, &num_A_rows,
+  *num_A_rows = 0;
+  ParseLinearConstraints(prog, prog.linear_constraints(), A_triplets, l, u,
+                         num_A_rows, constraint_start_row);
+  ParseLinearConstraints(prog, prog.linear_equality_constraints(), A_triplets,
+                         l, u, num_A_rows, constraint_start_row);
+  ParseBoundingBoxConstraints(prog, A_triplets, l, u, num_A_rows,
                               constraint_start_row);
-  A->resize(num_A_rows, prog.num_vars());
-  A->setFromTriplets(A_triplets.begin(), A_triplets.end());
 }
 
 // Convert an Eigen::SparseMatrix to csc_matrix, to be used by osqp.
@@ -189,6 +207,55 @@ csc* EigenSparseToCSC(const Eigen::SparseMatrix<c_float>& mat) {
                     inner_indices, outer_indices);
 }
 
+// Sets up the OSQP workspace `work` for the problem
+//   min 0.5 xᵀPx + qᵀx
+//   s.t l ≤ Ax ≤ u
+// and returns the error code of osqp_setup(). OSQP copies the data into the
+// workspace.
+c_int SetupOsqpWorkspace(const Eigen::SparseMatrix<c_float>& P,
+                         std::vector<c_float>* q,
+                         const Eigen::SparseMatrix<c_float>& A,
+                         std::vector<c_float>* l, std::vector<c_float>* u,
+                         const OSQPSettings& settings, OSQPWorkspace** work) {
+  OSQPData data;
+  data.n = P.cols();
+  data.m = A.rows();
+  data.P = EigenSparseToCSC(P);
+  data.q = q->data();
+  data.A = EigenSparseToCSC(A);
+  data.l = l->data();
+  data.u = u->data();
+  const c_int osqp_setup_err = osqp_setup(work, &data, &settings);
+  for (csc* matrix : {data.P, data.A}) {
+    c_free(matrix->x);
+    c_free(matrix->i);
+    c_free(matrix->p);
+    c_free(matrix);
+  }
+  return osqp_setup_err;
+}
+
+// Returns true if all of the settings are the same, so that a workspace set up
+// with `a` can be reused in place of one set up with `b`. This lists every
+// field of OSQPSettings in OSQP v0.6.0 (built with PROFILING).
+bool IsSameOsqpSettings(const OSQPSettings& a, const OSQPSettings& b) {
+  return a.rho == b.rho && a.sigma == b.sigma && a.scaling == b.scaling &&
+         a.adaptive_rho == b.adaptive_rho &&
+         a.adaptive_rho_interval == b.adaptive_rho_interval &&
+         a.adaptive_rho_tolerance == b.adaptive_rho_tolerance &&
+         a.adaptive_rho_fraction == b.adaptive_rho_fraction &&
+         a.max_iter == b.max_iter && a.eps_abs == b.eps_abs &&
+         a.eps_rel == b.eps_rel && a.eps_prim_inf == b.eps_prim_inf &&
+         a.eps_dual_inf == b.eps_dual_inf && a.alpha == b.alpha &&
+         a.linsys_solver == b.linsys_solver && a.delta == b.delta &&
+         a.polish == b.polish &&
+         a.polish_refine_iter == b.polish_refine_iter &&
+         a.verbose == b.verbose &&
+         a.scaled_termination == b.scaled_termination &&
+         a.check_termination == b.check_termination &&
+         a.warm_start == b.warm_start && a.time_limit == b.time_limit;
+}
+
 template <typename T1, typename T2>
 void SetOsqpSolverSetting(const std::unordered_map<std::string, T1>& options,
                           const std::string& option_name,
@@ -252,8 +319,37 @@ void SetDualSolution(
 }
 }  // namespace
 
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace() = default;
+  ~Workspace() { osqp_cleanup(work); }
+
+  OSQPWorkspace* work{nullptr};
+  // The matrices of the workspace. The workspace can be reused when their
+  // sparsity patterns and the settings do not change; new values of P and A
+  // are then copied into the workspace with osqp_update_P_A().
+  internal::SparseMatrixCache P;
+  internal::SparseMatrixCache A;
+  OSQPSettings settings{};
+};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &is_enabled,
+                 &ProgramAttributesSatisfied) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return true; }
 
+void OsqpSolver::set_persistent_workspace(bool enabled) {
+  std::lock_guard<std::mutex> lock(workspace_mutex_);
+  persistent_workspace_ = enabled;
+  if (!enabled) {
+    workspace_.reset();
+  }
+}
+
 void OsqpSolver::DoSolve(
     const MathematicalProgram& prog,
     const Eigen::VectorXd& initial_guess,
@@ -276,11 +372,11 @@ void OsqpSolver::DoSolve(
   // OSQP is written in C, so this function will be in C style.
 
   // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
+  std::vector<Eigen::Triplet<c_float>> P_triplets;
   std::vector<c_float> q(prog.num_vars(), 0);
   double constant_cost_term{0};
 
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
+  ParseQuadraticCosts(prog, &P_triplets, &q, &constant_cost_term);
   ParseLinearCosts(prog, &q, &constant_cost_term);
 
   // linear_constraint_start_row[binding] stores the starting row index in A
@@ -288,43 +384,71 @@ void OsqpSolver::DoSolve(
   std::unordered_map<Binding<Constraint>, int> constraint_start_row;
 
   // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
+  std::vector<Eigen::Triplet<c_float>> A_triplets;
   std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
-
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+  int num_A_rows{};
+  ParseAllLinearConstraints(prog, &A_triplets, &l, &u, &num_A_rows,
+                            &constraint_start_row);
 
   // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-
-  SetOsqpSolverSettings(merged_options, settings);
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+  SetOsqpSolverSettings(merged_options, &settings);
+
+  // Take the persistent workspace (if any) for the duration of this solve.
+  std::unique_lock<std::mutex> lock(workspace_mutex_);
+  const bool persistent = persistent_workspace_;
+  std::unique_ptr<Workspace> workspace;
+  if (persistent) {
+    workspace = std::move(workspace_);
+  } else {
+    lock.unlock();
+  }
 
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
-    if (osqp_setup_err != 0) {
+  // Assemble P and A. With a persistent workspace, only their values are
+  // written when their sparsity patterns have not changed.
+  using Change = internal::SparseMatrixCache::Change;
+  internal::SparseMatrixCache P_cache, A_cache;
+  internal::SparseMatrixCache& P = workspace ? workspace->P : P_cache;
+  internal::SparseMatrixCache& A = workspace ? workspace->A : A_cache;
+  const Change P_change =
+      P.Assemble(prog.num_vars(), prog.num_vars(), P_triplets);
+  const Change A_change = A.Assemble(num_A_rows, prog.num_vars(), A_triplets);
+
+  // Reuse the workspace when the sparsity patterns of P and A and the
+  // settings are the same; otherwise setup a new workspace.
+  solver_details.workspace_reused =
+      workspace != nullptr && P_change != Change::kPattern &&
+      A_change != Change::kPattern &&
+      IsSameOsqpSettings(workspace->settings, settings);
+  if (solver_details.workspace_reused) {
+    // osqp_update_P_A() factorizes the KKT matrix again, so it is only called
+    // when the values changed.
+    if ((P_change == Change::kValues || A_change == Change::kValues) &&
+        osqp_update_P_A(workspace->work, P.matrix().valuePtr(), OSQP_NULL,
+                        P.matrix().nonZeros(), A.matrix().valuePtr(),
+                        OSQP_NULL, A.matrix().nonZeros()) != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+    if (osqp_update_lin_cost(workspace->work, q.data()) != 0 ||
+        osqp_update_bounds(workspace->work, l.data(), u.data()) != 0) {
       solution_result = SolutionResult::kInvalidInput;
     }
+  } else {
+    auto new_workspace = std::make_unique<Workspace>();
+    if (SetupOsqpWorkspace(P.matrix(), &q, A.matrix(), &l, &u, settings,
+                           &new_workspace->work) != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+    new_workspace->P = std::move(P);
+    new_workspace->A = std::move(A);
+    new_workspace->settings = settings;
+    workspace = std::move(new_workspace);
   }
+  OSQPWorkspace* const work = workspace->work;
 
   // Solve problem.
   if (!solution_result) {
@@ -390,18 +514,11 @@ void OsqpSolver::DoSolve(
   }
   result->set_solution_result(solution_result.value());
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Keep the workspace for the next solve, unless it failed. Otherwise, the
+  // workspace is cleaned up here.
+  if (persistent && solution_result == SolutionResult::kSolutionFound) {
+    workspace_ = std::move(workspace);
+  }
 }
 
 }  // namespace solvers
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -33,6 +37,9 @@ struct OsqpSolverDetails {
   /// the problem. Notice that the order of the linear constraints are linear
   /// inequality first, and then linear equality constraints.
   Eigen::VectorXd y{};
+  /// Whether the solve reused the OSQP workspace of the previous solve. See
+  /// OsqpSolver::set_persistent_workspace().
+  bool workspace_reused{false};
 };
 
 class OsqpSolver final : public SolverBase {
@@ -56,9 +63,46 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// @name Persistent workspace
+  /// By default, every call to Solve() sets up (and factorizes) a new OSQP
+  /// workspace. When the persistent workspace is enabled, this solver instead
+  /// keeps the workspace of its most recent successful Solve(). If the next
+  /// program has the same sparsity pattern of the quadratic cost Hessian and
+  /// of the linear constraint matrix and the solver options are the same,
+  /// the workspace is updated in place and warm-starts the iterations from
+  /// the previous primal and dual solution. When the Hessian and the
+  /// constraint matrix also have the same values, only the linear cost and
+  /// the constraint bounds are copied, and OSQP's factorization is reused;
+  /// otherwise the new values are copied into the existing matrices and
+  /// refactorized, which skips the setup of a new workspace.
+  ///
+  /// This suits a program that is built once and re-solved many times after
+  /// changing only its data, e.g. with LinearConstraint::set_bounds() or
+  /// LinearConstraint::UpdateCoefficients() without changing which entries
+  /// are nonzero, as in a model predictive controller. The initial guess
+  /// passed to Solve() is ignored either way. Concurrent calls to Solve() on
+  /// the same instance are serialized while the persistent workspace is
+  /// enabled.
+  //@{
+  /// Enables or disables the persistent workspace. Disabling it releases
+  /// the workspace.
+  void set_persistent_workspace(bool enabled);
+  bool persistent_workspace() const { return persistent_workspace_; }
+  //@}
+
  private:
+  struct Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  // Written under workspace_mutex_, and atomic so that persistent_workspace()
+  // may read it without the lock.
+  std::atomic<bool> persistent_workspace_{false};
+  // The workspace of the most recent successful Solve(), when
+  // persistent_workspace_ is true.
+  mutable std::unique_ptr<Workspace> workspace_;
+  mutable std::mutex workspace_mutex_;
 };
 }  // namespace solvers
 }  // namespace drake
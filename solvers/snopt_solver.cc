@@ -337,26 +337,28 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
-// Evaluate a single nonlinear constraints. For generic Constraint,
-// LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
-// of the constraint directly. For some other constraint, such as
-// LinearComplementaryConstraint, we will evaluate its nonlinear constraint
-// differently, than its Eval function.
+// Evaluate a single nonlinear constraints, together with its gradient values
+// in the order of EvaluatorBase::EvalWithSparseGradient(). For generic
+// Constraint, LorentzConeConstraint, RotatedLorentzConeConstraint, we call
+// EvalWithSparseGradient function of the constraint directly. For some other
+// constraint, such as LinearComplementaryConstraint, we will evaluate its
+// nonlinear constraint differently, than its Eval function.
 template <typename C>
 void EvaluateSingleNonlinearConstraint(
-    const C& constraint, const Eigen::Ref<const AutoDiffVecXd>& tx,
-    AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(tx, ty);
+    const C& constraint, const Eigen::Ref<const Eigen::VectorXd>& tx,
+    Eigen::VectorXd* ty, Eigen::VectorXd* gradient_values) {
+  constraint.EvalWithSparseGradient(tx, ty, gradient_values);
 }
 
 template <>
 void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
     const LinearComplementarityConstraint& constraint,
-    const Eigen::Ref<const AutoDiffVecXd>& tx, AutoDiffVecXd* ty) {
+    const Eigen::Ref<const Eigen::VectorXd>& tx, Eigen::VectorXd* ty,
+    Eigen::VectorXd* gradient_values) {
+  const Eigen::VectorXd Mx_plus_q = constraint.M() * tx + constraint.q();
   ty->resize(1);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+  (*ty)(0) = tx.dot(Mx_plus_q);
+  *gradient_values = Mx_plus_q + constraint.M().transpose() * tx;
 }
 
 /*
@@ -379,6 +381,8 @@ void EvaluateNonlinearConstraints(
     size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
   const auto & scale_map = prog.GetVariableScaling();
   Eigen::VectorXd this_x;
+  Eigen::VectorXd ty;
+  Eigen::VectorXd gradient_values;
   for (const auto& binding : constraint_list) {
     const auto& c = binding.evaluator();
     int num_constraints = SingleNonlinearConstraintSize(*c);
@@ -388,51 +392,38 @@ void EvaluateNonlinearConstraints(
     // binding_var_indices[i] is the index of binding.variables()(i) in prog's
     // decision variables.
     std::vector<int> binding_var_indices(num_variables);
+    // this_x_scale(i) is the scaling factor of this_x(i), namely
+    // ∂this_x_scaled(i)/∂this_x(i).
+    Eigen::VectorXd this_x_scale = Eigen::VectorXd::Ones(num_variables);
     for (int i = 0; i < num_variables; ++i) {
       binding_var_indices[i] =
           prog.FindDecisionVariableIndex(binding.variables()(i));
       this_x(i) = xvec(binding_var_indices[i]);
-    }
-
-    // Scale this_x
-    auto this_x_scaled = math::initializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
       auto it = scale_map.find(binding_var_indices[i]);
       if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
+        this_x_scale(i) = it->second;
       }
     }
 
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
+    // Scale this_x
+    const Eigen::VectorXd this_x_scaled = this_x.cwiseProduct(this_x_scale);
+
+    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty,
+                                      &gradient_values);
 
     for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
+      F[(*constraint_index)++] = ty(i);
     }
 
+    // Apply the chain rule through the scaling of this_x.
     const std::optional<std::vector<std::pair<int, int>>>&
         gradient_sparsity_pattern =
             binding.evaluator()->gradient_sparsity_pattern();
-    if (gradient_sparsity_pattern.has_value()) {
-      for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
-            ty(nonzero_entry.first).derivatives().size() > 0
-                ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
-                : 0.0;
-      }
-    } else {
-      for (int i = 0; i < num_constraints; i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
-          }
-        }
-      }
+    for (int k = 0; k < gradient_values.rows(); ++k) {
+      const int col = gradient_sparsity_pattern.has_value()
+                          ? (*gradient_sparsity_pattern)[k].second
+                          : k % num_variables;
+      G[(*grad_index)++] = gradient_values(k) * this_x_scale(col);
     }
   }
 }
@@ -0,0 +1,89 @@
+#include "drake/solvers/sparse_matrix_cache.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+SparseMatrixCache::Change SparseMatrixCache::Assemble(
+    int rows, int cols, const std::vector<Eigen::Triplet<double>>& triplets) {
+  const int num_triplets = triplets.size();
+  bool same_pattern = matrix_.rows() == rows && matrix_.cols() == cols &&
+                      static_cast<int>(triplet_indices_.size()) == num_triplets;
+  for (int k = 0; k < num_triplets && same_pattern; ++k) {
+    same_pattern = triplet_indices_[k].first == triplets[k].row() &&
+                   triplet_indices_[k].second == triplets[k].col();
+  }
+  if (!same_pattern) {
+    Rebuild(rows, cols, triplets);
+    return Change::kPattern;
+  }
+  std::fill(new_values_.begin(), new_values_.end(), 0.0);
+  for (int k = 0; k < num_triplets; ++k) {
+    new_values_[value_indices_[k]] += triplets[k].value();
+  }
+  double* const values = matrix_.valuePtr();
+  if (std::equal(new_values_.begin(), new_values_.end(), values)) {
+    return Change::kNone;
+  }
+  std::copy(new_values_.begin(), new_values_.end(), values);
+  return Change::kValues;
+}
+
+void SparseMatrixCache::Rebuild(
+    int rows, int cols, const std::vector<Eigen::Triplet<double>>& triplets) {
+  const int num_triplets = triplets.size();
+  triplet_indices_.resize(num_triplets);
+  for (int k = 0; k < num_triplets; ++k) {
+    DRAKE_ASSERT(triplets[k].row() >= 0 && triplets[k].row() < rows);
+    DRAKE_ASSERT(triplets[k].col() >= 0 && triplets[k].col() < cols);
+    triplet_indices_[k] = {triplets[k].row(), triplets[k].col()};
+  }
+  // Sort the triplets in column major order; the entries with the same row
+  // and column are then adjacent, and share one slot in the value array.
+  std::vector<int> order(num_triplets);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+    return std::make_pair(triplet_indices_[a].second,
+                          triplet_indices_[a].first) <
+           std::make_pair(triplet_indices_[b].second,
+                          triplet_indices_[b].first);
+  });
+  value_indices_.resize(num_triplets);
+  std::vector<int> inner_indices;
+  std::vector<int> column_sizes(cols, 0);
+  inner_indices.reserve(num_triplets);
+  for (int k = 0; k < num_triplets; ++k) {
+    const int triplet = order[k];
+    if (k == 0 || triplet_indices_[triplet] != triplet_indices_[order[k - 1]]) {
+      inner_indices.push_back(triplet_indices_[triplet].first);
+      ++column_sizes[triplet_indices_[triplet].second];
+    }
+    value_indices_[triplet] = static_cast<int>(inner_indices.size()) - 1;
+  }
+
+  const int nnz = inner_indices.size();
+  matrix_.resize(rows, cols);
+  matrix_.resizeNonZeros(nnz);
+  int* const outer = matrix_.outerIndexPtr();
+  outer[0] = 0;
+  for (int j = 0; j < cols; ++j) {
+    outer[j + 1] = outer[j] + column_sizes[j];
+  }
+  std::copy(inner_indices.begin(), inner_indices.end(),
+            matrix_.innerIndexPtr());
+  new_values_.assign(nnz, 0.0);
+  for (int k = 0; k < num_triplets; ++k) {
+    new_values_[value_indices_[k]] += triplets[k].value();
+  }
+  std::copy(new_values_.begin(), new_values_.end(), matrix_.valuePtr());
+  DRAKE_ASSERT(matrix_.isCompressed());
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/**
+ * Assembles a sparse matrix in the compressed column (CSC) format from a list
+ * of triplets, as Eigen::SparseMatrix::setFromTriplets() does (duplicate
+ * entries are summed), and remembers where each triplet is stored in the
+ * compressed value array.
+ *
+ * The solver interfaces parse the costs and constraints of a
+ * MathematicalProgram into triplets in a fixed order. When only the
+ * coefficients of the program change between two solves (for example through
+ * LinearConstraint::UpdateCoefficients() without changing its sparsity
+ * pattern), the triplets have the same (row, column) sequence, and Assemble()
+ * writes the new values into the existing arrays in time linear in the
+ * number of triplets, without sorting the triplets nor allocating memory. The
+ * solver can then hand the new values to its own copy of the matrix (e.g.,
+ * osqp_update_P_A()) instead of setting the problem up again.
+ */
+class SparseMatrixCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SparseMatrixCache)
+
+  /** What changed in the matrix in the last call to Assemble(). */
+  enum class Change {
+    kNone,     ///< Neither the sparsity pattern nor the values changed.
+    kValues,   ///< The sparsity pattern is the same, some values changed.
+    kPattern,  ///< The matrix was rebuilt with a new sparsity pattern.
+  };
+
+  SparseMatrixCache() = default;
+
+  /**
+   * Sets the matrix to the `rows` x `cols` matrix whose entries are the sums
+   * of the values of the @p triplets with the same row and column.
+   */
+  Change Assemble(int rows, int cols,
+                  const std::vector<Eigen::Triplet<double>>& triplets);
+
+  /** The compressed matrix of the last call to Assemble(). */
+  const Eigen::SparseMatrix<double>& matrix() const { return matrix_; }
+
+ private:
+  // Builds matrix_ (with a new sparsity pattern) from the triplets.
+  void Rebuild(int rows, int cols,
+               const std::vector<Eigen::Triplet<double>>& triplets);
+
+  Eigen::SparseMatrix<double> matrix_;
+  // The (row, column) of each triplet that matrix_ was built from.
+  std::vector<std::pair<int, int>> triplet_indices_;
+  // value_indices_[k] is the index in matrix_.valuePtr() of triplet k.
+  std::vector<int> value_indices_;
+  // Scratch space for the new values, of size matrix_.nonZeros().
+  std::vector<double> new_values_;
+};
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/mixed_integer_optimization_util.h"
 #include "drake/solvers/scs_solver.h"
@@ -1275,6 +1276,107 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, NodeCallbackTest) {
   dut.BranchAndUpdate(dut.mutable_root(), x(2));
   EXPECT_EQ(num_visited_nodes, 5);
 }
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  // Branches on several nodes of prog2 concurrently, and checks that the
+  // result is the same as that of the serial branch-and-bound in TestSolve2.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      for (bool search_by_rounding : {false, true}) {
+        MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+        bnb.SetNodeSelectionMethod(pick_node);
+        bnb.SetVariableSelectionMethod(pick_variable);
+        bnb.SetSearchIntegralSolutionByRounding(search_by_rounding);
+        bnb.set_num_parallel_executions(4);
+        EXPECT_EQ(bnb.num_parallel_executions(), 4);
+        int num_visited_nodes = 0;
+        bnb.SetUserDefinedNodeCallbackFunction(
+            [&num_visited_nodes](const MixedIntegerBranchAndBoundNode&,
+                                 MixedIntegerBranchAndBound*) {
+              ++num_visited_nodes;
+            });
+
+        const SolutionResult solution_result = bnb.Solve();
+        EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+        const double tol{1E-3};
+        EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+        Eigen::Matrix<double, 5, 1> x_expected0;
+        x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+        EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                    MatrixCompareType::absolute));
+        EXPECT_LE(bnb.best_lower_bound(), bnb.best_upper_bound());
+        // The root node is not integral, so at least one node is branched on.
+        EXPECT_GE(num_visited_nodes, 3);
+      }
+    }
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel2) {
+  // The same program as in TestMultipleIntegralSolution1, solved by branching
+  // on several nodes concurrently.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<5>("x");
+  auto y = prog.NewBinaryVariables<4>("y");
+  AddSos2Constraint(&prog, x.cast<symbolic::Expression>(),
+                    y.cast<symbolic::Expression>());
+  prog.AddLinearCost(x(1) + 2 * x(2) + 3 * x(3) + 4 * x(4));
+  prog.AddLinearConstraint(3 * x(0) + x(1) + 2 * x(2) + 5 * x(3) + x(4) == 4);
+  prog.AddBoundingBoxConstraint(0, 1, x);
+
+  for (int num_parallel_executions : {2, kUseHardwareConcurrency}) {
+    MixedIntegerBranchAndBound bnb(prog, GurobiSolver::id());
+    bnb.set_num_parallel_executions(num_parallel_executions);
+    EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+    const double tol{1E-3};
+    EXPECT_NEAR(bnb.GetOptimalCost(), 8.0 / 3, tol);
+    Eigen::Matrix<double, 9, 1> xy_expected;
+    xy_expected << 0, 0, 1.0 / 3, 2.0 / 3, 0, 0, 0, 1, 0;
+    VectorDecisionVariable<9> xy;
+    xy << x, y;
+    EXPECT_TRUE(CompareMatrices(bnb.GetSolution(xy), xy_expected, tol));
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelInfeasible) {
+  auto prog = ConstructMathematicalProgram4();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  bnb.set_num_parallel_executions(3);
+  EXPECT_EQ(bnb.Solve(), SolutionResult::kInfeasibleConstraints);
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallelError) {
+  auto prog = ConstructMathematicalProgram2();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_EQ(bnb.num_parallel_executions(), kNoConcurrency);
+  EXPECT_THROW(bnb.set_num_parallel_executions(0), std::exception);
+  bnb.set_num_parallel_executions(2);
+  bnb.SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kUserDefined);
+  bnb.SetUserDefinedNodeSelectionFunction(
+      [](const MixedIntegerBranchAndBound& branch_and_bound) {
+        return const_cast<MixedIntegerBranchAndBoundNode*>(
+            branch_and_bound.root());
+      });
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      bnb.Solve(), std::runtime_error,
+      "The user defined node selection function is not supported when "
+      "branching on nodes in parallel.");
+
+  // An exception thrown by a worker reaches the caller.
+  bnb.SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kDepthFirst);
+  bnb.SetVariableSelectionMethod(
+      MixedIntegerBranchAndBound::VariableSelectionMethod::kUserDefined);
+  bnb.SetUserDefinedVariableSelectionFunction(
+      [](const MixedIntegerBranchAndBoundNode&) -> const symbolic::Variable* {
+        throw std::runtime_error("Cannot pick a variable.");
+      });
+  DRAKE_EXPECT_THROWS_MESSAGE(bnb.Solve(), std::runtime_error,
+                              "Cannot pick a variable.");
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
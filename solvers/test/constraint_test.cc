@@ -87,6 +87,30 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+
+GTEST_TEST(testConstraint, testLinearConstraintEvalWithSparseGradient) {
+  Eigen::Matrix<double, 2, 3> A;
+  // clang-format off
+  A << 1, 0, 2,
+       0, 3, 4;
+  // clang-format on
+  LinearConstraint constraint(A, Vector2d::Zero(), Vector2d::Ones());
+  const Vector3d x(1, 2, 3);
+  VectorXd y, gradient_values;
+
+  // Without a sparsity pattern, the gradient is A in row-major order.
+  constraint.EvalWithSparseGradient(x, &y, &gradient_values);
+  EXPECT_TRUE(CompareMatrices(y, A * x));
+  EXPECT_TRUE(CompareMatrices(
+      gradient_values, (VectorXd(6) << 1, 0, 2, 0, 3, 4).finished()));
+
+  // With a sparsity pattern, only its entries of A are reported.
+  constraint.SetGradientSparsityPattern({{1, 2}, {0, 0}, {1, 1}, {0, 2}});
+  constraint.EvalWithSparseGradient(x, &y, &gradient_values);
+  EXPECT_TRUE(CompareMatrices(y, A * x));
+  EXPECT_TRUE(CompareMatrices(gradient_values, Eigen::Vector4d(4, 1, 3, 2)));
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
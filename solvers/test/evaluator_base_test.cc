@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -275,6 +276,116 @@ GTEST_TEST(EvaluatorBaseTest, DynamicSizedEvaluatorTest) {
       fmt::format("{}", evaluator),
       "DynamicSizedEvaluator with 1 decision variables dynamic_sized_variable");
 }
+
+GTEST_TEST(EvaluatorBaseTest, DynamicSizedEvalWithSparseGradient) {
+  DynamicSizedEvaluator evaluator{};
+  const Eigen::Vector3d x(1, 2, 3);
+  VectorXd y, gradient_values;
+  evaluator.EvalWithSparseGradient(x, &y, &gradient_values);
+  EXPECT_TRUE(CompareMatrices(y, Vector1d(6)));
+  EXPECT_TRUE(CompareMatrices(gradient_values, Eigen::Vector3d::Ones()));
+}
+
+/**
+ * An evaluator whose gradient is sparse.
+ *   y(0) = x(0)²
+ *   y(1) = x(1) * x(2)
+ *   y(2) = x(3) * (1 + x(0))
+ *   y(3) = sin(x(1)) + x(4)
+ */
+class SparseGradientEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseGradientEvaluator)
+
+  SparseGradientEvaluator() : EvaluatorBase(4, 5) {}
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    DoEvalGeneric(x.cast<symbolic::Expression>(), y);
+  }
+
+ private:
+  template <typename DerivedX, typename ScalarY>
+  void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
+                     VectorX<ScalarY>* y) const {
+    using std::sin;
+    y->resize(4);
+    (*y)(0) = x(0) * x(0);
+    (*y)(1) = x(1) * x(2);
+    (*y)(2) = x(3) * (1 + x(0));
+    (*y)(3) = sin(x(1)) + x(4);
+  }
+};
+
+GTEST_TEST(EvaluatorBaseTest, EvalWithSparseGradient) {
+  SparseGradientEvaluator evaluator;
+  const Eigen::VectorXd x = (Eigen::VectorXd(5) << 1, 2, 3, 4, 5).finished();
+  AutoDiffVecXd y_autodiff;
+  evaluator.Eval(math::initializeAutoDiff(x), &y_autodiff);
+  const Eigen::MatrixXd y_expected = math::autoDiffToValueMatrix(y_autodiff);
+  const Eigen::MatrixXd dy_expected =
+      math::autoDiffToGradientMatrix(y_autodiff);
+
+  // Without a sparsity pattern, the gradient is dense and in row-major order.
+  VectorXd y, gradient_values;
+  evaluator.EvalWithSparseGradient(x, &y, &gradient_values);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  ASSERT_EQ(gradient_values.rows(), 20);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      EXPECT_EQ(gradient_values(i * 5 + j), dy_expected(i, j));
+    }
+  }
+
+  // With a sparsity pattern (listed in an arbitrary order), only the entries
+  // in the pattern are reported, in the pattern's order. (The default
+  // implementation evaluates them with only two derivatives, one for columns
+  // {0, 1} and one for columns {2, 3, 4}.)
+  const std::vector<std::pair<int, int>> pattern{
+      {3, 4}, {0, 0}, {1, 1}, {2, 3}, {1, 2}, {2, 0}, {3, 1}};
+  evaluator.SetGradientSparsityPattern(pattern);
+  evaluator.EvalWithSparseGradient(x, &y, &gradient_values);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  ASSERT_EQ(gradient_values.rows(), static_cast<int>(pattern.size()));
+  for (int k = 0; k < static_cast<int>(pattern.size()); ++k) {
+    EXPECT_DOUBLE_EQ(gradient_values(k),
+                     dy_expected(pattern[k].first, pattern[k].second));
+  }
+}
+
+// An incomplete sparsity pattern gives the wrong gradient, which is caught when
+// assertions are armed.
+GTEST_TEST(EvaluatorBaseTest, EvalWithIncompleteSparsityPattern) {
+  SparseGradientEvaluator evaluator;
+  const Eigen::VectorXd x = (Eigen::VectorXd(5) << 1, 2, 3, 4, 5).finished();
+  VectorXd y, gradient_values;
+
+  // Without (2, 0), columns 0 and 3 share a derivative, so that the reported
+  // ∂y2/∂x3 also includes ∂y2/∂x0.
+  evaluator.SetGradientSparsityPattern(
+      {{3, 4}, {0, 0}, {1, 1}, {2, 3}, {1, 2}, {3, 1}});
+  DRAKE_EXPECT_THROWS_MESSAGE_IF_ARMED(
+      evaluator.EvalWithSparseGradient(x, &y, &gradient_values),
+      std::logic_error, ".*SparseGradientEvaluator reported.*incomplete.*");
+
+  // Without (3, 4), the reported entries are right but ∂y3/∂x4 is dropped.
+  evaluator.SetGradientSparsityPattern(
+      {{0, 0}, {1, 1}, {2, 3}, {1, 2}, {2, 0}, {3, 1}});
+  DRAKE_EXPECT_THROWS_MESSAGE_IF_ARMED(
+      evaluator.EvalWithSparseGradient(x, &y, &gradient_values),
+      std::logic_error, ".*does not contain \\(3, 4\\).*");
+}
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,210 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+
+using symbolic::Expression;
+
+// A linear-quadratic optimal control problem of a discretized double
+// integrator, x(k+1) = A x(k) + B u(k), from x(0) = (1, 0) over `num_steps`
+// steps.
+class DoubleIntegratorProblem {
+ public:
+  explicit DoubleIntegratorProblem(int num_steps) {
+    A_ << 1, 0.1, 0, 1;
+    B_ << 0.005, 0.1;
+    for (int k = 0; k <= num_steps; ++k) {
+      x_.push_back(prog_.NewContinuousVariables<2>("x"));
+    }
+    for (int k = 0; k <= num_steps; ++k) {
+      u_.push_back(prog_.NewContinuousVariables<1>("u"));
+    }
+    prog_.AddLinearEqualityConstraint(
+        Eigen::Matrix2d::Identity(), Eigen::Vector2d(1, 0), x_[0]);
+    for (int k = 0; k < num_steps; ++k) {
+      const VectorX<Expression> x = x_[k].cast<Expression>();
+      const VectorX<Expression> u = u_[k].cast<Expression>();
+      prog_.AddLinearEqualityConstraint(x_[k + 1] == A_ * x + B_ * u);
+      prog_.AddQuadraticCost(x.dot(x) + u.dot(u));
+    }
+    prog_.AddQuadraticCost(10 * x_[num_steps].cast<Expression>().squaredNorm());
+  }
+
+  MathematicalProgram& prog() { return prog_; }
+
+  double u(const MathematicalProgramResult& result, int k) const {
+    return result.GetSolution(u_[k](0));
+  }
+  const VectorX<symbolic::Variable>& u_variables(int k) const { return u_[k]; }
+
+ private:
+  MathematicalProgram prog_;
+  Eigen::Matrix2d A_;
+  Eigen::Vector2d B_;
+  std::vector<VectorX<symbolic::Variable>> x_;
+  std::vector<VectorX<symbolic::Variable>> u_;
+};
+
+GTEST_TEST(FbstabSolverTest, Unconstrained) {
+  const int kNumSteps = 20;
+  DoubleIntegratorProblem problem(kNumSteps);
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(problem.prog()));
+  const MathematicalProgramResult result = solver.Solve(problem.prog());
+  ASSERT_TRUE(result.is_success());
+  const FbstabSolverDetails& details =
+      result.get_solver_details<FbstabSolver>();
+  EXPECT_EQ(details.exit_flag, 0);
+  EXPECT_EQ(details.horizon, kNumSteps);
+  EXPECT_EQ(details.num_states, 2);
+  EXPECT_EQ(details.num_inputs, 1);
+  EXPECT_EQ(details.num_stage_constraints, 1);
+
+  // Without inequality constraints, the solution is that of the KKT system.
+  const MathematicalProgramResult expected =
+      EqualityConstrainedQPSolver().Solve(problem.prog());
+  ASSERT_TRUE(expected.is_success());
+  // FBstab's default tolerances are of the order of 1E-6.
+  const double tol = 1E-5;
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), expected.get_x_val(), tol));
+  EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), tol);
+}
+
+GTEST_TEST(FbstabSolverTest, InputBounds) {
+  const int kNumSteps = 20;
+  DoubleIntegratorProblem problem(kNumSteps);
+  const double kInf = std::numeric_limits<double>::infinity();
+  for (int k = 0; k <= kNumSteps; ++k) {
+    problem.prog().AddBoundingBoxConstraint(-0.5, kInf,
+                                            problem.u_variables(k));
+  }
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(problem.prog()));
+  const MathematicalProgramResult result = solver.Solve(problem.prog());
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_details<FbstabSolver>().num_stage_constraints,
+            1);
+  const double tol = 1E-5;
+  // The unconstrained optimal input is below the bound at the first step.
+  EXPECT_NEAR(problem.u(result, 0), -0.5, tol);
+  for (int k = 0; k <= kNumSteps; ++k) {
+    EXPECT_GE(problem.u(result, k), -0.5 - tol);
+  }
+
+  OsqpSolver osqp;
+  if (osqp.available()) {
+    const MathematicalProgramResult expected = osqp.Solve(problem.prog());
+    ASSERT_TRUE(expected.is_success());
+    EXPECT_TRUE(
+        CompareMatrices(result.get_x_val(), expected.get_x_val(), 1E-4));
+  }
+}
+
+// The inputs of the final two steps are constrained to be equal, as in
+// systems::trajectory_optimization::DirectTranscription.
+GTEST_TEST(FbstabSolverTest, EqualFinalInputs) {
+  const int kNumSteps = 10;
+  DoubleIntegratorProblem problem(kNumSteps);
+  const symbolic::Variable& u_final = problem.u_variables(kNumSteps)(0);
+  problem.prog().AddLinearEqualityConstraint(
+      u_final == problem.u_variables(kNumSteps - 1)(0));
+  problem.prog().AddQuadraticCost(u_final * u_final);
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(problem.prog()));
+  const MathematicalProgramResult result = solver.Solve(problem.prog());
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_details<FbstabSolver>().horizon, kNumSteps);
+  const MathematicalProgramResult expected =
+      EqualityConstrainedQPSolver().Solve(problem.prog());
+  ASSERT_TRUE(expected.is_success());
+  const double tol = 1E-5;
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), expected.get_x_val(), tol));
+  EXPECT_NEAR(problem.u(result, kNumSteps), problem.u(result, kNumSteps - 1),
+              tol);
+}
+
+// The states and inputs are interleaved, so that x(N) is not the first nx
+// variables of the final dynamics besides x(N-1).
+GTEST_TEST(FbstabSolverTest, InterleavedVariables) {
+  const int kNumSteps = 10;
+  MathematicalProgram prog;
+  std::vector<VectorX<symbolic::Variable>> x, u;
+  for (int k = 0; k <= kNumSteps; ++k) {
+    x.push_back(prog.NewContinuousVariables<2>("x"));
+    u.push_back(prog.NewContinuousVariables<1>("u"));
+  }
+  Eigen::Matrix2d A;
+  A << 1, 0.1, 0, 1;
+  const Eigen::Vector2d B(0.005, 0.1);
+  prog.AddLinearEqualityConstraint(Eigen::Matrix2d::Identity(),
+                                   Eigen::Vector2d(1, 0), x[0]);
+  for (int k = 0; k < kNumSteps; ++k) {
+    prog.AddLinearEqualityConstraint(
+        x[k + 1] == A * x[k].cast<Expression>() + B * u[k].cast<Expression>());
+    prog.AddQuadraticCost(x[k].cast<Expression>().squaredNorm() +
+                          u[k].cast<Expression>().squaredNorm());
+  }
+  prog.AddQuadraticCost(x[kNumSteps].cast<Expression>().squaredNorm());
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(prog));
+  const MathematicalProgramResult result = solver.Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_EQ(result.get_solver_details<FbstabSolver>().horizon, kNumSteps);
+  const MathematicalProgramResult expected =
+      EqualityConstrainedQPSolver().Solve(prog);
+  ASSERT_TRUE(expected.is_success());
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), expected.get_x_val(), 1E-5));
+}
+
+GTEST_TEST(FbstabSolverTest, InfeasibleProgram) {
+  const int kNumSteps = 5;
+  DoubleIntegratorProblem problem(kNumSteps);
+  // From x(0) = (1, 0), the position cannot reach 10 with bounded inputs.
+  for (int k = 0; k <= kNumSteps; ++k) {
+    problem.prog().AddBoundingBoxConstraint(-1, 1, problem.u_variables(k));
+  }
+  const symbolic::Variable final_position =
+      problem.prog().decision_variables()(2 * kNumSteps);
+  problem.prog().AddBoundingBoxConstraint(10, 10, final_position);
+  FbstabSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(problem.prog()));
+  const MathematicalProgramResult result = solver.Solve(problem.prog());
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+}
+
+GTEST_TEST(FbstabSolverTest, UnsupportedStructure) {
+  FbstabSolver solver;
+  {
+    // A cost that couples two stages.
+    DoubleIntegratorProblem problem(5);
+    const auto& x = problem.prog().decision_variables();
+    problem.prog().AddQuadraticCost((x(0) - x(4)) * (x(0) - x(4)));
+    EXPECT_FALSE(solver.AreProgramAttributesSatisfied(problem.prog()));
+  }
+  {
+    // No initial state.
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables<3>();
+    prog.AddLinearEqualityConstraint(x(0) + x(1) + x(2) == 1);
+    prog.AddQuadraticCost(x.cast<Expression>().squaredNorm());
+    EXPECT_FALSE(solver.AreProgramAttributesSatisfied(prog));
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -176,6 +178,68 @@ GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
     EXPECT_NE(result.get_solver_details<OsqpSolver>().status_val, OSQP_SOLVED);
   }
 }
+
+GTEST_TEST(OsqpSolverTest, PersistentWorkspace) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(0) * x(1));
+  auto constraint = prog.AddLinearConstraint(x(0) + x(1) >= 1);
+
+  OsqpSolver solver;
+  EXPECT_FALSE(solver.persistent_workspace());
+  solver.set_persistent_workspace(true);
+  EXPECT_TRUE(solver.persistent_workspace());
+  if (solver.available()) {
+    const double tol = 1E-6;
+    auto result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(0.5, 0.5), tol));
+
+    // Changing only the bounds reuses the workspace.
+    const double kInf = std::numeric_limits<double>::infinity();
+    constraint.evaluator()->set_bounds(Vector1d(2), Vector1d(kInf));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(1, 1), tol));
+    EXPECT_NEAR(result.get_optimal_cost(), 3, tol);
+
+    // Changing the values of the constraint matrix, but not its sparsity
+    // pattern, updates the matrix in the workspace.
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(1, 2), Vector1d(2), Vector1d(kInf));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(0, 1), tol));
+
+    // Changing the sparsity pattern sets up a new workspace.
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(0, 1), Vector1d(2), Vector1d(kInf));
+    result = solver.Solve(prog, {}, {});
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                Eigen::Vector2d(-1, 2), tol));
+
+    // So do different solver options.
+    SolverOptions solver_options;
+    solver_options.SetOption(solver.solver_id(), "max_iter", 1000);
+    result = solver.Solve(prog, {}, solver_options);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+
+    // Without the persistent workspace, every solve sets up a new one.
+    solver.set_persistent_workspace(false);
+    result = solver.Solve(prog, {}, solver_options);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().workspace_reused);
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,71 @@
+#include "drake/solvers/sparse_matrix_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+using Change = SparseMatrixCache::Change;
+using Triplets = std::vector<Eigen::Triplet<double>>;
+
+// Checks that `dut` holds the matrix that setFromTriplets() builds.
+void CheckMatrix(const SparseMatrixCache& dut, int rows, int cols,
+                 const Triplets& triplets) {
+  Eigen::SparseMatrix<double> expected(rows, cols);
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+  const Eigen::SparseMatrix<double>& matrix = dut.matrix();
+  EXPECT_TRUE(matrix.isCompressed());
+  EXPECT_EQ(matrix.nonZeros(), expected.nonZeros());
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(matrix),
+                              Eigen::MatrixXd(expected)));
+}
+
+GTEST_TEST(SparseMatrixCacheTest, Assemble) {
+  SparseMatrixCache dut;
+  // The triplets are not sorted, and (2, 1) appears twice.
+  Triplets triplets{{2, 1, 1.0}, {0, 0, 2.0}, {1, 3, 3.0}, {2, 1, 4.0},
+                    {0, 1, 5.0}, {2, 0, 0.0}};
+  EXPECT_EQ(dut.Assemble(3, 4, triplets), Change::kPattern);
+  CheckMatrix(dut, 3, 4, triplets);
+  // The explicit zero is stored, as in setFromTriplets().
+  EXPECT_EQ(dut.matrix().nonZeros(), 5);
+  EXPECT_EQ(dut.matrix().coeff(2, 1), 5.0);
+
+  const double* values = dut.matrix().valuePtr();
+  EXPECT_EQ(dut.Assemble(3, 4, triplets), Change::kNone);
+
+  // New values with the same (row, column) sequence are written in place.
+  triplets = {{2, 1, -1.0}, {0, 0, 2.0}, {1, 3, 6.0}, {2, 1, 4.0},
+              {0, 1, 5.0}, {2, 0, 7.0}};
+  EXPECT_EQ(dut.Assemble(3, 4, triplets), Change::kValues);
+  CheckMatrix(dut, 3, 4, triplets);
+  EXPECT_EQ(dut.matrix().valuePtr(), values);
+
+  // A new entry changes the pattern.
+  triplets.emplace_back(1, 2, 8.0);
+  EXPECT_EQ(dut.Assemble(3, 4, triplets), Change::kPattern);
+  CheckMatrix(dut, 3, 4, triplets);
+
+  // So does a new size.
+  EXPECT_EQ(dut.Assemble(4, 4, triplets), Change::kPattern);
+  CheckMatrix(dut, 4, 4, triplets);
+  EXPECT_EQ(dut.Assemble(4, 4, triplets), Change::kNone);
+}
+
+GTEST_TEST(SparseMatrixCacheTest, Empty) {
+  SparseMatrixCache dut;
+  EXPECT_EQ(dut.Assemble(2, 3, {}), Change::kPattern);
+  CheckMatrix(dut, 2, 3, {});
+  EXPECT_EQ(dut.Assemble(2, 3, {}), Change::kNone);
+  EXPECT_EQ(dut.Assemble(0, 3, {}), Change::kPattern);
+  EXPECT_EQ(dut.matrix().rows(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -22,7 +23,11 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
 
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  const int num_threads = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions, num_samples);
+
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -30,18 +35,24 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     generator = owned_generator.get();
   }
 
+  // Seed every sample's generator up front, in sample order, so that the
+  // results do not depend on the order in which the samples are evaluated.
   std::vector<RandomSimulationResult> data;
   data.reserve(num_samples);
-
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
   for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+    data.emplace_back(RandomGenerator((*generator)()));
   }
 
+  // Each sample constructs its own Simulator (and Context) via the factory,
+  // so the only data shared between workers is the (pre-sized) results
+  // vector, whose elements are each written by exactly one worker.
+  drake::internal::ParallelFor(num_samples, num_threads, [&](int, int sample) {
+    RandomSimulationResult& result = data[sample];
+    RandomGenerator sample_generator(result.generator_snapshot);
+    result.output =
+        RandomSimulation(make_simulator, output, final_time, &sample_generator);
+  });
+
   return data;
 }
 
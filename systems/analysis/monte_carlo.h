@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/simulator.h"
 
 namespace drake {
@@ -119,12 +120,19 @@ struct RandomSimulationResult {
  * In pseudo-code, this algorithm implements:
  * @code
  *   for i=1:num_samples
- *     const generator_snapshot = deepcopy(generator)
- *     output = RandomSimulation(..., generator)
+ *     const generator_snapshot = RandomGenerator(generator())
+ *     sample_generator = deepcopy(generator_snapshot)
+ *     output = RandomSimulation(..., sample_generator)
  *     data(i) = std::pair(generator_snapshot, output)
  *   return data
  * @endcode
  *
+ * Each sample is given its own RandomGenerator, seeded by a single draw from
+ * @p generator.  The i'th sample therefore does not depend on how many random
+ * numbers the preceding samples consumed, which is what allows the samples to
+ * be evaluated in any order (or concurrently) while still producing results
+ * that are bit-identical to the serial evaluation.
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -136,18 +144,34 @@ struct RandomSimulationResult {
  * and used internally (and repeated calls to this method will return
  * identical results).  To produce statistically "independent" samples on a
  * future call to MonteCarloSimulation, you should make repeated uses of the
- * same RandomGenerator object.
+ * same RandomGenerator object.  Exactly @p num_samples values are drawn from
+ * @p generator, regardless of @p num_parallel_executions.
+ *
+ * @param num_parallel_executions Number of simulations to run concurrently.
+ * The default value, kNoConcurrency, runs every simulation serially on the
+ * calling thread.  Use kUseHardwareConcurrency to run one worker per hardware
+ * thread.  Any other value must be positive; the number of workers actually
+ * launched is never more than @p num_samples.  Each worker constructs its own
+ * Simulator (and therefore its own Context) through @p make_simulator.
+ *
+ * @warning When @p num_parallel_executions is not kNoConcurrency, both
+ * @p make_simulator and @p output are invoked concurrently from multiple
+ * threads, so they must be safe to call in that manner; in particular, the
+ * Simulators they return must not share mutable state (e.g., a System owned
+ * outside of the factory).
+ *
+ * @returns a list of RandomSimulationResult's, in sample order.
  *
- * @returns a list of RandomSimulationResult's.
+ * @throws std::exception if @p num_parallel_executions is neither positive nor
+ * kUseHardwareConcurrency.  Any exception thrown by a simulation is
+ * propagated to the caller once all in-flight simulations have stopped.
  *
  * @ingroup analysis
  */
-// TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = kNoConcurrency);
 
 }  // namespace analysis
 }  // namespace systems
@@ -1,6 +1,7 @@
 #include "drake/systems/analysis/region_of_attraction.h"
 
 #include <algorithm>
+#include <optional>
 
 #include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/math/quadratic_form.h"
@@ -115,6 +116,10 @@ Expression RegionOfAttraction(const System<double>& system,
                               const Context<double>& context,
                               const RegionOfAttractionOptions& options) {
   system.ValidateContext(context);
+  std::optional<symbolic::ScopedExpressionInterning> interning;
+  if (options.intern_expressions) {
+    interning.emplace();
+  }
   DRAKE_THROW_UNLESS(context.has_only_continuous_state());
 
   const int num_states = context.num_continuous_states();
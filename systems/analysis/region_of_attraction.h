@@ -27,6 +27,13 @@ struct RegionOfAttractionOptions {
    * system.
    */
   VectorX<symbolic::Variable> state_variables{};
+
+  /** If true, the symbolic expressions built during the analysis are interned
+   * (see symbolic::ScopedExpressionInterning), so that structurally equal
+   * subexpressions share their storage.  This reduces the memory used by
+   * the sums-of-squares programs of larger systems.
+   */
+  bool intern_expressions{false};
 };
 
 /**
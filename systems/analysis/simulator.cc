@@ -1,10 +1,12 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "drake/common/extract_double.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/framework/diagram.h"
 
 namespace drake {
 namespace systems {
@@ -118,6 +120,9 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   // Allocate the witness function collection.
   witnessed_events_ = system_.AllocateCompositeEventCollection();
 
+  // Allocate the collection that AdvanceTo() merges events into.
+  merged_events_ = system_.AllocateCompositeEventCollection();
+
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
   // events to precede any per-step or timed events in the merged collection.
@@ -209,20 +214,22 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
   SimulatorStatus status(ExtractDoubleOrThrow(boundary_time));
 
   // Integrate until desired interval has completed.
-  auto merged_events = system_.AllocateCompositeEventCollection();
+  CompositeEventCollection<T>* const merged_events = merged_events_.get();
   DRAKE_DEMAND(timed_events_ != nullptr);
   DRAKE_DEMAND(witnessed_events_ != nullptr);
   DRAKE_DEMAND(merged_events != nullptr);
 
-  // Clear events for the loop iteration.
+  // Clear events for the loop iteration. The events that the System refers
+  // to without copying are owned by system_, which outlives merged_events, so
+  // they are shared rather than copied (here and below).
   merged_events->Clear();
-  merged_events->AddToEnd(*per_step_events_);
+  merged_events->AddToEndSharingUnownedEvents(*per_step_events_);
 
   // Merge in timed and witnessed events, if necessary.
   if (time_or_witness_triggered_ & kTimeTriggered)
-    merged_events->AddToEnd(*timed_events_);
+    merged_events->AddToEndSharingUnownedEvents(*timed_events_);
   if (time_or_witness_triggered_ & kWitnessTriggered)
-    merged_events->AddToEnd(*witnessed_events_);
+    merged_events->AddToEndSharingUnownedEvents(*witnessed_events_);
 
   while (true) {
     // Starting a new step on the trajectory.
@@ -232,6 +239,13 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
     // Delay to match target realtime rate if requested and possible.
     PauseIfTooFast();
 
+    // Bring the requested subsystem outputs up to date, concurrently where
+    // possible, before the event handlers ask for them.
+    if (!prefetch_ports_.empty()) {
+      prefetch_diagram_->EvalSubsystemOutputPortsInParallel(
+          *context_, prefetch_ports_, prefetch_num_parallel_executions_);
+    }
+
     // The general policy here is to do actions in decreasing order of
     // "violence" to the state, i.e. unrestricted -> discrete -> continuous ->
     // publish. The "timed" actions happen before the "per step" ones.
@@ -276,13 +290,13 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
     merged_events->Clear();
 
     // Merge in per-step events.
-    merged_events->AddToEnd(*per_step_events_);
+    merged_events->AddToEndSharingUnownedEvents(*per_step_events_);
 
     // Only merge timed / witnessed events in if an event was triggered.
     if (time_or_witness_triggered_ & kTimeTriggered)
-      merged_events->AddToEnd(*timed_events_);
+      merged_events->AddToEndSharingUnownedEvents(*timed_events_);
     if (time_or_witness_triggered_ & kWitnessTriggered)
-      merged_events->AddToEnd(*witnessed_events_);
+      merged_events->AddToEndSharingUnownedEvents(*witnessed_events_);
 
     // Handle any publish events at the end of the loop.
     HandlePublish(merged_events->get_publish_events());
@@ -313,6 +327,37 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
   return status;
 }
 
+template <typename T>
+void Simulator<T>::set_parallel_output_prefetch(
+    std::vector<const OutputPort<T>*> ports, int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_parallel_executions > 0 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
+  const Diagram<T>* diagram = nullptr;
+  if (!ports.empty()) {
+    diagram = dynamic_cast<const Diagram<T>*>(&system_);
+    if (diagram == nullptr) {
+      throw std::logic_error(fmt::format(
+          "Simulator::set_parallel_output_prefetch(): the simulated system "
+          "'{}' is not a Diagram.", system_.get_name()));
+    }
+    const std::vector<const System<T>*> subsystems = diagram->GetSystems();
+    for (const OutputPort<T>* port : ports) {
+      DRAKE_THROW_UNLESS(port != nullptr);
+      if (std::find(subsystems.begin(), subsystems.end(),
+                    &port->get_system()) == subsystems.end()) {
+        throw std::logic_error(fmt::format(
+            "Simulator::set_parallel_output_prefetch(): output port '{}' of "
+            "system '{}' does not belong to an immediate subsystem of Diagram "
+            "'{}'.", port->get_name(), port->get_system().get_name(),
+            diagram->get_name()));
+      }
+    }
+  }
+  prefetch_diagram_ = diagram;
+  prefetch_ports_ = std::move(ports);
+  prefetch_num_parallel_executions_ = num_parallel_executions;
+}
+
 template <class T>
 std::optional<T> Simulator<T>::GetCurrentWitnessTimeIsolation() const {
   using std::max;
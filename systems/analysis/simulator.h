@@ -13,6 +13,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/simulator_config.h"
 #include "drake/systems/analysis/simulator_status.h"
@@ -23,6 +24,9 @@
 namespace drake {
 namespace systems {
 
+template <typename T>
+class Diagram;
+
 /// @ingroup simulation
 /// Parameters for fine control of simulator initialization.
 /// @see Simulator<T>::Initialize().
@@ -524,6 +528,27 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// (Advanced) Requests that, at the start of every step taken by
+  /// AdvanceTo() (before any update events are handled), the given output
+  /// `ports` of immediate subsystems of the simulated Diagram be brought up
+  /// to date by Diagram::EvalSubsystemOutputPortsInParallel(), using up to
+  /// `num_parallel_executions` threads. The event handlers of that step then
+  /// find those values already computed, as long as nothing they depend on
+  /// has changed in the meantime. Passing an empty `ports` vector turns this
+  /// off again; it is off by default.
+  ///
+  /// See Diagram::EvalSubsystemOutputPortsInParallel() for which ports are
+  /// actually computed concurrently, and for the requirements this places on
+  /// the subsystems' output calculations.
+  ///
+  /// @throws std::exception if `ports` is non-empty and the simulated System
+  ///   is not a Diagram, if any port does not belong to an immediate
+  ///   subsystem of that Diagram, or if `num_parallel_executions` is neither
+  ///   positive nor kUseHardwareConcurrency.
+  void set_parallel_output_prefetch(
+      std::vector<const OutputPort<T>*> ports,
+      int num_parallel_executions = kUseHardwareConcurrency);
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -794,6 +819,13 @@ class Simulator {
 
   bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
+  // The Diagram and subsystem output ports set by
+  // set_parallel_output_prefetch(); prefetching is off when the ports are
+  // empty.
+  const Diagram<T>* prefetch_diagram_{};
+  std::vector<const OutputPort<T>*> prefetch_ports_;
+  int prefetch_num_parallel_executions_{kUseHardwareConcurrency};
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
@@ -837,6 +869,12 @@ class Simulator {
   // AdvanceTo(). This collection is constructed within Initialize().
   std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
 
+  // The union of the per-step, timed, and witnessed events that are handled
+  // on a given step. This collection is constructed within Initialize() and
+  // reused by every AdvanceTo() so that steady-state stepping does not need
+  // to allocate.
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+
   // Indicates when a timed or witnessed event needs to be handled on the next
   // call to AdvanceTo().
   TimeOrWitnessTriggered time_or_witness_triggered_{
@@ -1,9 +1,12 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <stdexcept>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/vector_system.h"
@@ -169,6 +172,71 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Confirms that the parallel evaluation produces bit-identical results to the
+// serial evaluation, for several worker counts, and that the caller's
+// generator is advanced identically in both cases.
+GTEST_TEST(MonteCarloSimulationTest, ParallelMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    // Consume a varying number of random values in the factory, so that the
+    // samples would de-synchronize if they shared a single generator stream.
+    std::uniform_int_distribution<int> num_draws(0, 5);
+    const int n = num_draws(*generator);
+    for (int i = 0; i < n; ++i) {
+      (*generator)();
+    }
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 33;
+
+  RandomGenerator serial_generator;
+  const auto serial_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator, kNoConcurrency);
+  ASSERT_EQ(serial_results.size(), num_samples);
+
+  for (const int num_parallel_executions :
+       {2, 4, num_samples + 10, kUseHardwareConcurrency}) {
+    RandomGenerator parallel_generator;
+    const auto parallel_results = MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        &parallel_generator, num_parallel_executions);
+    ASSERT_EQ(parallel_results.size(), num_samples);
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(parallel_results[i].output, serial_results[i].output);
+      RandomGenerator parallel_snapshot(parallel_results[i].generator_snapshot);
+      RandomGenerator serial_snapshot(serial_results[i].generator_snapshot);
+      EXPECT_EQ(parallel_snapshot(), serial_snapshot());
+    }
+    EXPECT_EQ(parallel_generator(), RandomGenerator(serial_generator)());
+  }
+}
+
+GTEST_TEST(MonteCarloSimulationTest, BadParallelism) {
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  for (const int num_parallel_executions : {0, -2}) {
+    EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput, 0.1,
+                                      10, nullptr, num_parallel_executions),
+                 std::exception);
+  }
+}
+
+// Exceptions thrown by a worker's simulation are reported to the caller.
+GTEST_TEST(MonteCarloSimulationTest, ParallelExceptionPropagates) {
+  const SimulatorFactory make_simulator =
+      [](RandomGenerator*) -> std::unique_ptr<Simulator<double>> {
+    throw std::runtime_error("factory failure");
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, 0.1, 10, nullptr,
+                           4),
+      std::runtime_error, "factory failure");
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
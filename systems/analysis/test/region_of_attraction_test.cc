@@ -53,6 +53,26 @@ GTEST_TEST(RegionOfAttractionTest, ShiftedCubicPolynomialTest) {
   EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
 }
 
+// The shifted cubic again, with interned expressions.
+GTEST_TEST(RegionOfAttractionTest, InternExpressions) {
+  Variable x("x");
+  const double x0 = 2;
+  const auto system = SymbolicVectorSystemBuilder()
+                          .state(x)
+                          .dynamics(-(x - x0) + pow(x - x0, 3))
+                          .Build();
+  auto context = system->CreateDefaultContext();
+  context->SetContinuousState(Vector1d(x0));
+
+  RegionOfAttractionOptions options;
+  options.state_variables = Vector1<Variable>(x);
+  options.intern_expressions = true;
+  const Expression V = RegionOfAttraction(*system, *context, options);
+
+  const Polynomial V_expected{(x - x0) * (x - x0)};
+  EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
+}
+
 // A multivariate polynomial with a non-trivial but known floating-point
 // solution for the optimal level-set of the candidate Lyapunov function.
 // From section 7.3 of:
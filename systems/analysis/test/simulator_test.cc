@@ -1,5 +1,6 @@
 #include "drake/systems/analysis/simulator.h"
 
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <functional>
@@ -13,6 +14,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/explicit_euler_integrator.h"
 #include "drake/systems/analysis/implicit_euler_integrator.h"
@@ -2464,6 +2466,166 @@ GTEST_TEST(SimulatorTest, MissedPublishEventIssue13296) {
   EXPECT_EQ(periodic_system->publish_count(), 1);
 }
 
+// A purely discrete system that exercises every kind of event that the
+// Simulator dispatches on a step: periodic discrete and unrestricted updates,
+// periodic publishes, and per-step publishes.
+class DiscreteEventfulSystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DiscreteEventfulSystem)
+
+  DiscreteEventfulSystem() {
+    DeclareDiscreteState(2);
+    DeclareAbstractState(AbstractValue::Make<int>(0));
+    DeclarePeriodicDiscreteUpdateEvent(
+        0.001, 0.0, &DiscreteEventfulSystem::Update);
+    DeclarePeriodicUnrestrictedUpdateEvent(
+        0.003, 0.0, &DiscreteEventfulSystem::Count);
+    DeclarePeriodicPublishEvent(0.002, 0.0, &DiscreteEventfulSystem::Publish);
+    DeclarePerStepPublishEvent(&DiscreteEventfulSystem::Publish);
+    DeclareVectorOutputPort("y", BasicVector<double>(2),
+                            &DiscreteEventfulSystem::CalcOutput);
+  }
+
+  int publish_count() const { return publish_count_; }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* next_state) const {
+    next_state->get_mutable_vector().get_mutable_value() =
+        0.5 * context.get_discrete_state_vector().get_value() +
+        Eigen::Vector2d::Ones();
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus Count(const Context<double>& context,
+                    State<double>* next_state) const {
+    next_state->get_mutable_abstract_state<int>(0) =
+        context.get_abstract_state<int>(0) + 1;
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus Publish(const Context<double>&) const {
+    // Modifying system members in an event handler is an anti-pattern. It is
+    // done here only to simplify the testing code.
+    ++publish_count_;
+    return EventStatus::Succeeded();
+  }
+
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    output->SetFrom(context.get_discrete_state_vector());
+  }
+
+  mutable int publish_count_{0};
+};
+
+// Once the Simulator has warmed up, stepping a discrete system (or a Diagram
+// of them) must not touch the heap.
+GTEST_TEST(SimulatorTest, SteadyStateAdvanceToDoesNotAllocate) {
+  DiagramBuilder<double> builder;
+  const auto* first = builder.AddSystem<DiscreteEventfulSystem>();
+  builder.AddSystem<DiscreteEventfulSystem>();
+  const auto diagram = builder.Build();
+  const DiscreteEventfulSystem leaf;
+
+  for (const System<double>* system :
+           std::vector<const System<double>*>{&leaf, diagram.get()}) {
+    Simulator<double> simulator(*system);
+    simulator.AdvanceTo(0.01);
+    const int num_publishes = leaf.publish_count() + first->publish_count();
+    {
+      test::LimitMalloc guard;
+      simulator.AdvanceTo(0.02);
+      simulator.AdvanceTo(0.03);
+    }
+    // Make sure that the events were actually handled while guarded.
+    EXPECT_GT(leaf.publish_count() + first->publish_count(), num_publishes);
+    EXPECT_EQ(simulator.get_context().get_time(), 0.03);
+  }
+}
+
+// A source whose output depends on time and counts its calculations, and
+// whose periodic discrete update reads that output.
+class PrefetchedSource : public LeafSystem<double> {
+ public:
+  PrefetchedSource() {
+    this->DeclareVectorOutputPort("y", BasicVector<double>(1),
+                                  &PrefetchedSource::CalcOutput,
+                                  {this->time_ticket()});
+    this->DeclareDiscreteState(1);
+    this->DeclarePeriodicDiscreteUpdateEvent(0.25, 0.0,
+                                             &PrefetchedSource::Update);
+  }
+
+  int num_calcs() const { return num_calcs_; }
+  int num_calcs_during_updates() const { return num_calcs_during_updates_; }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    ++num_calcs_;
+    (*output)[0] = context.get_time();
+  }
+
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* next) const {
+    const int num_calcs_before = num_calcs_;
+    next->get_mutable_vector()[0] =
+        this->get_output_port().Eval(context)[0];
+    num_calcs_during_updates_ += num_calcs_ - num_calcs_before;
+    return EventStatus::Succeeded();
+  }
+
+  mutable std::atomic<int> num_calcs_{0};
+  mutable int num_calcs_during_updates_{0};
+};
+
+// The requested outputs are computed at the start of each step, so the
+// discrete updates find them up to date.
+GTEST_TEST(SimulatorTest, ParallelOutputPrefetch) {
+  DiagramBuilder<double> builder;
+  const auto* first = builder.AddSystem<PrefetchedSource>();
+  const auto* second = builder.AddSystem<PrefetchedSource>();
+  const auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.set_parallel_output_prefetch(
+      {&first->get_output_port(), &second->get_output_port()}, 2);
+  simulator.AdvanceTo(1.0);
+  for (const PrefetchedSource* source : {first, second}) {
+    EXPECT_GT(source->num_calcs(), 0);
+    EXPECT_EQ(source->num_calcs_during_updates(), 0);
+  }
+
+  // Turning prefetching off makes the updates compute the outputs again.
+  simulator.set_parallel_output_prefetch({});
+  simulator.AdvanceTo(2.0);
+  EXPECT_GT(first->num_calcs_during_updates(), 0);
+}
+
+GTEST_TEST(SimulatorTest, ParallelOutputPrefetchErrors) {
+  DiagramBuilder<double> builder;
+  builder.AddSystem<PrefetchedSource>();
+  const auto diagram = builder.Build();
+  const PrefetchedSource stranger;
+
+  Simulator<double> diagram_simulator(*diagram);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram_simulator.set_parallel_output_prefetch(
+          {&stranger.get_output_port()}),
+      std::logic_error,
+      ".*does not belong to an immediate subsystem.*");
+  EXPECT_THROW(diagram_simulator.set_parallel_output_prefetch({}, 0),
+               std::exception);
+
+  Simulator<double> leaf_simulator(stranger);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      leaf_simulator.set_parallel_output_prefetch(
+          {&stranger.get_output_port()}),
+      std::logic_error,
+      ".*is not a Diagram.*");
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,123 @@
+#include <memory>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/systems/analysis/monte_carlo.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/vector_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+/* @defgroup monte_carlo_benchmarks Monte Carlo Simulation Benchmarks
+ @ingroup analysis
+
+ The benchmark measures how the throughput of MonteCarloSimulation() scales
+ with the number of parallel executions. Each sample integrates a bank of
+ lightly damped, randomly initialized oscillators with the default (error
+ controlled) integrator, so that every sample does a comparable, nontrivial
+ amount of work.
+
+ Arguments include:
+ - __parallel executions__: The `num_parallel_executions` passed to
+   MonteCarloSimulation(). The value 1 is the serial baseline.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //systems/benchmarking:monte_carlo_benchmark
+ ```
+
+ <h2>Interpreting the benchmark</h2>
+
+ Because the work is done on worker threads, the reported "CPU" column only
+ accounts for the calling thread and should be ignored; compare the "Time"
+ (wall clock) column and the `samples/s` counter across rows instead. On an
+ otherwise idle machine, `samples/s` should grow nearly linearly until the
+ number of parallel executions reaches the number of physical cores. */
+
+constexpr int kNumOscillators = 32;
+constexpr int kNumSamples = 128;
+constexpr double kFinalTime = 2.0;
+
+// A bank of independent damped oscillators whose initial state is drawn from
+// a standard normal distribution in SetRandomState().
+class RandomOscillatorBank final : public VectorSystem<double> {
+ public:
+  RandomOscillatorBank() : VectorSystem<double>(0, 1) {
+    this->DeclareContinuousState(kNumOscillators, kNumOscillators, 0);
+  }
+
+ private:
+  void SetRandomState(const Context<double>&, State<double>* state,
+                      RandomGenerator* generator) const final {
+    std::normal_distribution<double> distribution;
+    auto& xc = state->get_mutable_continuous_state().get_mutable_vector();
+    for (int i = 0; i < xc.size(); ++i) {
+      xc[i] = distribution(*generator);
+    }
+  }
+
+  void DoCalcVectorTimeDerivatives(
+      const Context<double>&,
+      const Eigen::VectorBlock<const VectorX<double>>&,
+      const Eigen::VectorBlock<const VectorX<double>>& state,
+      Eigen::VectorBlock<VectorX<double>>* derivatives) const final {
+    const auto q = state.head(kNumOscillators);
+    const auto v = state.tail(kNumOscillators);
+    derivatives->head(kNumOscillators) = v;
+    derivatives->tail(kNumOscillators) = -100.0 * q - 0.1 * v;
+  }
+
+  void DoCalcVectorOutput(
+      const Context<double>&,
+      const Eigen::VectorBlock<const VectorX<double>>&,
+      const Eigen::VectorBlock<const VectorX<double>>& state,
+      Eigen::VectorBlock<VectorX<double>>* output) const final {
+    (*output)[0] = state.squaredNorm();
+  }
+};
+
+double GetEnergyOutput(const System<double>& system,
+                       const Context<double>& context) {
+  return system.get_output_port(0).Eval(context)[0];
+}
+
+void MonteCarloThroughput(benchmark::State& state) {  // NOLINT
+  const int num_parallel_executions = state.range(0);
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    return std::make_unique<Simulator<double>>(
+        std::make_unique<RandomOscillatorBank>());
+  };
+  RandomGenerator generator;
+  for (auto _ : state) {
+    auto results =
+        MonteCarloSimulation(make_simulator, &GetEnergyOutput, kFinalTime,
+                             kNumSamples, &generator, num_parallel_executions);
+    benchmark::DoNotOptimize(results);
+  }
+  state.counters["samples/s"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * kNumSamples,
+      benchmark::Counter::kIsRate);
+}
+BENCHMARK(MonteCarloThroughput)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Arg(1)    // Serial baseline.
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(kUseHardwareConcurrency);
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
+
+BENCHMARK_MAIN();
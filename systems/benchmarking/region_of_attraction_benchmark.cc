@@ -0,0 +1,102 @@
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/symbolic.h"
+#include "drake/systems/analysis/region_of_attraction.h"
+#include "drake/systems/primitives/symbolic_vector_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+using symbolic::Expression;
+using symbolic::ScopedExpressionInterning;
+using symbolic::Variable;
+
+/* @defgroup region_of_attraction_benchmarks Region of Attraction Benchmarks
+ @ingroup analysis
+
+ The benchmark measures the cost of RegionOfAttraction() with and without
+ interning of the symbolic expressions (see
+ RegionOfAttractionOptions::intern_expressions).
+
+ Arguments include:
+ - __states__: The number of states of a ring of coupled polynomial systems,
+   ẋᵢ = -xᵢ - xᵢ³ + xᵢ₊₁², whose origin is a stable fixed point. The size of
+   the sums-of-squares program grows quickly with the number of states.
+ - __intern__: 0 to build the expressions as usual, 1 to intern them.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //systems/benchmarking:region_of_attraction_benchmark
+ ```
+
+ A sums-of-squares solver (e.g., CSDP or Mosek) is required.
+
+ <h2>Interpreting the benchmark</h2>
+
+ Compare the "Time" column of rows that differ only in `intern`. For interned
+ rows, the `shared_cells` counter reports how many expression cells per
+ iteration were replaced by an equal live cell, i.e. how many allocations
+ were released right away instead of being kept alive by the program. Those
+ savings are largest during the construction of the program, before the
+ solver runs; the solver's own time is unaffected. */
+
+std::unique_ptr<SymbolicVectorSystem<double>> MakeRingSystem(int num_states) {
+  VectorX<Variable> x(num_states);
+  for (int i = 0; i < num_states; ++i) {
+    x(i) = Variable("x" + std::to_string(i));
+  }
+  VectorX<Expression> dynamics(num_states);
+  for (int i = 0; i < num_states; ++i) {
+    const Expression next = x((i + 1) % num_states);
+    dynamics(i) = -x(i) - pow(x(i), 3) + next * next;
+  }
+  return SymbolicVectorSystemBuilder().state(x).dynamics(dynamics).Build();
+}
+
+void RegionOfAttractionRing(benchmark::State& state) {  // NOLINT
+  const int num_states = state.range(0);
+  const bool intern = state.range(1) != 0;
+  const auto system = MakeRingSystem(num_states);
+  const auto context = system->CreateDefaultContext();
+  double num_shared_cells = 0;
+  for (auto _ : state) {
+    // Interning is enabled here (rather than with the option) so that its
+    // counters can be read.
+    std::optional<ScopedExpressionInterning> interning;
+    if (intern) {
+      interning.emplace();
+    }
+    const Expression V = RegionOfAttraction(*system, *context);
+    benchmark::DoNotOptimize(V);
+    if (intern) {
+      num_shared_cells += interning->num_shared_cells();
+    }
+  }
+  state.counters["shared_cells"] =
+      benchmark::Counter(num_shared_cells, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(RegionOfAttractionRing)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgNames({"states", "intern"})
+    ->Args({2, 0})
+    ->Args({2, 1})
+    ->Args({3, 0})
+    ->Args({3, 1})
+    ->Args({4, 0})
+    ->Args({4, 1});
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,11 +1,12 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/osqp_solver.h"
 
 namespace drake {
 namespace systems {
@@ -67,6 +68,7 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    SetupQp();
   }
 }
 
@@ -77,7 +79,7 @@ void LinearModelPredictiveController<T>::CalcControl(
       get_state_port().Eval(context);
 
   const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+      SolveQp(*base_context_, current_state);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
@@ -87,30 +89,54 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
+void LinearModelPredictiveController<T>::SetupQp() {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
   const int kNumSampleTimes =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
 
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
+  prog_ = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, kNumSampleTimes);
+
+  const auto state_error = prog_->state();
+  const auto input_error = prog_->input();
+
+  prog_->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                        input_error.transpose() * R_ * input_error);
+
+  // The initial state error is set by SolveQp().
+  initial_state_constraint_ =
+      prog_
+          ->AddLinearEqualityConstraint(
+              Eigen::MatrixXd::Identity(num_states_, num_states_),
+              Eigen::VectorXd::Zero(num_states_), prog_->initial_state())
+          .evaluator();
 
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
+  solver_ = solvers::MakeSolver(solvers::ChooseBestSolver(*prog_));
+  // Only the initial state constraint changes between updates, so OSQP (if it
+  // was chosen) can keep its workspace.
+  if (auto* osqp = dynamic_cast<solvers::OsqpSolver*>(solver_.get())) {
+    osqp->set_persistent_workspace(true);
+  }
+}
 
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
+template <typename T>
+VectorX<T> LinearModelPredictiveController<T>::SolveQp(
+    const Context<T>& base_context, const VectorX<T>& current_state) const {
+  DRAKE_DEMAND(prog_ != nullptr);
 
   const VectorX<T> state_ref =
       base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
+  const Eigen::VectorXd initial_state_error = current_state - state_ref;
 
-  const auto result = Solve(prog);
+  std::lock_guard<std::mutex> lock(mutex_);
+  initial_state_constraint_->set_bounds(initial_state_error,
+                                        initial_state_error);
+  solvers::MathematicalProgramResult result;
+  solver_->Solve(*prog_, std::nullopt, std::nullopt, &result);
   DRAKE_DEMAND(result.is_success());
 
-  return prog.GetInputSamples(result).col(0);
+  return prog_->GetInputSamples(result).col(0);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/solvers/solver_interface.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -23,9 +26,16 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// The QP is built once, at construction; each control update only changes
+/// the constraint on the initial state and re-solves it, using the solver
+/// picked by solvers::ChooseBestSolver(). When that is OSQP, it keeps its
+/// workspace (and the factorization of its KKT matrix) between updates and
+/// warm-starts from the previous solution (see
+/// solvers::OsqpSolver::set_persistent_workspace()). Because the QP is shared
+/// by all contexts, concurrent evaluations of the control output are
+/// serialized.
 ///
 /// @tparam_double_only
 /// @ingroup control_systems
@@ -76,10 +86,13 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
+  // Sets up the DirectTranscription problem prog_.
+  void SetupQp();
+
+  // Updates the initial state of prog_ and solves for the current control
   // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  VectorX<T> SolveQp(const Context<T>& base_context,
+                     const VectorX<T>& current_state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -99,6 +112,14 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The QP, whose only data that changes between solves are the bounds of
+  // initial_state_constraint_.
+  std::unique_ptr<trajectory_optimization::DirectTranscription> prog_;
+  std::shared_ptr<solvers::LinearEqualityConstraint> initial_state_constraint_;
+  std::unique_ptr<solvers::SolverInterface> solver_;
+  // Guards prog_ and solver_ during SolveQp().
+  mutable std::mutex mutex_;
 };
 
 }  // namespace controllers
@@ -81,6 +81,30 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+// The QP is built once and only its initial state changes between
+// evaluations, so that repeated evaluations at different states each match
+// the infinite-horizon solution.
+TEST_F(TestMpcWithDoubleIntegrator, TestRepeatedEvaluations) {
+  const double kTolerance = 1e-5;
+
+  const Eigen::Matrix2d A = system_->A();
+  const Eigen::Matrix<double, 2, 1> B = system_->B();
+  const Eigen::Matrix2d S = DiscreteAlgebraicRiccatiEquation(A, B, Q_, R_);
+  const Eigen::Matrix<double, 1, 2> K =
+      -(R_ + B.transpose() * S * B).inverse() * (B.transpose() * S * A);
+
+  auto context = dut_->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput();
+  for (const Eigen::Vector2d& x0 :
+       {Eigen::Vector2d(1, 1), Eigen::Vector2d(-2, 0.5),
+        Eigen::Vector2d(0, 0), Eigen::Vector2d(1, 1)}) {
+    dut_->get_input_port(0).FixValue(context.get(), x0);
+    dut_->CalcOutput(*context, output.get());
+    EXPECT_TRUE(CompareMatrices(
+        K * x0, output->get_vector_data(0)->get_value(), kTolerance));
+  }
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
@@ -68,7 +68,33 @@ the contained value even if it is not marked out of date. That should have no
 effect other than to slow computation; if results change, something is wrong.
 There could be a problem with the specification of dependencies, a bug in user
 code such as improper retention of a stale reference, or a bug in the caching
-system. */
+system.
+
+<h3>Thread safety</h3>
+
+A %CacheEntryValue performs no internal synchronization. The rules are:
+- Values in different root Context objects may be evaluated concurrently
+  without restriction.
+- Within one Diagram's Context, values in different subcontexts may be
+  evaluated concurrently only if their computations touch disjoint sets of
+  cache entries. Evaluating a value also evaluates its out-of-date
+  prerequisites on demand, including (through input ports) the outputs of
+  every upstream subsystem, so two values whose prerequisites share any
+  upstream cache entry must not be evaluated concurrently.
+- Any number of threads may concurrently _read_ an up-to-date value (e.g.,
+  through repeated Eval() calls that find the value up to date), provided no
+  thread modifies the Context in a way that could invalidate it.
+- At most one thread may _compute_ a given value at a time, and no other thread
+  may read it while that happens. Since Eval() computes an out-of-date value on
+  demand, two threads must not Eval() the same out-of-date entry concurrently.
+- Any modification of a Context (time, state, parameters, fixed input values)
+  or of the cache's enabled/frozen settings sends invalidation notifications
+  through the subcontext tree and must not be concurrent with any other use of
+  that Context tree.
+
+Diagram::EvalSubsystemOutputPortsInParallel() follows these rules by
+evaluating concurrently only ports whose computations touch disjoint sets of
+subsystems. */
 class CacheEntryValue {
  public:
   /** @name  Does not allow move or assignment; copy constructor is private. */
@@ -642,7 +668,12 @@ most common APIs, and Context provides additional useful methods.
 
 Memory addresses of CacheEntryValue objects are stable once allocated, but
 CacheIndex numbers are stable even after a Context has been copied so should be
-preferred as a means for identifying particular cache entries. */
+preferred as a means for identifying particular cache entries.
+
+A %Cache is not internally synchronized; distinct entries may be used from
+different threads under the rules described for CacheEntryValue, but the
+structural operations here (creating entries, freezing, disabling) must not be
+concurrent with any other use of the %Cache. */
 class Cache {
  public:
   /** @name  Does not allow move or assignment; copy constructor is private. */
@@ -1,10 +1,14 @@
 #include "drake/systems/framework/diagram.h"
 
 #include <limits>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 
+#include <fmt/format.h>
+
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/subvector.h"
 #include "drake/systems/framework/system_constraint.h"
@@ -569,6 +573,111 @@ bool Diagram<T>::AreConnected(const OutputPort<T>& output,
   return false;
 }
 
+template <typename T>
+void Diagram<T>::EvalSubsystemOutputPortsInParallel(
+    const Context<T>& context,
+    const std::vector<const OutputPort<T>*>& ports,
+    int num_parallel_executions) const {
+  this->ValidateContext(context);
+  auto diagram_context = dynamic_cast<const DiagramContext<T>*>(&context);
+  DRAKE_DEMAND(diagram_context != nullptr);
+
+  const std::vector<std::vector<int>> groups =
+      PartitionIntoIndependentGroups(ports);
+  const int num_threads = drake::internal::SelectNumberOfThreads(
+      num_parallel_executions, static_cast<int>(groups.size()));
+  drake::internal::ParallelFor(
+      static_cast<int>(groups.size()), num_threads, [&](int, int group) {
+        for (int port_index : groups[group]) {
+          const OutputPort<T>& port = *ports[port_index];
+          EvalSubsystemOutputPort(*diagram_context,
+                                  {&port.get_system(), port.get_index()});
+        }
+      });
+}
+
+template <typename T>
+std::vector<std::vector<int>> Diagram<T>::PartitionIntoIndependentGroups(
+    const std::vector<const OutputPort<T>*>& ports) const {
+  const int num_systems = num_subsystems();
+
+  // Immediate upstream subsystems of each subsystem, and whether a subsystem
+  // reads any of this Diagram's exported input ports (whose values may be
+  // computed outside of this Diagram).
+  std::vector<std::vector<SubsystemIndex>> upstream(num_systems);
+  for (const auto& [input, output] : connection_map_) {
+    upstream[GetSystemIndexOrAbort(input.first)].push_back(
+        GetSystemIndexOrAbort(output.first));
+  }
+  std::vector<bool> reads_exported_input(num_systems, false);
+  for (const InputPortLocator& input : input_port_ids_) {
+    reads_exported_input[GetSystemIndexOrAbort(input.first)] = true;
+  }
+
+  // Union-find over the subsystems, plus one extra element (with index
+  // num_systems) that stands for "everything outside of this Diagram".
+  std::vector<int> parent(num_systems + 1);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&parent](int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  auto unite = [&](int i, int j) { parent[find(i)] = find(j); };
+
+  // Merge each port's owner with every subsystem its evaluation may reach.
+  std::vector<int> owners(ports.size());
+  std::vector<bool> visited(num_systems);
+  std::vector<int> stack;
+  for (size_t p = 0; p < ports.size(); ++p) {
+    DRAKE_THROW_UNLESS(ports[p] != nullptr);
+    const System<T>* system = &ports[p]->get_system();
+    const auto iter = system_index_map_.find(system);
+    if (iter == system_index_map_.end()) {
+      throw std::logic_error(fmt::format(
+          "EvalSubsystemOutputPortsInParallel(): output port '{}' of system "
+          "'{}' does not belong to an immediate subsystem of Diagram '{}'.",
+          ports[p]->get_name(), system->get_name(), this->get_name()));
+    }
+    const int owner = iter->second;
+    owners[p] = owner;
+    std::fill(visited.begin(), visited.end(), false);
+    stack.assign(1, owner);
+    visited[owner] = true;
+    while (!stack.empty()) {
+      const int current = stack.back();
+      stack.pop_back();
+      unite(current, owner);
+      if (reads_exported_input[current]) {
+        unite(num_systems, owner);
+      }
+      for (SubsystemIndex next : upstream[current]) {
+        if (!visited[next]) {
+          visited[next] = true;
+          stack.push_back(next);
+        }
+      }
+    }
+  }
+
+  // Collect the ports by their owners' representative, preserving the order
+  // of first appearance so that the result is deterministic.
+  std::vector<std::vector<int>> groups;
+  std::map<int, int> group_of_root;
+  for (size_t p = 0; p < ports.size(); ++p) {
+    const int root = find(owners[p]);
+    const auto [iter, inserted] =
+        group_of_root.emplace(root, static_cast<int>(groups.size()));
+    if (inserted) {
+      groups.emplace_back();
+    }
+    groups[iter->second].push_back(static_cast<int>(p));
+  }
+  return groups;
+}
+
 template <typename T>
 Diagram<T>::Diagram() : System<T>(
     SystemScalarConverter(
@@ -831,8 +940,13 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
   *next_update_time = std::numeric_limits<double>::infinity();
 
-  // Iterate over the subsystems, and harvest the most imminent updates.
-  std::vector<T> times(num_subsystems());
+  // Iterate over the subsystems, and harvest the most imminent updates. The
+  // event collections of subsystems whose next update time is bigger than
+  // next_update_time are cleared as we go (rather than recording every
+  // subsystem's time and clearing afterwards) so that no heap allocation is
+  // needed. Every subsystem before `first_at_min` that does not share the
+  // current minimum has already been cleared.
+  SubsystemIndex first_at_min(0);
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     CompositeEventCollection<T>& subinfo =
@@ -840,19 +954,17 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
     const T sub_time =
         registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-    times[i] = sub_time;
 
     if (sub_time < *next_update_time) {
+      for (SubsystemIndex j = first_at_min; j < i; ++j) {
+        info->get_mutable_subevent_collection(j).Clear();
+      }
       *next_update_time = sub_time;
+      first_at_min = i;
+    } else if (sub_time > *next_update_time) {
+      subinfo.Clear();
     }
   }
-
-  // For all the subsystems whose next update time is bigger than
-  // next_update_time, clear their event collections.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    if (times[i] > *next_update_time)
-      info->get_mutable_subevent_collection(i).Clear();
-  }
 }
 
 template <typename T>
@@ -9,6 +9,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
 #include "drake/systems/framework/diagram_discrete_values.h"
@@ -227,6 +228,47 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   bool AreConnected(const OutputPort<T>& output,
                     const InputPort<T>& input) const;
 
+  /// (Advanced) Evaluates each of the given output `ports` of this Diagram's
+  /// immediate subsystems, so that their values (and everything they depend
+  /// on) are brought up to date in `context`. Ports whose evaluation can
+  /// only touch disjoint sets of subsystems are evaluated concurrently, using
+  /// up to `num_parallel_executions` threads; the rest are evaluated serially,
+  /// in the order given, within a shared work item.
+  ///
+  /// Independence is determined conservatively from the connection graph: a
+  /// port is assumed to depend on every subsystem upstream of its owning
+  /// subsystem (ignoring direct-feedthrough information), and all ports whose
+  /// evaluation could reach this Diagram's exported input ports are grouped
+  /// together. Because every subsystem's Context (and Cache) is then touched
+  /// by at most one thread, this satisfies the threading rules documented in
+  /// CacheEntryValue. For example, several sensor pipelines that each read
+  /// only their own upstream subsystems can be computed at the same time,
+  /// whereas ports that all depend on a common subsystem are serialized. In
+  /// particular, every port downstream of a shared SceneGraph (such as the
+  /// images of an RgbdSensor) lands in the same group as the outputs of the
+  /// MultibodyPlant that feeds that SceneGraph, so this method provides no
+  /// concurrency between them.
+  ///
+  /// Simulator::set_parallel_output_prefetch() arranges for this method to be
+  /// called at the start of every step of Simulator::AdvanceTo(), so that the
+  /// event handlers of that step find the given ports already up to date:
+  /// @code
+  ///   simulator.set_parallel_output_prefetch(ports);
+  /// @endcode
+  ///
+  /// @warning Subsystems' output calculations must obey the framework rule that
+  /// all computed results live in the Context; a subsystem that mutates
+  /// member data (or other shared state) during output calculation is not
+  /// safe to use with this method.
+  ///
+  /// @throws std::exception if any port does not belong to an immediate
+  ///   subsystem of this Diagram, if `num_parallel_executions` is neither
+  ///   positive nor kUseHardwareConcurrency, or if any port evaluation throws.
+  void EvalSubsystemOutputPortsInParallel(
+      const Context<T>& context,
+      const std::vector<const OutputPort<T>*>& ports,
+      int num_parallel_executions = kUseHardwareConcurrency) const;
+
   using System<T>::GetSubsystemContext;
   using System<T>::GetMutableSubsystemContext;
 
@@ -496,6 +538,13 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   typename DiagramContext<T>::OutputPortIdentifier
   ConvertToContextPortIdentifier(const OutputPortLocator& locator) const;
 
+  // Partitions the given subsystem output ports into groups that may be
+  // evaluated concurrently; see EvalSubsystemOutputPortsInParallel(). Each
+  // group lists indices into `ports`, in increasing order; the groups are
+  // ordered by their first element.
+  std::vector<std::vector<int>> PartitionIntoIndependentGroups(
+      const std::vector<const OutputPort<T>*>& ports) const;
+
   // Returns true if every port mentioned in the connection map exists.
   bool PortsAreValid() const;
 
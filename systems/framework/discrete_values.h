@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -151,9 +152,15 @@ class DiscreteValues {
   void SetFrom(const DiscreteValues<U>& other) {
     DRAKE_THROW_UNLESS(num_groups() == other.num_groups());
     for (int i = 0; i < num_groups(); i++) {
-      data_[i]->set_value(
-          other.get_vector(i).get_value().unaryExpr(
-              scalar_conversion::ValueConverter<T, U>{}));
+      if constexpr (std::is_same_v<T, U>) {
+        // Avoid the temporary that the conversion expression below would
+        // require, so that same-scalar copies do not allocate.
+        data_[i]->set_value(other.get_vector(i).get_value());
+      } else {
+        data_[i]->set_value(
+            other.get_vector(i).get_value().unaryExpr(
+                scalar_conversion::ValueConverter<T, U>{}));
+      }
     }
   }
 
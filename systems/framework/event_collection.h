@@ -105,7 +105,8 @@ class EventCollection {
 
   /**
    * Clears all the events maintained by `this` then adds all of the events in
-   * `other` to this.
+   * `other` to this. Every event is copied, including those that `other`
+   * merely refers to (see LeafEventCollection::AddUnownedEvent()).
    */
   void SetFrom(const EventCollection<EventType>& other) {
     Clear();
@@ -113,10 +114,26 @@ class EventCollection {
   }
 
   /**
-   * Adds all of `other`'s events to the end of `this`.
+   * Adds all of `other`'s events to the end of `this`. Every event is copied,
+   * including those that `other` merely refers to (see
+   * LeafEventCollection::AddUnownedEvent()), so that `this` does not depend
+   * on the lifetime of any event it did not get from add_event().
    */
   void AddToEnd(const EventCollection<EventType>& other) {
-    DoAddToEnd(other);
+    DoAddToEnd(other, false);
+  }
+
+  /**
+   * (Advanced) Like AddToEnd(), except that the events that `other` merely
+   * refers to (see LeafEventCollection::AddUnownedEvent()) are referred to by
+   * `this` as well, rather than copied, so that merging a collection of
+   * System-owned events does not allocate memory once `this` has been sized.
+   * The Simulator uses this on every step.
+   * @pre Every event that `other` refers to without owning outlives every
+   *      use of `this` until its next Clear().
+   */
+  void AddToEndSharingUnownedEvents(const EventCollection<EventType>& other) {
+    DoAddToEnd(other, true);
   }
 
   /**
@@ -142,7 +159,13 @@ class EventCollection {
    */
   EventCollection() = default;
 
-  virtual void DoAddToEnd(const EventCollection<EventType>& other) = 0;
+  /**
+   * Adds all of `other`'s events to the end of `this`. The events that `other`
+   * merely refers to are copied, unless `share_unowned_events` is true, in
+   * which case `this` refers to them as well.
+   */
+  virtual void DoAddToEnd(const EventCollection<EventType>& other,
+                          bool share_unowned_events) = 0;
 };
 
 /**
@@ -273,15 +296,20 @@ class DiagramEventCollection final : public EventCollection<EventType> {
    * @throws std::bad_cast if `other_collection` is not an instance of
    * DiagramEventCollection.
    */
-  void DoAddToEnd(
-      const EventCollection<EventType>& other_collection) override {
+  void DoAddToEnd(const EventCollection<EventType>& other_collection,
+                  bool share_unowned_events) override {
     const DiagramEventCollection<EventType>& other =
         dynamic_cast<const DiagramEventCollection<EventType>&>(
             other_collection);
     DRAKE_DEMAND(num_subsystems() == other.num_subsystems());
 
     for (int i = 0; i < num_subsystems(); i++) {
-      subevent_collection_[i]->AddToEnd(other.get_subevent_collection(i));
+      if (share_unowned_events) {
+        subevent_collection_[i]->AddToEndSharingUnownedEvents(
+            other.get_subevent_collection(i));
+      } else {
+        subevent_collection_[i]->AddToEnd(other.get_subevent_collection(i));
+      }
     }
   }
 
@@ -336,6 +364,27 @@ class LeafEventCollection final : public EventCollection<EventType> {
     DRAKE_DEMAND(event != nullptr);
     owned_events_.push_back(std::move(event));
     events_.push_back(owned_events_.back().get());
+    is_owned_.push_back(true);
+  }
+
+  /**
+   * Adds `event` to the existing collection *without* copying it or taking
+   * ownership. This is intended for events whose lifetime is tied to a
+   * System (e.g., declared periodic or per-step events), so that repeatedly
+   * collecting them (as the Simulator does on every step) does not need to
+   * allocate memory once the collection's storage has been sized.
+   *
+   * @pre `event` is not null.
+   * @pre `event` outlives every use of this collection until the next
+   *      Clear(), and every use of any collection that the event is shared
+   *      with through AddToEndSharingUnownedEvents(). (AddToEnd() and
+   *      SetFrom() copy the event instead.) A dangling event is undefined
+   *      behavior that is not detected.
+   */
+  void AddUnownedEvent(const EventType* event) {
+    DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event);
+    is_owned_.push_back(false);
   }
 
   /**
@@ -349,6 +398,7 @@ class LeafEventCollection final : public EventCollection<EventType> {
   void Clear() override {
     owned_events_.clear();
     events_.clear();
+    is_owned_.clear();
   }
 
  protected:
@@ -368,16 +418,27 @@ class LeafEventCollection final : public EventCollection<EventType> {
    *   EventType: {event1, event2, event3, event4}
    * </pre>
    *
+   * Events owned by `other_collection` are cloned. Events that
+   * `other_collection` merely refers to (see AddUnownedEvent()) are cloned as
+   * well, unless `share_unowned_events` is true, in which case `this` refers
+   * to them too.
+   *
    * @throws std::bad_cast if `other_collection` is not an instance of
    * LeafEventCollection.
    */
-  void DoAddToEnd(const EventCollection<EventType>& other_collection) override {
+  void DoAddToEnd(const EventCollection<EventType>& other_collection,
+                  bool share_unowned_events) override {
     const LeafEventCollection<EventType>& other =
         dynamic_cast<const LeafEventCollection<EventType>&>(other_collection);
 
     const std::vector<const EventType*>& other_events = other.get_events();
-    for (const EventType* other_event : other_events) {
-      this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+    for (int i = 0; i < static_cast<int>(other_events.size()); ++i) {
+      const EventType* other_event = other_events[i];
+      if (share_unowned_events && !other.is_owned_[i]) {
+        this->AddUnownedEvent(other_event);
+      } else {
+        this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+      }
     }
   }
 
@@ -385,9 +446,13 @@ class LeafEventCollection final : public EventCollection<EventType> {
   // Owned event unique pointers.
   std::vector<std::unique_ptr<EventType>> owned_events_;
 
-  // Points to the corresponding unique pointers. This is primarily used for
-  // get_events().
+  // Points to the corresponding unique pointers, or to unowned events. This is
+  // primarily used for get_events().
   std::vector<const EventType*> events_;
+
+  // Whether events_[i] points into owned_events_ (true) or to an event that
+  // was added via AddUnownedEvent() (false).
+  std::vector<bool> is_owned_;
 };
 
 /**
@@ -510,6 +575,20 @@ class CompositeEventCollection {
         other.get_unrestricted_update_events());
   }
 
+  /**
+   * (Advanced) Like AddToEnd(), except that events that `other` merely refers
+   * to are shared rather than copied; see
+   * EventCollection::AddToEndSharingUnownedEvents(), whose precondition
+   * applies.
+   */
+  void AddToEndSharingUnownedEvents(const CompositeEventCollection<T>& other) {
+    publish_events_->AddToEndSharingUnownedEvents(other.get_publish_events());
+    discrete_update_events_->AddToEndSharingUnownedEvents(
+        other.get_discrete_update_events());
+    unrestricted_update_events_->AddToEndSharingUnownedEvents(
+        other.get_unrestricted_update_events());
+  }
+
   /**
    * Copies the collections of homogeneous events from `other` to `this`.
    */
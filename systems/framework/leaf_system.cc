@@ -41,6 +41,44 @@ T GetNextSampleTime(
   return next_t;
 }
 
+// Adds all of the events in `source` to `destination` by reference (see
+// LeafEventCollection::AddUnownedEvent()). The events in `source` must be
+// owned by a LeafSystem, so that they outlive `destination`'s use of them.
+template <typename EventType>
+void AddUnownedEvents(const LeafEventCollection<EventType>& source,
+                      EventCollection<EventType>* destination) {
+  auto& leaf_destination =
+      dynamic_cast<LeafEventCollection<EventType>&>(*destination);
+  for (const EventType* event : source.get_events()) {
+    leaf_destination.AddUnownedEvent(event);
+  }
+}
+
+// Adds `event` by reference to the subcollection of `events` that matches
+// its concrete type. The same ownership requirement as AddUnownedEvents()
+// applies, and `event`'s trigger type must already be set.
+template <typename T>
+void AddUnownedEventToComposite(const Event<T>& event,
+                                CompositeEventCollection<T>* events) {
+  DRAKE_DEMAND(event.get_trigger_type() != TriggerType::kUnknown);
+  if (const auto* publish = dynamic_cast<const PublishEvent<T>*>(&event)) {
+    dynamic_cast<LeafEventCollection<PublishEvent<T>>&>(
+        events->get_mutable_publish_events()).AddUnownedEvent(publish);
+  } else if (const auto* discrete =
+                 dynamic_cast<const DiscreteUpdateEvent<T>*>(&event)) {
+    dynamic_cast<LeafEventCollection<DiscreteUpdateEvent<T>>&>(
+        events->get_mutable_discrete_update_events()).AddUnownedEvent(
+            discrete);
+  } else if (const auto* unrestricted =
+                 dynamic_cast<const UnrestrictedUpdateEvent<T>*>(&event)) {
+    dynamic_cast<LeafEventCollection<UnrestrictedUpdateEvent<T>>&>(
+        events->get_mutable_unrestricted_update_events()).AddUnownedEvent(
+            unrestricted);
+  } else {
+    DRAKE_UNREACHABLE();
+  }
+}
+
 }  // namespace
 
 template <typename T>
@@ -350,25 +388,24 @@ void LeafSystem<T>::DoCalcNextUpdateTime(
     return;
   }
 
-  // Find the minimum next sample time across all declared periodic events,
-  // and store the set of declared events that will occur at that time.
-  std::vector<const Event<T>*> next_events;
+  // Find the minimum next sample time across all declared periodic events.
   for (const auto& event_pair : periodic_events_) {
     const PeriodicEventData& event_data = event_pair.first;
-    const Event<T>* const event = event_pair.second.get();
     const T t = GetNextSampleTime(event_data, context.get_time());
     if (t < min_time) {
       min_time = t;
-      next_events = {event};
-    } else if (t == min_time) {
-      next_events.push_back(event);
     }
   }
 
-  // Write out the events that fire at min_time.
+  // Write out the declared events that fire at min_time. Those events are
+  // owned by this System, so they are referred to rather than copied; this
+  // keeps the Simulator's steady-state stepping free of heap allocations.
   *time = min_time;
-  for (const Event<T>* event : next_events) {
-    event->AddToComposite(events);
+  for (const auto& event_pair : periodic_events_) {
+    const PeriodicEventData& event_data = event_pair.first;
+    if (GetNextSampleTime(event_data, context.get_time()) == min_time) {
+      AddUnownedEventToComposite(*event_pair.second, events);
+    }
   }
 }
 
@@ -842,7 +879,15 @@ template <typename T>
 void LeafSystem<T>::DoGetPerStepEvents(
     const Context<T>&,
     CompositeEventCollection<T>* events) const {
-  events->SetFrom(per_step_events_);
+  // The declared per-step events are owned by this System, so they are
+  // referred to rather than copied.
+  events->Clear();
+  AddUnownedEvents(per_step_events_.get_publish_events(),
+                   &events->get_mutable_publish_events());
+  AddUnownedEvents(per_step_events_.get_discrete_update_events(),
+                   &events->get_mutable_discrete_update_events());
+  AddUnownedEvents(per_step_events_.get_unrestricted_update_events(),
+                   &events->get_mutable_unrestricted_update_events());
 }
 
 template <typename T>
@@ -640,7 +640,9 @@ class System : public SystemBase {
   merged CompositeEventCollection will be passed to all event handling
   mechanisms.
 
-  @p events cannot be null. @p events will be cleared on entry. */
+  @p events cannot be null. @p events will be cleared on entry. The events
+  recorded in @p events may refer to (rather than copy) events owned by this
+  System, so @p events must not be used after this System is destroyed. */
   T CalcNextUpdateTime(const Context<T>& context,
                        CompositeEventCollection<T>* events) const;
 
@@ -655,7 +657,8 @@ class System : public SystemBase {
   will be passed to the appropriate handlers before Simulator integrates the
   continuous state.
 
-  @p events cannot be null. @p events will be cleared on entry. */
+  @p events cannot be null. @p events will be cleared on entry. As with
+  CalcNextUpdateTime(), @p events may refer to events owned by this System. */
   void GetPerStepEvents(const Context<T>& context,
                         CompositeEventCollection<T>* events) const;
 
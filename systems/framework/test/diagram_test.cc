@@ -1,5 +1,9 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <Eigen/Dense>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -3608,6 +3612,182 @@ GTEST_TEST(ImplicitTimeDerivatives, DiagramProcessing) {
   EXPECT_EQ(residual, expected_result);
 }
 
+// A system whose output is its (optional) input plus one. The output
+// calculation sleeps briefly and records whether it was ever entered by two
+// threads at the same time. (The atomic counters are test instrumentation;
+// they are not part of the computed results.)
+class SleepyIncrement : public LeafSystem<double> {
+ public:
+  explicit SleepyIncrement(bool has_input) {
+    if (has_input) {
+      this->DeclareInputPort(kVectorValued, 1);
+    }
+    this->DeclareVectorOutputPort(BasicVector<double>(1),
+                                  &SleepyIncrement::CalcOutput);
+  }
+
+  int num_overlapping_calcs() const { return num_overlapping_calcs_; }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    if (++num_active_calcs_ > 1) {
+      ++num_overlapping_calcs_;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    const double u =
+        this->num_input_ports() > 0 ? this->get_input_port(0).Eval(context)[0]
+                                    : 0.0;
+    (*output)[0] = u + 1.0;
+    --num_active_calcs_;
+  }
+
+  mutable std::atomic<int> num_active_calcs_{0};
+  mutable std::atomic<int> num_overlapping_calcs_{0};
+};
+
+// Builds chains of SleepyIncrement systems: two independent chains
+// (a0 -> a1, b0 -> b1), plus two sinks (c, d) that share one source (s).
+class ParallelEvalTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    auto add = [&builder](bool has_input, const std::string& name) {
+      auto* system = builder.AddSystem<SleepyIncrement>(has_input);
+      system->set_name(name);
+      return system;
+    };
+    a0_ = add(false, "a0");
+    a1_ = add(true, "a1");
+    b0_ = add(false, "b0");
+    b1_ = add(true, "b1");
+    s_ = add(false, "s");
+    c_ = add(true, "c");
+    d_ = add(true, "d");
+    builder.Connect(a0_->get_output_port(0), a1_->get_input_port(0));
+    builder.Connect(b0_->get_output_port(0), b1_->get_input_port(0));
+    builder.Connect(s_->get_output_port(0), c_->get_input_port(0));
+    builder.Connect(s_->get_output_port(0), d_->get_input_port(0));
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+  }
+
+  double EvalOutput(const SleepyIncrement& system) const {
+    return system.get_output_port(0).Eval(
+        diagram_->GetSubsystemContext(system, *context_))[0];
+  }
+
+  int64_t OutputSerialNumber(const SleepyIncrement& system) const {
+    const auto& port =
+        dynamic_cast<const LeafOutputPort<double>&>(system.get_output_port(0));
+    return port.cache_entry()
+        .get_cache_entry_value(
+            diagram_->GetSubsystemContext(system, *context_))
+        .serial_number();
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  SleepyIncrement* a0_{};
+  SleepyIncrement* a1_{};
+  SleepyIncrement* b0_{};
+  SleepyIncrement* b1_{};
+  SleepyIncrement* s_{};
+  SleepyIncrement* c_{};
+  SleepyIncrement* d_{};
+};
+
+TEST_F(ParallelEvalTest, ComputesEveryPortOnce) {
+  const std::vector<const OutputPort<double>*> ports{
+      &a1_->get_output_port(0), &b1_->get_output_port(0),
+      &c_->get_output_port(0), &d_->get_output_port(0)};
+  for (int repeat = 0; repeat < 5; ++repeat) {
+    context_->SetTime(repeat);
+    diagram_->EvalSubsystemOutputPortsInParallel(*context_, ports, 4);
+  }
+
+  // Shared upstream systems were never entered concurrently.
+  for (const SleepyIncrement* system : {a0_, a1_, b0_, b1_, s_, c_, d_}) {
+    EXPECT_EQ(system->num_overlapping_calcs(), 0) << system->get_name();
+  }
+
+  // The values are correct and were already up to date, i.e., reading them
+  // now does not recompute them.
+  const int64_t serial = OutputSerialNumber(*c_);
+  EXPECT_EQ(EvalOutput(*a1_), 2.0);
+  EXPECT_EQ(EvalOutput(*b1_), 2.0);
+  EXPECT_EQ(EvalOutput(*c_), 2.0);
+  EXPECT_EQ(EvalOutput(*d_), 2.0);
+  EXPECT_EQ(OutputSerialNumber(*c_), serial);
+}
+
+TEST_F(ParallelEvalTest, SerialMatchesParallel) {
+  const std::vector<const OutputPort<double>*> ports{
+      &a1_->get_output_port(0), &s_->get_output_port(0)};
+  diagram_->EvalSubsystemOutputPortsInParallel(*context_, ports,
+                                               kNoConcurrency);
+  EXPECT_EQ(EvalOutput(*a1_), 2.0);
+  EXPECT_EQ(EvalOutput(*s_), 1.0);
+}
+
+// A source whose output calculation waits until `num_expected` calculations
+// sharing the same `arrivals` counter have started, so that it can only
+// complete promptly when those calculations run concurrently. A generous
+// timeout keeps a serial evaluation from hanging the test.
+class RendezvousSource : public LeafSystem<double> {
+ public:
+  RendezvousSource(std::atomic<int>* arrivals, int num_expected)
+      : arrivals_(arrivals), num_expected_(num_expected) {
+    this->DeclareVectorOutputPort(BasicVector<double>(1),
+                                  &RendezvousSource::CalcOutput);
+  }
+
+  bool met_others() const { return met_others_; }
+
+ private:
+  void CalcOutput(const Context<double>&, BasicVector<double>* output) const {
+    ++*arrivals_;
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (*arrivals_ < num_expected_ &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    met_others_ = (*arrivals_ >= num_expected_);
+    (*output)[0] = 1.0;
+  }
+
+  std::atomic<int>* const arrivals_;
+  const int num_expected_;
+  mutable std::atomic<bool> met_others_{false};
+};
+
+// Independent groups are actually evaluated at the same time: each source
+// only finishes once the other has started.
+GTEST_TEST(ParallelEvalOverlapTest, IndependentGroupsOverlap) {
+  std::atomic<int> arrivals{0};
+  DiagramBuilder<double> builder;
+  auto* first = builder.AddSystem<RendezvousSource>(&arrivals, 2);
+  auto* second = builder.AddSystem<RendezvousSource>(&arrivals, 2);
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  diagram->EvalSubsystemOutputPortsInParallel(
+      *context, {&first->get_output_port(0), &second->get_output_port(0)}, 2);
+  EXPECT_EQ(arrivals, 2);
+  EXPECT_TRUE(first->met_others());
+  EXPECT_TRUE(second->met_others());
+}
+
+TEST_F(ParallelEvalTest, RejectsForeignPorts) {
+  SleepyIncrement stranger(false);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram_->EvalSubsystemOutputPortsInParallel(
+          *context_, {&stranger.get_output_port(0)}),
+      std::logic_error,
+      ".*does not belong to an immediate subsystem.*");
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
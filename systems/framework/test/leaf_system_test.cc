@@ -407,6 +407,35 @@ TEST_F(LeafSystemTest, ForcedEventCollectionsTest) {
       forced_unrestricted_updates_pointer);
 }
 
+// Copying or merging a collection copies even the events that it merely refers
+// to, unless those events are explicitly shared.
+GTEST_TEST(LeafEventCollectionTest, UnownedEvents) {
+  const PublishEvent<double> event(TriggerType::kPeriodic);
+  LeafEventCollection<PublishEvent<double>> source;
+  source.AddUnownedEvent(&event);
+  ASSERT_EQ(source.get_events().size(), 1);
+  EXPECT_EQ(source.get_events()[0], &event);
+
+  LeafEventCollection<PublishEvent<double>> copied;
+  copied.SetFrom(source);
+  copied.AddToEnd(source);
+  ASSERT_EQ(copied.get_events().size(), 2);
+  for (const PublishEvent<double>* copy : copied.get_events()) {
+    EXPECT_NE(copy, &event);
+    EXPECT_EQ(copy->get_trigger_type(), TriggerType::kPeriodic);
+  }
+
+  LeafEventCollection<PublishEvent<double>> shared;
+  shared.AddToEndSharingUnownedEvents(source);
+  ASSERT_EQ(shared.get_events().size(), 1);
+  EXPECT_EQ(shared.get_events()[0], &event);
+  // The events that a collection owns are copied even when sharing.
+  shared.AddToEndSharingUnownedEvents(copied);
+  ASSERT_EQ(shared.get_events().size(), 3);
+  EXPECT_NE(shared.get_events()[1], copied.get_events()[0]);
+  EXPECT_NE(shared.get_events()[2], copied.get_events()[1]);
+}
+
 TEST_F(LeafSystemTest, DefaultPortNameTest) {
   EXPECT_EQ(system_.DeclareVectorInputPort(BasicVector<double>(2)).get_name(),
             "u0");
@@ -1,7 +1,14 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace systems {
@@ -15,26 +22,120 @@ SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
   DRAKE_DEMAND(batch_allocation_size_ > 0);
 }
 
+template <typename T>
+SignalLog<T>::~SignalLog() {
+  try {
+    CloseFile();
+  } catch (const std::exception& e) {
+    drake::log()->error("{}", e.what());
+  }
+}
+
+template <typename T>
+void SignalLog<T>::reset() {
+  CloseFile();
+  // Resetting num_samples_ is sufficient to have all future writes and
+  // reads re-initialized to the beginning of the data.
+  start_ = 0;
+  num_samples_ = 0;
+}
+
+template <typename T>
+void SignalLog<T>::set_max_samples(int max_samples) {
+  DRAKE_THROW_UNLESS(max_samples > 0);
+  max_samples_ = max_samples;
+  if (num_samples_ > max_samples) {
+    start_ += num_samples_ - max_samples;
+    num_samples_ = max_samples;
+  }
+  if (sample_times_.size() > 2 * int64_t{max_samples}) {
+    Reallocate(2 * int64_t{max_samples});
+  }
+}
+
+template <typename T>
+void SignalLog<T>::StreamToFile(const std::string& filename, int chunk_size) {
+  CloseFile();
+  file_writer_ = std::make_unique<SignalLogFileWriter>(
+      filename, static_cast<int>(get_input_size()), chunk_size);
+}
+
+template <typename T>
+void SignalLog<T>::CloseFile() {
+  if (file_writer_ == nullptr) return;
+  // Stop streaming even if the file cannot be completed.
+  ScopeExit guard([this]() {
+    file_writer_.reset();
+    has_pending_sample_ = false;
+  });
+  WritePendingSample();
+  file_writer_->Close();
+}
+
+template <typename T>
+void SignalLog<T>::WritePendingSample() {
+  if (!has_pending_sample_) return;
+  has_pending_sample_ = false;
+  const int64_t last = start_ + num_samples_ - 1;
+  const Eigen::VectorXd sample = data_.col(last).unaryExpr(
+      [](const T& value) { return ExtractDoubleOrThrow(value); });
+  file_writer_->AddSample(ExtractDoubleOrThrow(sample_times_(last)), sample);
+}
+
+template <typename T>
+void SignalLog<T>::Reallocate(int64_t capacity) {
+  DRAKE_DEMAND(capacity >= num_samples_);
+  if (capacity == sample_times_.size() && start_ >= num_samples_) {
+    // The kept samples can be moved within the storage without overlap.
+    sample_times_.head(num_samples_) =
+        sample_times_.segment(start_, num_samples_);
+    data_.leftCols(num_samples_) = data_.middleCols(start_, num_samples_);
+  } else {
+    VectorX<T> sample_times(capacity);
+    MatrixX<T> data(data_.rows(), capacity);
+    sample_times.head(num_samples_) =
+        sample_times_.segment(start_, num_samples_);
+    data.leftCols(num_samples_) = data_.middleCols(start_, num_samples_);
+    sample_times_ = std::move(sample_times);
+    data_ = std::move(data);
+  }
+  start_ = 0;
+}
+
 template <typename T>
 void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
-    ++num_samples_;
+  if (num_samples_ == 0 ||
+      time >= sample_times_(start_ + num_samples_ - 1)) {
+    // The previous sample will no longer be replaced.
+    if (file_writer_ != nullptr) WritePendingSample();
+
+    // If the storage is full, then either move the kept samples to its start
+    // (when the log is bounded, and they fill at most half of it) or double
+    // its size, so that each sample is copied O(1) times on average.
+    const int64_t capacity = sample_times_.size();
+    if (start_ + num_samples_ == capacity) {
+      if (num_samples_ <= capacity / 2) {
+        Reallocate(capacity);
+      } else {
+        int64_t new_capacity = 2 * capacity;
+        if (max_samples_.has_value()) {
+          new_capacity = std::min(new_capacity, 2 * int64_t{*max_samples_});
+        }
+        Reallocate(new_capacity);
+      }
+    }
 
-  // If num_samples exceeds the current allocation, then do a conservative
-  // resize (ouch!).
-  // TODO(russt): change to allocating on a std::vector here and moving into a
-  // single block of contiguous memory on the (first) data access, to avoid the
-  // O(n^2) complexity.
-  if (num_samples_ > sample_times_.size()) {
-    sample_times_.conservativeResize(sample_times_.size() +
-        batch_allocation_size_);
-    data_.conservativeResize(data_.rows(),
-                             data_.cols() + batch_allocation_size_);
+    ++num_samples_;
+    if (max_samples_.has_value() && num_samples_ > *max_samples_) {
+      ++start_;
+      --num_samples_;
+    }
   }
 
-  // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  // Record time and input to the most recent position.
+  sample_times_(start_ + num_samples_ - 1) = time;
+  data_.col(start_ + num_samples_ - 1) = sample;
+  has_pending_sample_ = file_writer_ != nullptr;
 }
 
 }  // namespace systems
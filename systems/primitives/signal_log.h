@@ -1,7 +1,12 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <string>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/systems/primitives/signal_log_file.h"
 
 namespace drake {
 namespace systems {
@@ -12,6 +17,12 @@ namespace systems {
  primarily intended to support the Drake System primitive SignalLogger, but can
  be used independently.
 
+ By default, every sample is kept in memory; adding a sample takes amortized
+ O(1) time, as the storage grows geometrically. For long-running simulations,
+ the memory used by the log may be bounded by keeping only the most recent
+ samples (see set_max_samples()), and every sample may additionally be streamed
+ to a file (see StreamToFile()) to be read later by SignalLogFileReader.
+
  @tparam_default_scalar
  */
 template <typename T>
@@ -21,31 +32,69 @@ class SignalLog {
 
   /** Constructs the signal log.
    @param input_size                Dimension of the per-time step data set.
-   @param batch_allocation_size     Storage is (re)allocated in blocks of size
-                                    (input_size X batch_allocation_size).
+   @param batch_allocation_size     Storage is initially allocated for
+                                    batch_allocation_size samples, and its
+                                    size is doubled whenever it is full.
   */
   explicit SignalLog(int input_size, int batch_allocation_size = 1000);
 
-  /** Returns the number of samples taken since construction or last reset(). */
+  /** Completes the file that the log is streaming to, if any (see
+   CloseFile()). Errors are logged, rather than thrown.  */
+  ~SignalLog();
+
+  /** Returns the number of samples kept since construction or last reset().
+   This is the number of samples taken, unless set_max_samples() has been
+   called.  */
   int num_samples() const { return num_samples_; }
 
   /** Accesses the logged time stamps. */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
-    return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
+    return const_cast<const VectorX<T>&>(sample_times_)
+        .segment(start_, num_samples_);
   }
 
   /** Accesses the logged data. */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
-    return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
+    return const_cast<const MatrixX<T>&>(data_).middleCols(start_,
+                                                           num_samples_);
   }
 
-  /** Clears the logged data. */
-  void reset() {
-    // Resetting num_samples_ is sufficient to have all future writes and
-    // reads re-initialized to the beginning of the data.
-    num_samples_ = 0;
-  }
+  /** Clears the logged data, and completes the file that the log is streaming
+   to, if any (see CloseFile()). */
+  void reset();
+
+  /** Bounds the memory used by the log by keeping only the most recent
+   `max_samples` samples; older samples are discarded (from sample_times() and
+   data()) as new ones are added, and immediately if more than `max_samples`
+   samples are currently kept. The storage is then limited to
+   2 * max_samples samples, and adding a sample still takes amortized O(1)
+   time.
+   @throws std::exception unless max_samples > 0.  */
+  void set_max_samples(int max_samples);
+
+  /** Returns the limit on the number of samples kept, if any.  */
+  std::optional<int> max_samples() const { return max_samples_; }
+
+  /** Streams the samples added from now on to the signal log file `filename`
+   (see SignalLogFileWriter), in chunks of `chunk_size` samples, until
+   CloseFile() or reset() is called or the log is destroyed. The most recent
+   sample is written to the file only once a later sample is added, or the
+   file is closed, since (as in memory) it is replaced if the next sample has
+   an earlier time. The times and values of the samples must be
+   convertible to double (see ExtractDoubleOrThrow()).
+
+   Any file that the log is already streaming to is first closed.
+   @throws std::exception if the file cannot be opened for writing.  */
+  void StreamToFile(const std::string& filename, int chunk_size = 4096);
+
+  /** Writes the remaining samples to the file that the log is streaming to, if
+   any, completes it, and stops streaming.
+   @throws std::exception if the file cannot be written.  */
+  void CloseFile();
+
+  /** Returns true iff the log is streaming to a file.  */
+  bool is_streaming_to_file() const { return file_writer_ != nullptr; }
 
   /** Adds a `sample` to the data set with the associated `time` value.
 
@@ -58,12 +107,25 @@ class SignalLog {
   int64_t get_input_size() const { return data_.rows(); }
 
  private:
+  // Moves the kept samples to the start of storage of `capacity` samples.
+  void Reallocate(int64_t capacity);
+
+  // Writes the most recent sample to the file, if it has not been written.
+  void WritePendingSample();
+
   const int batch_allocation_size_{1000};
+  std::optional<int> max_samples_;
 
-  // Use mutable variables to hold the logged data.
+  // Use mutable variables to hold the logged data. The kept samples are those
+  // in [start_, start_ + num_samples_) of the storage.
+  mutable int64_t start_{0};
   mutable int64_t num_samples_{0};
   mutable VectorX<T> sample_times_;
   mutable MatrixX<T> data_;
+
+  std::unique_ptr<SignalLogFileWriter> file_writer_;
+  // True iff the most recent sample has yet to be written to the file.
+  bool has_pending_sample_{false};
 };
 }  // namespace systems
 }  // namespace drake
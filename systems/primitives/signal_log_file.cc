@@ -0,0 +1,300 @@
+#include "drake/systems/primitives/signal_log_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Bump this whenever the layout of the file changes.
+constexpr uint32_t kFormatVersion = 1;
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'S', 'L', 'O', 'G', '1'};
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t input_size;
+  uint64_t chunk_size;
+};
+static_assert(sizeof(FileHeader) % 8 == 0);
+
+struct FileFooter {
+  uint64_t index_offset;
+  uint64_t num_chunks;
+  uint64_t num_samples;
+  char magic[8];
+};
+static_assert(sizeof(FileFooter) % 8 == 0);
+
+}  // namespace
+
+SignalLogFileWriter::SignalLogFileWriter(const std::string& filename,
+                                         int input_size, int chunk_size)
+    : filename_(filename),
+      input_size_(input_size),
+      chunk_size_(chunk_size),
+      output_(filename, std::ios::binary | std::ios::trunc) {
+  DRAKE_DEMAND(input_size > 0);
+  DRAKE_DEMAND(chunk_size > 0);
+  if (!output_.is_open()) {
+    throw std::runtime_error(fmt::format(
+        "SignalLogFileWriter: cannot open '{}' for writing", filename_));
+  }
+  buffer_.resize(chunk_size_, 1 + input_size_);
+
+  FileHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.input_size = input_size_;
+  header.chunk_size = chunk_size_;
+  Write(&header, sizeof(header));
+}
+
+SignalLogFileWriter::~SignalLogFileWriter() {
+  try {
+    Close();
+  } catch (const std::exception& e) {
+    drake::log()->error("{}", e.what());
+  }
+}
+
+void SignalLogFileWriter::AddSample(
+    double time, const Eigen::Ref<const Eigen::VectorXd>& sample) {
+  DRAKE_DEMAND(sample.size() == input_size_);
+  if (!is_open_) {
+    throw std::logic_error(fmt::format(
+        "SignalLogFileWriter: cannot add a sample to '{}' after it has been "
+        "closed", filename_));
+  }
+  if (num_samples_ > 0 && time < last_time_) {
+    throw std::logic_error(fmt::format(
+        "SignalLogFileWriter: the sample time {} precedes the time {} of the "
+        "previous sample", time, last_time_));
+  }
+  buffer_(num_buffered_, 0) = time;
+  buffer_.block(num_buffered_, 1, 1, input_size_) = sample.transpose();
+  ++num_buffered_;
+  ++num_samples_;
+  last_time_ = time;
+  if (num_buffered_ == chunk_size_) WriteChunk();
+}
+
+void SignalLogFileWriter::Close() {
+  if (!is_open_) return;
+  // Whatever happens below, the file cannot be written further.
+  is_open_ = false;
+  WriteChunk();
+
+  FileFooter footer{};
+  footer.index_offset = offset_;
+  footer.num_chunks = index_.size();
+  footer.num_samples = num_samples_;
+  std::memcpy(footer.magic, kMagic, sizeof(kMagic));
+  Write(index_.data(), sizeof(ChunkIndexEntry) * index_.size());
+  Write(&footer, sizeof(footer));
+  output_.close();
+  if (output_.fail()) {
+    throw std::runtime_error(fmt::format(
+        "SignalLogFileWriter: failed to write '{}'", filename_));
+  }
+}
+
+void SignalLogFileWriter::WriteChunk() {
+  if (num_buffered_ == 0) return;
+  index_.push_back({offset_, static_cast<uint64_t>(num_buffered_),
+                    buffer_(0, 0), buffer_(num_buffered_ - 1, 0)});
+  if (num_buffered_ == chunk_size_) {
+    Write(buffer_.data(), sizeof(double) * buffer_.size());
+  } else {
+    // Only the leading rows of each column of the buffer are in use.
+    for (int j = 0; j < buffer_.cols(); ++j) {
+      Write(buffer_.col(j).data(), sizeof(double) * num_buffered_);
+    }
+  }
+  num_buffered_ = 0;
+}
+
+void SignalLogFileWriter::Write(const void* data, size_t size) {
+  output_.write(static_cast<const char*>(data), size);
+  if (output_.fail()) {
+    throw std::runtime_error(fmt::format(
+        "SignalLogFileWriter: failed to write '{}'", filename_));
+  }
+  offset_ += size;
+}
+
+SignalLogFileReader::SignalLogFileReader(const std::string& filename) {
+  auto fail = [&filename](const char* reason) {
+    throw std::runtime_error(fmt::format(
+        "SignalLogFileReader: cannot read '{}': {}", filename, reason));
+  };
+
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) fail("the file cannot be opened");
+  ScopeExit close_guard([fd]() { ::close(fd); });
+
+  struct stat info;
+  if (::fstat(fd, &info) != 0) fail("the file cannot be opened");
+  const size_t size = info.st_size;
+  if (size < sizeof(FileHeader) + sizeof(FileFooter)) {
+    fail("the file is truncated");
+  }
+
+  void* const mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (mapped == MAP_FAILED) fail("the file cannot be mapped");
+  ScopeExit unmap_guard([mapped, size]() { ::munmap(mapped, size); });
+  const char* const bytes = static_cast<const char*>(mapped);
+
+  const auto& header = *reinterpret_cast<const FileHeader*>(bytes);
+  const auto& footer = *reinterpret_cast<const FileFooter*>(
+      bytes + size - sizeof(FileFooter));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    fail("the file is not a signal log file");
+  }
+  if (header.version != kFormatVersion) fail("unsupported format version");
+  if (std::memcmp(footer.magic, kMagic, sizeof(kMagic)) != 0) {
+    fail("the file is incomplete");
+  }
+  // Each index entry is a SignalLogFileWriter::ChunkIndexEntry.
+  constexpr size_t kEntrySize = 4 * sizeof(uint64_t);
+  if (header.input_size == 0 || footer.index_offset < sizeof(FileHeader) ||
+      footer.index_offset + kEntrySize * footer.num_chunks +
+              sizeof(FileFooter) != size) {
+    fail("the file is corrupt");
+  }
+
+  input_size_ = header.input_size;
+  const uint64_t* const entries =
+      reinterpret_cast<const uint64_t*>(bytes + footer.index_offset);
+  chunks_.reserve(footer.num_chunks);
+  int64_t start = 0;
+  for (uint64_t c = 0; c < footer.num_chunks; ++c) {
+    const uint64_t* const entry = entries + 4 * c;
+    const uint64_t offset = entry[0];
+    const uint64_t count = entry[1];
+    if (count == 0 || count > header.chunk_size ||
+        offset < sizeof(FileHeader) ||
+        offset + sizeof(double) * count * (1 + input_size_) >
+            footer.index_offset) {
+      fail("the file is corrupt");
+    }
+    Chunk chunk;
+    chunk.start = start;
+    chunk.num_samples = count;
+    std::memcpy(&chunk.first_time, &entry[2], sizeof(double));
+    std::memcpy(&chunk.last_time, &entry[3], sizeof(double));
+    chunk.values = reinterpret_cast<const double*>(bytes + offset);
+    chunks_.push_back(chunk);
+    start += count;
+  }
+  if (static_cast<uint64_t>(start) != footer.num_samples) {
+    fail("the file is corrupt");
+  }
+  num_samples_ = start;
+
+  unmap_guard.Disarm();
+  mapped_ = mapped;
+  mapped_size_ = size;
+}
+
+SignalLogFileReader::~SignalLogFileReader() {
+  if (mapped_ != nullptr) ::munmap(mapped_, mapped_size_);
+}
+
+int64_t SignalLogFileReader::chunk_start(int chunk) const {
+  DRAKE_THROW_UNLESS(0 <= chunk && chunk < num_chunks());
+  return chunks_[chunk].start;
+}
+
+Eigen::Map<const Eigen::VectorXd> SignalLogFileReader::chunk_sample_times(
+    int chunk) const {
+  DRAKE_THROW_UNLESS(0 <= chunk && chunk < num_chunks());
+  const Chunk& c = chunks_[chunk];
+  return Eigen::Map<const Eigen::VectorXd>(c.values, c.num_samples);
+}
+
+SignalLogFileReader::ChunkData SignalLogFileReader::chunk_data(
+    int chunk) const {
+  DRAKE_THROW_UNLESS(0 <= chunk && chunk < num_chunks());
+  const Chunk& c = chunks_[chunk];
+  return ChunkData(c.values + c.num_samples, input_size_, c.num_samples);
+}
+
+double SignalLogFileReader::sample_time(int64_t index) const {
+  DRAKE_THROW_UNLESS(0 <= index && index < num_samples_);
+  const Chunk& c = chunks_[FindChunk(index)];
+  return c.values[index - c.start];
+}
+
+Eigen::VectorXd SignalLogFileReader::sample(int64_t index) const {
+  DRAKE_THROW_UNLESS(0 <= index && index < num_samples_);
+  const int chunk = FindChunk(index);
+  return chunk_data(chunk).col(index - chunks_[chunk].start);
+}
+
+int64_t SignalLogFileReader::FindFirstSampleAtOrAfter(double time) const {
+  // The first chunk whose last sample is at or after `time` holds the sample.
+  const auto chunk = std::partition_point(
+      chunks_.begin(), chunks_.end(),
+      [time](const Chunk& c) { return c.last_time < time; });
+  if (chunk == chunks_.end()) return num_samples_;
+  const double* const times = chunk->values;
+  return chunk->start +
+         (std::lower_bound(times, times + chunk->num_samples, time) - times);
+}
+
+void SignalLogFileReader::ReadSamples(double start_time, double end_time,
+                                      Eigen::VectorXd* sample_times,
+                                      Eigen::MatrixXd* data) const {
+  DRAKE_THROW_UNLESS(sample_times != nullptr);
+  DRAKE_THROW_UNLESS(data != nullptr);
+  const int64_t begin = FindFirstSampleAtOrAfter(start_time);
+  int64_t end = begin;
+  if (start_time <= end_time) {
+    // The samples at end_time are included, so search past them.
+    end = FindFirstSampleAtOrAfter(
+        std::nextafter(end_time, std::numeric_limits<double>::infinity()));
+  }
+  const int64_t count = end - begin;
+  sample_times->resize(count);
+  data->resize(input_size_, count);
+  int64_t index = begin;
+  while (index < end) {
+    const int chunk = FindChunk(index);
+    const Chunk& c = chunks_[chunk];
+    const int64_t first = index - c.start;
+    const int64_t n = std::min(end, c.start + c.num_samples) - index;
+    sample_times->segment(index - begin, n) =
+        chunk_sample_times(chunk).segment(first, n);
+    data->middleCols(index - begin, n) = chunk_data(chunk).middleCols(first, n);
+    index += n;
+  }
+}
+
+int SignalLogFileReader::FindChunk(int64_t index) const {
+  DRAKE_ASSERT(0 <= index && index < num_samples_);
+  const auto chunk = std::upper_bound(
+      chunks_.begin(), chunks_.end(), index,
+      [](int64_t i, const Chunk& c) { return i < c.start; });
+  return static_cast<int>(chunk - chunks_.begin()) - 1;
+}
+
+}  // namespace systems
+}  // namespace drake
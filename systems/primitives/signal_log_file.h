@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace systems {
+
+/** Writes a signal log file, one sample at a time. A signal log file holds a
+ sequence of time-stamped vectors of a fixed size (such as the samples of a
+ SignalLog), so that a long-running simulation can log without keeping its
+ samples in memory; it is read by SignalLogFileReader.
+
+ Samples are buffered in memory until a chunk is full, so that the memory used
+ is bounded by the chunk size no matter how many samples are written. The file
+ is complete (and can be read) only once Close() has been called.
+
+ The file consists of a header, the chunks of samples, an index of the chunks,
+ and a footer:
+ - The header holds the 8-byte magic string `DRKSLOG1`, the (uint32) format
+   version, the (uint32) size of the logged vectors, and the (uint64) maximum
+   number of samples per chunk.
+ - A chunk of `n` samples is stored by column: the `n` sample times, followed
+   by the `n` values of element 0 of the logged vectors, then those of element
+   1, and so on.
+ - The index holds, for each chunk, its (uint64) offset in the file, its
+   (uint64) number of samples, and its first and last sample times.
+ - The footer holds the (uint64) offset of the index, the (uint64) number of
+   chunks, the (uint64) total number of samples, and the magic string again.
+
+ All values are stored as doubles or unsigned integers in the native byte
+ order of the writer; every record is a multiple of 8 bytes in size so that all
+ values are naturally aligned within a memory-mapped file. The sample times are
+ non-decreasing, so that a sample may be found by time in O(log n).  */
+class SignalLogFileWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SignalLogFileWriter)
+
+  /** Creates (or truncates) the file `filename` to hold samples of size
+   `input_size`, written in chunks of up to `chunk_size` samples.
+   @throws std::exception if the file cannot be opened for writing.
+   @pre input_size > 0 and chunk_size > 0.  */
+  SignalLogFileWriter(const std::string& filename, int input_size,
+                      int chunk_size = 4096);
+
+  /** Closes the file, if it has not already been closed. Errors are logged,
+   rather than thrown; call Close() to detect them.  */
+  ~SignalLogFileWriter();
+
+  /** Appends a `sample` with the associated `time` value.
+   @throws std::exception if the file has been closed, if `time` precedes
+   the time of the previous sample, or if the file cannot be written.
+   @pre sample.size() == get_input_size().  */
+  void AddSample(double time, const Eigen::Ref<const Eigen::VectorXd>& sample);
+
+  /** Writes any buffered samples and the index, and closes the file. Does
+   nothing if the file has already been closed.
+   @throws std::exception if the file cannot be written.  */
+  void Close();
+
+  /** Returns true iff Close() has not been called.  */
+  bool is_open() const { return is_open_; }
+
+  /** Returns the number of samples added.  */
+  int64_t num_samples() const { return num_samples_; }
+
+  /** Reports the size of the logged vectors.  */
+  int get_input_size() const { return input_size_; }
+
+  /** Returns the name of the file.  */
+  const std::string& filename() const { return filename_; }
+
+ private:
+  struct ChunkIndexEntry {
+    uint64_t offset;
+    uint64_t num_samples;
+    double first_time;
+    double last_time;
+  };
+
+  // Writes the buffered samples (if any) as a chunk.
+  void WriteChunk();
+
+  // Writes `size` bytes at `data`, or throws.
+  void Write(const void* data, size_t size);
+
+  const std::string filename_;
+  const int input_size_;
+  const int chunk_size_;
+  std::ofstream output_;
+  bool is_open_{true};
+  uint64_t offset_{0};
+  int64_t num_samples_{0};
+  double last_time_{};
+
+  // The buffered samples, laid out as their chunk will be in the file: column
+  // 0 holds the times, and column 1 + i holds element i of the samples.
+  Eigen::MatrixXd buffer_;
+  int num_buffered_{0};
+  std::vector<ChunkIndexEntry> index_;
+};
+
+/** Reads a signal log file written by SignalLogFileWriter. The file is
+ memory-mapped, so that opening it reads only its index, and only the parts of
+ it that are accessed are read from disk. The samples are presented
+ chunk by chunk without copying, or may be copied by index or by time.  */
+class SignalLogFileReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SignalLogFileReader)
+
+  /** The samples of one chunk, as a (input size)-by-(number of samples) view
+   whose columns are samples, as in SignalLog::data().  */
+  using ChunkData = Eigen::Map<const Eigen::Matrix<
+      double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+  /** Maps the file `filename`.
+   @throws std::exception if the file cannot be read or is not a complete
+   signal log file.  */
+  explicit SignalLogFileReader(const std::string& filename);
+
+  ~SignalLogFileReader();
+
+  /** Returns the total number of samples.  */
+  int64_t num_samples() const { return num_samples_; }
+
+  /** Reports the size of the logged vectors.  */
+  int get_input_size() const { return input_size_; }
+
+  /** Returns the number of chunks.  */
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  /** Returns the index of the first sample of chunk `chunk`.
+   @throws std::exception unless 0 <= chunk < num_chunks().  */
+  int64_t chunk_start(int chunk) const;
+
+  /** Returns the sample times of chunk `chunk`, without copying.
+   @throws std::exception unless 0 <= chunk < num_chunks().  */
+  Eigen::Map<const Eigen::VectorXd> chunk_sample_times(int chunk) const;
+
+  /** Returns the samples of chunk `chunk`, without copying.
+   @throws std::exception unless 0 <= chunk < num_chunks().  */
+  ChunkData chunk_data(int chunk) const;
+
+  /** Returns the time of sample `index`.
+   @throws std::exception unless 0 <= index < num_samples().  */
+  double sample_time(int64_t index) const;
+
+  /** Returns sample `index`.
+   @throws std::exception unless 0 <= index < num_samples().  */
+  Eigen::VectorXd sample(int64_t index) const;
+
+  /** Returns the index of the first sample whose time is not less than
+   `time`, or num_samples() if there is no such sample. This takes
+   O(log(num_samples())) time.  */
+  int64_t FindFirstSampleAtOrAfter(double time) const;
+
+  /** Copies the samples whose times lie in [start_time, end_time] into
+   `sample_times` and the columns of `data`, which are resized as needed.
+   @pre sample_times and data are not null.  */
+  void ReadSamples(double start_time, double end_time,
+                   Eigen::VectorXd* sample_times,
+                   Eigen::MatrixXd* data) const;
+
+ private:
+  struct Chunk {
+    int64_t start;
+    int64_t num_samples;
+    double first_time;
+    double last_time;
+    const double* values;
+  };
+
+  // Returns the index of the chunk that holds sample `index`.
+  int FindChunk(int64_t index) const;
+
+  void* mapped_{nullptr};
+  size_t mapped_size_{0};
+  int input_size_{0};
+  int64_t num_samples_{0};
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace systems
+}  // namespace drake
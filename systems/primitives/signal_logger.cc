@@ -18,12 +18,17 @@ SignalLogger<T>::SignalLogger(int input_size, int batch_allocation_size)
 }
 
 // The scalar-converting copy constructor should return a result whose logging
-// mode matches whatever set_publish_period / set_forced_publish_only calls the
-// user has made on `other`.
+// mode and sample limit match whatever set_publish_period /
+// set_forced_publish_only / set_max_samples calls the user has made on
+// `other`.
 template <typename T>
 template <typename U>
 SignalLogger<T>::SignalLogger(const SignalLogger<U>& other)
     : SignalLogger<T>(other.get_input_port().size()) {
+  // The converted logger does not stream to the file of `other`.
+  if (other.log_.max_samples().has_value()) {
+    log_.set_max_samples(*other.log_.max_samples());
+  }
   switch (static_cast<LoggingMode>(other.logging_mode_)) {
     case kPeriodic: {
       const auto& events = other.GetPeriodicEvents();
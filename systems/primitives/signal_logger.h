@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -23,6 +25,11 @@ namespace systems {
 /// where each column corresponds to a data point. It saves a data point and
 /// the context time whenever it samples its input.
 ///
+/// For long simulations, the memory used by the logger may be bounded by
+/// keeping only the most recent samples (see set_max_samples()), and every
+/// sample may additionally be streamed to a file (see StreamToFile()); see
+/// SignalLog.
+///
 /// By default, sampling is performed every time the Simulator completes a
 /// trajectory-advancing substep (that is, via a per-step Publish event), with
 /// the first sample occurring during Simulator::Initialize(). That means the
@@ -59,15 +66,11 @@ class SignalLogger final : public LeafSystem<T> {
 
   /// Constructs the signal logger system.
   ///
-  /// @warning %SignalLogger may become slower and slower as the number of
-  /// log entries increases due to memory reallocations. You can avoid that by
-  /// providing a `batch_allocation_size` comparable to the total expected
-  /// number of log entries for your simulation.
-  ///
   /// @param input_size Dimension of the (single) input port. This corresponds
   /// to the number of rows of the data matrix.
-  /// @param batch_allocation_size Storage is (re)allocated in blocks of
-  /// input_size-by-batch_allocation_size.
+  /// @param batch_allocation_size Storage is initially allocated for
+  /// batch_allocation_size samples, and its size is doubled whenever it is
+  /// full.
   /// @see LogOutput() helper function for a convenient way to add %logging.
   explicit SignalLogger(int input_size, int batch_allocation_size = 1000);
 
@@ -105,9 +108,27 @@ class SignalLogger final : public LeafSystem<T> {
     return log_.data();
   }
 
-  /// Clears the logged data.
+  /// Clears the logged data, and completes the file that the logger is
+  /// streaming to, if any.
   void reset() { log_.reset(); }
 
+  /// Keeps only the most recent `max_samples` samples in memory. See
+  /// SignalLog::set_max_samples().
+  void set_max_samples(int max_samples) { log_.set_max_samples(max_samples); }
+
+  /// Returns the limit on the number of samples kept in memory, if any.
+  std::optional<int> max_samples() const { return log_.max_samples(); }
+
+  /// Streams the samples logged from now on to the signal log file `filename`.
+  /// See SignalLog::StreamToFile().
+  void StreamToFile(const std::string& filename, int chunk_size = 4096) {
+    log_.StreamToFile(filename, chunk_size);
+  }
+
+  /// Completes the file that the logger is streaming to, if any. See
+  /// SignalLog::CloseFile().
+  void CloseFile() { log_.CloseFile(); }
+
  private:
   template <typename> friend class SignalLogger;
 
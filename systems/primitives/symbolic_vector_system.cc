@@ -9,7 +9,6 @@ namespace drake {
 namespace systems {
 
 using Eigen::Ref;
-using symbolic::Environment;
 using symbolic::Expression;
 using symbolic::Jacobian;
 using symbolic::Substitution;
@@ -144,20 +143,24 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
                                   &SymbolicVectorSystem<T>::CalcOutput);
   }
 
-  // Initialize Jacobian matrices iff T == AutoDiffXd.
-  if (std::is_same<T, AutoDiffXd>::value) {
+  // Compile the dynamics and output, together with their Jacobians iff
+  // T == AutoDiffXd. (T == Expression substitutes into them instead.)
+  if (!std::is_same<T, Expression>::value) {
+    auto compile = [&vars_vec](const VectorX<Expression>& f) {
+      if (std::is_same<T, AutoDiffXd>::value) {
+        MatrixX<Expression> f_and_jacobian(f.size(), 1 + vars_vec.size());
+        f_and_jacobian << f, Jacobian(f, vars_vec);
+        return symbolic::CompiledExpression(f_and_jacobian, vars_vec);
+      }
+      return symbolic::CompiledExpression(f, vars_vec);
+    };
     if (dynamics_.size() > 0) {
-      dynamics_jacobian_ = Jacobian(dynamics_, vars_vec);
+      dynamics_program_ = compile(dynamics_);
     }
     if (output_.size() > 0) {
-      output_jacobian_ = Jacobian(output_, vars_vec);
+      output_program_ = compile(output_);
     }
   }
-
-  // Allocate a symbolic::Environment once to be cloned/reused below.
-  for (const auto& v : all_vars) {
-    env_.insert(v, 0.0);
-  }
 }
 
 template <typename T>
@@ -211,121 +214,87 @@ void SymbolicVectorSystem<T>::PopulateFromContext(const Context<T>& context,
   }
 }
 
+template <typename T>
+void SymbolicVectorSystem<T>::PopulateVectorFromContext(
+    const Context<T>& context, bool needs_inputs, VectorX<T>* values) const {
+  values->setZero(state_vars_.size() + input_vars_.size() +
+                  parameter_vars_.size() + (time_var_ ? 1 : 0));
+  int index = 0;
+  if (state_vars_.size() > 0) {
+    const VectorBase<T>& state = (time_period_ > 0.0)
+                                     ? context.get_discrete_state_vector()
+                                     : context.get_continuous_state_vector();
+    for (int i = 0; i < state_vars_.size(); i++) {
+      (*values)[index++] = state[i];
+    }
+  }
+  // It is very important we don't evaluate the inputs if the expression doesn't
+  // actually depend on it (as declared by the needs_inputs parameter). This
+  // avoids introducing spurious algebraic loops.
+  if (input_vars_.size() > 0 && needs_inputs) {
+    const auto& input = this->get_input_port().Eval(context);
+    for (int i = 0; i < input_vars_.size(); i++) {
+      (*values)[index + i] = input[i];
+    }
+  }
+  index += input_vars_.size();
+  if (parameter_vars_.size() > 0) {
+    const auto& parameter = context.get_numeric_parameter(0);
+    for (int i = 0; i < parameter_vars_.size(); i++) {
+      (*values)[index++] = parameter[i];
+    }
+  }
+  if (time_var_) {
+    (*values)[index] = context.get_time();
+  }
+}
+
 // TODO(eric.cousineau): Consider decoupling output from `VectorBase` and use
 // `EigenPtr` or something.
 
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::CompiledExpression& program,
     bool needs_inputs, VectorBase<double>* out) const {
-  unused(jacobian);
-  Environment env = env_;
-  PopulateFromContext(context, needs_inputs, &env);
-  for (int i = 0; i < out->size(); i++) {
-    out->SetAtIndex(i, expr[i].Evaluate(env));
-  }
+  unused(expr);
+  Eigen::VectorXd values;
+  PopulateVectorFromContext(context, needs_inputs, &values);
+  Eigen::MatrixXd result;
+  program.Eval(values, &result);
+  out->SetFromVector(result.col(0));
 }
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::CompiledExpression& program,
     bool needs_inputs, VectorBase<AutoDiffXd>* pout) const {
+  unused(expr);
   VectorBase<AutoDiffXd>& out = *pout;
 
-  const BasicVector<AutoDiffXd> empty(0);
-  const AutoDiffXd& time = context.get_time();
-  const VectorBase<AutoDiffXd>& state =
-      (state_vars_.size() > 0)
-          ? ((time_period_ > 0.0) ? context.get_discrete_state_vector()
-                                  : context.get_continuous_state_vector())
-          : empty;
-  // It is very important we don't evaluate the inputs if the expression doesn't
-  // actually depend on it (as declared by the needs_inputs parameter). This
-  // avoids introducing spurious algebraic loops. In this case, `needs_inputs`
-  // is sufficient to know that there are input variables; we don't need to
-  // test the size of input_vars_.
-  const BasicVector<AutoDiffXd>& input =
-      needs_inputs
-          ? get_input_port().Eval<BasicVector<AutoDiffXd>>(context)
-          : empty;
-
-  const BasicVector<AutoDiffXd>& parameter =
-      (parameter_vars_.size() > 0) ? context.get_numeric_parameter(0) : empty;
-
-  // Figure out the length of the derivative vector.  The derivatives must all
-  // have size zero or the same non-zero size.
-  int num_gradients = time.derivatives().size();
-  auto set_num_gradients = [&num_gradients](
-                               const VectorBase<AutoDiffXd>& vars) {
-    for (int i = 0; i < vars.size(); i++) {
-      if (vars[i].derivatives().size()) {
-        if (num_gradients == 0) {
-          num_gradients = static_cast<int>(vars[i].derivatives().size());
-        } else {
-          DRAKE_DEMAND(static_cast<int>(vars[i].derivatives().size()) ==
-                       num_gradients);
-        }
-      }
-    }
-  };
-  set_num_gradients(state);
-  if (needs_inputs) {
-    set_num_gradients(input);
-  }
-  set_num_gradients(parameter);
-
-  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(jacobian.cols(), num_gradients);
-  Environment env = env_;
-  if (time_var_) {
-    env[*time_var_] = time.value();
-    if (time.derivatives().size()) {
-      dvars.bottomRows<1>() = time.derivatives();
-    }
-  }
-  size_t dvars_row_idx = 0;
-  for (int i = 0; i < state_vars_.size(); i++, dvars_row_idx++) {
-    env[state_vars_[i]] = state[i].value();
-    if (state[i].derivatives().size()) {
-      dvars.row(dvars_row_idx) = state[i].derivatives();
-    }
-  }
-  if (needs_inputs) {
-    for (int i = 0; i < input_vars_.size(); i++, dvars_row_idx++) {
-      env[input_vars_[i]] = input[i].value();
-      if (input[i].derivatives().size()) {
-        dvars.row(dvars_row_idx) = input[i].derivatives();
-      }
-    }
-  } else {
-    dvars_row_idx += input_vars_.size();
-  }
-  for (int i = 0; i < parameter_vars_.size(); i++, dvars_row_idx++) {
-    env[parameter_vars_[i]] = parameter[i].value();
-    if (parameter[i].derivatives().size()) {
-      dvars.row(dvars_row_idx) = parameter[i].derivatives();
-    }
-  }
+  VectorX<AutoDiffXd> values;
+  PopulateVectorFromContext(context, needs_inputs, &values);
+  // The derivatives must all have size zero or the same non-zero size.
+  const Eigen::MatrixXd dvars = math::autoDiffToGradientMatrix(values);
 
-  // Now actually compute the output values and derivatives.
-  Eigen::RowVectorXd dout_dvars(jacobian.cols());
+  // Now actually compute the output values and derivatives; the first column
+  // of `result` holds the values and the others the Jacobian.
+  Eigen::MatrixXd result;
+  program.Eval(math::autoDiffToValueMatrix(values), &result);
+  const Eigen::MatrixXd dout = result.rightCols(values.size()) * dvars;
   for (int i = 0; i < out.size(); i++) {
-    out[i].value() = expr[i].Evaluate(env);
-
-    for (int j = 0; j < jacobian.cols(); j++) {
-      dout_dvars(j) = jacobian(i, j).Evaluate(env);
-    }
-    out[i].derivatives() = dout_dvars * dvars;
+    out[i].value() = result(i, 0);
+    out[i].derivatives() = dout.row(i).transpose();
   }
 }
 
 template <>
 void SymbolicVectorSystem<Expression>::EvaluateWithContext(
     const Context<Expression>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian,
+    const symbolic::CompiledExpression& program,
     bool needs_inputs, VectorBase<Expression>* out) const {
-  unused(jacobian);
+  unused(program);
   Substitution s;
   PopulateFromContext(context, needs_inputs, &s);
   for (int i = 0; i < out->size(); i++) {
@@ -337,7 +306,7 @@ template <typename T>
 void SymbolicVectorSystem<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* output_vector) const {
   DRAKE_DEMAND(output_.size() > 0);
-  EvaluateWithContext(context, output_, output_jacobian_, output_needs_inputs_,
+  EvaluateWithContext(context, output_, output_program_, output_needs_inputs_,
                       output_vector);
 }
 
@@ -346,7 +315,7 @@ void SymbolicVectorSystem<T>::DoCalcTimeDerivatives(
     const Context<T>& context, ContinuousState<T>* derivatives) const {
   DRAKE_DEMAND(time_period_ == 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_program_,
                       dynamics_needs_inputs_,
                       &derivatives->get_mutable_vector());
 }
@@ -359,7 +328,7 @@ void SymbolicVectorSystem<T>::DoCalcDiscreteVariableUpdates(
   unused(events);
   DRAKE_DEMAND(time_period_ > 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_program_,
                       dynamics_needs_inputs_, &updates->get_mutable_vector());
 }
 
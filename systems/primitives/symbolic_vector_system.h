@@ -173,10 +173,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   void PopulateFromContext(const Context<T>& context, bool needs_inputs,
                            Container* penv) const;
 
+  // Copies the values of time, state, inputs (iff needs_inputs), and
+  // parameters in the context to `values`, in the order of the variables of
+  // the compiled programs below. Unused inputs are set to zero.
+  void PopulateVectorFromContext(const Context<T>& context, bool needs_inputs,
+                                 VectorX<T>* values) const;
+
   // Evaluate context to a vector.
   void EvaluateWithContext(const Context<T>& context,
                            const VectorX<symbolic::Expression>& expr,
-                           const MatrixX<symbolic::Expression>& jacobian,
+                           const symbolic::CompiledExpression& program,
                            bool needs_inputs, VectorBase<T>* out) const;
 
   void CalcOutput(const Context<T>& context,
@@ -199,14 +205,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   const bool dynamics_needs_inputs_;
   const bool output_needs_inputs_;
 
-  symbolic::Environment env_{};
   const double time_period_{0.0};
 
   std::unordered_map<symbolic::Variable::Id, int> state_var_to_index_;
 
-  // Storage for Jacobians (empty unless T == AutoDiffXd).
-  MatrixX<symbolic::Expression> dynamics_jacobian_{};
-  MatrixX<symbolic::Expression> output_jacobian_{};
+  // The dynamics and output compiled as functions of the state, input,
+  // parameter, and time variables (in that order), followed, iff
+  // T == AutoDiffXd, by their Jacobians with respect to those variables.
+  // Unused when T == symbolic::Expression.
+  symbolic::CompiledExpression dynamics_program_{};
+  symbolic::CompiledExpression output_program_{};
 
   template <typename U>
   friend class SymbolicVectorSystem;
@@ -417,21 +425,21 @@ class SymbolicVectorSystemBuilder {
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpression& program, bool needs_inputs,
     VectorBase<double>* out) const;
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpression& program, bool needs_inputs,
     VectorBase<AutoDiffXd>* out) const;
 
 template <>
 void SymbolicVectorSystem<symbolic::Expression>::EvaluateWithContext(
     const Context<symbolic::Expression>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::CompiledExpression& program, bool needs_inputs,
     VectorBase<symbolic::Expression>* out) const;
 #endif
 
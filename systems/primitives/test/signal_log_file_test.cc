@@ -0,0 +1,140 @@
+#include "drake/systems/primitives/signal_log_file.h"
+
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// Returns the value of element i of the sample at time t.
+double Value(int i, double t) { return 10 * i + t; }
+
+class SignalLogFileTest : public ::testing::Test {
+ protected:
+  // Writes 10 samples of size 2 at times 0, 1, 2, 2, 4, ..., 9, in chunks of
+  // 4 samples (so that the last chunk is partial).
+  void WriteFile() {
+    SignalLogFileWriter writer(filename_, 2, 4);
+    EXPECT_TRUE(writer.is_open());
+    for (int k = 0; k < 10; ++k) {
+      const double t = (k == 3) ? 2 : k;
+      writer.AddSample(t, Vector2d(Value(0, t), Value(1, t)));
+    }
+    EXPECT_EQ(writer.num_samples(), 10);
+    writer.Close();
+    EXPECT_FALSE(writer.is_open());
+  }
+
+  const std::string filename_{temp_directory() + "/signal_log.bin"};
+};
+
+TEST_F(SignalLogFileTest, ReadByIndex) {
+  WriteFile();
+  const SignalLogFileReader reader(filename_);
+  EXPECT_EQ(reader.num_samples(), 10);
+  EXPECT_EQ(reader.get_input_size(), 2);
+  ASSERT_EQ(reader.num_chunks(), 3);
+  EXPECT_EQ(reader.chunk_start(2), 8);
+  for (int k = 0; k < 10; ++k) {
+    const double t = (k == 3) ? 2 : k;
+    EXPECT_EQ(reader.sample_time(k), t);
+    EXPECT_TRUE(
+        CompareMatrices(reader.sample(k), Vector2d(Value(0, t), Value(1, t))));
+  }
+
+  // The chunks are viewed in place, with one sample per column.
+  EXPECT_TRUE(CompareMatrices(reader.chunk_sample_times(2), Vector2d(8, 9)));
+  MatrixXd expected_data(2, 2);
+  expected_data << Value(0, 8), Value(0, 9), Value(1, 8), Value(1, 9);
+  EXPECT_TRUE(CompareMatrices(reader.chunk_data(2), expected_data));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(reader.sample(10), std::exception, ".*");
+  DRAKE_EXPECT_THROWS_MESSAGE(reader.chunk_data(3), std::exception, ".*");
+}
+
+TEST_F(SignalLogFileTest, ReadByTime) {
+  WriteFile();
+  const SignalLogFileReader reader(filename_);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(-1), 0);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(2), 2);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(2.5), 4);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(3.5), 4);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(8), 8);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(9.5), 10);
+
+  // The range spans all three chunks, and includes both of its end points.
+  VectorXd times;
+  MatrixXd data;
+  reader.ReadSamples(2, 8, &times, &data);
+  VectorXd expected_times(7);
+  expected_times << 2, 2, 4, 5, 6, 7, 8;
+  EXPECT_TRUE(CompareMatrices(times, expected_times));
+  ASSERT_EQ(data.cols(), 7);
+  for (int k = 0; k < 7; ++k) {
+    EXPECT_EQ(data(1, k), Value(1, expected_times(k)));
+  }
+
+  reader.ReadSamples(2.5, 3.5, &times, &data);
+  EXPECT_EQ(times.size(), 0);
+  EXPECT_EQ(data.rows(), 2);
+  EXPECT_EQ(data.cols(), 0);
+}
+
+TEST_F(SignalLogFileTest, EmptyFile) {
+  SignalLogFileWriter(filename_, 3).Close();
+  const SignalLogFileReader reader(filename_);
+  EXPECT_EQ(reader.num_samples(), 0);
+  EXPECT_EQ(reader.get_input_size(), 3);
+  EXPECT_EQ(reader.num_chunks(), 0);
+  EXPECT_EQ(reader.FindFirstSampleAtOrAfter(0), 0);
+}
+
+TEST_F(SignalLogFileTest, WriterErrors) {
+  {
+    SignalLogFileWriter writer(filename_, 1);
+    writer.AddSample(1, Vector1d(0));
+    DRAKE_EXPECT_THROWS_MESSAGE(writer.AddSample(0.5, Vector1d(0)),
+                                std::exception, ".*precedes.*");
+    writer.Close();
+    DRAKE_EXPECT_THROWS_MESSAGE(writer.AddSample(2, Vector1d(0)),
+                                std::exception, ".*closed.*");
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignalLogFileWriter("/no/such/directory/log.bin", 1), std::exception,
+      ".*cannot open.*");
+}
+
+TEST_F(SignalLogFileTest, ReaderErrors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(SignalLogFileReader(filename_ + ".missing"),
+                              std::exception, ".*cannot be opened.*");
+
+  // A file whose writer has not been closed is incomplete.
+  {
+    SignalLogFileWriter writer(filename_, 1, 1);
+    for (int k = 0; k < 10; ++k) writer.AddSample(k, Vector1d(k));
+    DRAKE_EXPECT_THROWS_MESSAGE(SignalLogFileReader{filename_},
+                                std::exception, ".*(incomplete|truncated).*");
+  }
+
+  {
+    std::ofstream output(filename_, std::ios::trunc);
+    output << "This is not a signal log file, but it is long enough to be.";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(SignalLogFileReader{filename_}, std::exception,
+                              ".*not a signal log file.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,125 @@
+#include "drake/systems/primitives/signal_log.h"
+
+#include <algorithm>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// Returns the sample at time t.
+Vector2d Sample(double t) { return Vector2d(t, -2 * t); }
+
+// Returns the expected sample times and data of a log that has kept the
+// samples at times first, ..., last.
+VectorXd ExpectedTimes(int first, int last) {
+  return VectorXd::LinSpaced(last - first + 1, first, last);
+}
+MatrixXd ExpectedData(int first, int last) {
+  MatrixXd data(2, last - first + 1);
+  for (int t = first; t <= last; ++t) data.col(t - first) = Sample(t);
+  return data;
+}
+
+// The storage grows beyond the batch allocation size as needed.
+GTEST_TEST(SignalLogTest, Unbounded) {
+  SignalLog<double> log(2, 3);
+  EXPECT_FALSE(log.max_samples().has_value());
+  for (int t = 0; t < 100; ++t) log.AddData(t, Sample(t));
+  EXPECT_EQ(log.num_samples(), 100);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), ExpectedTimes(0, 99)));
+  EXPECT_TRUE(CompareMatrices(log.data(), ExpectedData(0, 99)));
+
+  // A sample with an earlier time replaces the most recent sample.
+  log.AddData(50.5, Sample(50.5));
+  EXPECT_EQ(log.num_samples(), 100);
+  EXPECT_EQ(log.sample_times()(99), 50.5);
+
+  log.reset();
+  EXPECT_EQ(log.num_samples(), 0);
+  log.AddData(1, Sample(1));
+  EXPECT_TRUE(CompareMatrices(log.data(), ExpectedData(1, 1)));
+}
+
+// Only the most recent samples are kept, across the moves and growth of the
+// storage.
+GTEST_TEST(SignalLogTest, Bounded) {
+  SignalLog<double> log(2, 1);
+  log.set_max_samples(5);
+  EXPECT_EQ(log.max_samples(), 5);
+  for (int t = 0; t < 100; ++t) {
+    log.AddData(t, Sample(t));
+    const int first = std::max(0, t - 4);
+    ASSERT_EQ(log.num_samples(), t - first + 1);
+    ASSERT_TRUE(CompareMatrices(log.sample_times(), ExpectedTimes(first, t)));
+    ASSERT_TRUE(CompareMatrices(log.data(), ExpectedData(first, t)));
+  }
+
+  // Reducing the bound discards the oldest samples at once.
+  log.set_max_samples(2);
+  EXPECT_TRUE(CompareMatrices(log.sample_times(), ExpectedTimes(98, 99)));
+  EXPECT_TRUE(CompareMatrices(log.data(), ExpectedData(98, 99)));
+  log.AddData(100, Sample(100));
+  EXPECT_TRUE(CompareMatrices(log.data(), ExpectedData(99, 100)));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(log.set_max_samples(0), std::exception, ".*");
+}
+
+// Every sample is streamed to the file, even those no longer kept in memory.
+GTEST_TEST(SignalLogTest, StreamToFile) {
+  const std::string filename = temp_directory() + "/signal_log_stream.bin";
+  SignalLog<AutoDiffXd> log(2);
+  log.set_max_samples(3);
+  log.StreamToFile(filename, 4);
+  EXPECT_TRUE(log.is_streaming_to_file());
+  for (int t = 0; t < 20; ++t) {
+    log.AddData(t, Sample(t).cast<AutoDiffXd>());
+  }
+  // The sample at time 18.5 replaces the sample at time 19.
+  log.AddData(18.5, Sample(18.5).cast<AutoDiffXd>());
+  log.CloseFile();
+  EXPECT_FALSE(log.is_streaming_to_file());
+  // Samples added after the file is closed are only kept in memory.
+  log.AddData(30, Sample(30).cast<AutoDiffXd>());
+  EXPECT_EQ(log.num_samples(), 3);
+
+  const SignalLogFileReader reader(filename);
+  ASSERT_EQ(reader.num_samples(), 20);
+  for (int k = 0; k < 20; ++k) {
+    const double t = (k == 19) ? 18.5 : k;
+    EXPECT_EQ(reader.sample_time(k), t);
+    EXPECT_TRUE(CompareMatrices(reader.sample(k), Sample(t)));
+  }
+}
+
+GTEST_TEST(SignalLogTest, StreamToFileErrors) {
+  const std::string filename = temp_directory() + "/signal_log_error.bin";
+  SignalLog<double> log(1);
+  log.StreamToFile(filename);
+  log.AddData(1, Vector1d(1));
+  log.AddData(2, Vector1d(2));
+  // The sample at time 0 replaces the sample at time 2 in memory, but cannot
+  // follow the sample at time 1 in the file.
+  log.AddData(0, Vector1d(0));
+  DRAKE_EXPECT_THROWS_MESSAGE(log.AddData(3, Vector1d(3)), std::exception,
+                              ".*precedes.*");
+  // Resetting the log closes the file.
+  log.reset();
+  EXPECT_FALSE(log.is_streaming_to_file());
+  EXPECT_EQ(SignalLogFileReader(filename).num_samples(), 1);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -2,10 +2,12 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <string>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -158,6 +160,37 @@ GTEST_TEST(TestSignalLogger, ScalarConversion) {
   }
 }
 
+// Test that a bounded logger keeps only its most recent samples in memory,
+// while streaming all of them to a file.
+GTEST_TEST(TestSignalLogger, BoundedAndStreamed) {
+  const std::string filename = temp_directory() + "/signal_logger.bin";
+  DiagramBuilder<double> builder;
+  auto system = builder.AddSystem<ConstantVectorSource<double>>(2.0);
+  auto logger = LogOutput(system->get_output_port(), &builder);
+  logger->set_publish_period(0.1);
+  logger->set_max_samples(3);
+  EXPECT_EQ(logger->max_samples(), 3);
+  logger->StreamToFile(filename);
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(1);
+  logger->CloseFile();
+
+  EXPECT_EQ(logger->num_samples(), 3);
+  EXPECT_TRUE(CompareMatrices(logger->sample_times(),
+                              Eigen::Vector3d(0.8, 0.9, 1.0), 1e-14));
+  const SignalLogFileReader reader(filename);
+  EXPECT_EQ(reader.num_samples(), 11);
+  EXPECT_EQ(reader.sample_time(0), 0.0);
+  EXPECT_EQ(reader.sample(10)(0), 2.0);
+
+  // The limit is preserved by scalar conversion.
+  EXPECT_TRUE(is_autodiffxd_convertible(*logger, [&](const auto& converted) {
+    EXPECT_EQ(converted.max_samples(), 3);
+  }));
+}
+
 GTEST_TEST(TestSignalLogger, DiagramToAutoDiff) {
   DiagramBuilder<double> builder;
   auto system = builder.AddSystem<ConstantVectorSource<double>>(2.0);
@@ -1,10 +1,12 @@
 #include "drake/systems/primitives/trajectory_source.h"
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
 
 namespace drake {
 namespace systems {
 
+using trajectories::PiecewisePolynomial;
 using trajectories::Trajectory;
 
 template <typename T>
@@ -21,6 +23,13 @@ TrajectorySource<T>::TrajectorySource(const Trajectory<T>& trajectory,
   DRAKE_DEMAND(trajectory.cols() == 1);
   DRAKE_DEMAND(output_derivative_order >= 0);
 
+  // Piecewise polynomials are evaluated much faster once compiled; their
+  // derivatives are then compiled as well.
+  if (auto* polynomial =
+          dynamic_cast<PiecewisePolynomial<T>*>(trajectory_.get())) {
+    polynomial->Compile();
+  }
+
   for (int i = 0; i < output_derivative_order; i++) {
     if (i == 0)
       derivatives_.push_back(trajectory_->MakeDerivative());
@@ -0,0 +1,158 @@
+#include "drake/systems/sensors/multi_camera_rgbd_sensor.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/scene_graph.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::render::RenderImageRequest;
+using math::RigidTransformd;
+
+MultiCameraRgbdSensor::MultiCameraRgbdSensor(std::vector<Camera> cameras)
+    : cameras_(std::move(cameras)) {
+  query_object_input_port_ = &this->DeclareAbstractInputPort(
+      "geometry_query", Value<geometry::QueryObject<double>>{});
+
+  images_cache_entry_ = &this->DeclareCacheEntry(
+      "images", &MultiCameraRgbdSensor::MakeImages,
+      &MultiCameraRgbdSensor::CalcImages,
+      {query_object_input_port_->ticket()});
+
+  for (int i = 0; i < num_cameras(); ++i) {
+    const CameraInfo& color_intrinsics =
+        cameras_[i].color_camera.core().intrinsics();
+    const CameraInfo& depth_intrinsics =
+        cameras_[i].depth_camera.core().intrinsics();
+    const std::string suffix = "_" + std::to_string(i);
+
+    color_image_ports_.push_back(&this->DeclareAbstractOutputPort(
+        "color_image" + suffix,
+        [model = ImageRgba8U(color_intrinsics.width(),
+                             color_intrinsics.height())]() {
+          return AbstractValue::Make(model);
+        },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageRgba8U>() =
+              EvalImages(context).color[i];
+        },
+        {images_cache_entry_->ticket()}));
+
+    depth_image_32F_ports_.push_back(&this->DeclareAbstractOutputPort(
+        "depth_image_32f" + suffix,
+        [model = ImageDepth32F(depth_intrinsics.width(),
+                               depth_intrinsics.height())]() {
+          return AbstractValue::Make(model);
+        },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageDepth32F>() =
+              EvalImages(context).depth[i];
+        },
+        {images_cache_entry_->ticket()}));
+
+    label_image_ports_.push_back(&this->DeclareAbstractOutputPort(
+        "label_image" + suffix,
+        [model = ImageLabel16I(color_intrinsics.width(),
+                               color_intrinsics.height())]() {
+          return AbstractValue::Make(model);
+        },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          output->get_mutable_value<ImageLabel16I>() =
+              EvalImages(context).label[i];
+        },
+        {images_cache_entry_->ticket()}));
+  }
+}
+
+const MultiCameraRgbdSensor::Camera& MultiCameraRgbdSensor::camera(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return cameras_[i];
+}
+
+const InputPort<double>& MultiCameraRgbdSensor::query_object_input_port()
+    const {
+  return *query_object_input_port_;
+}
+
+const OutputPort<double>& MultiCameraRgbdSensor::color_image_output_port(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return *color_image_ports_[i];
+}
+
+const OutputPort<double>& MultiCameraRgbdSensor::depth_image_32F_output_port(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return *depth_image_32F_ports_[i];
+}
+
+const OutputPort<double>& MultiCameraRgbdSensor::label_image_output_port(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return *label_image_ports_[i];
+}
+
+MultiCameraRgbdSensor::Images MultiCameraRgbdSensor::MakeImages() const {
+  Images images;
+  for (const Camera& camera : cameras_) {
+    const CameraInfo& color_intrinsics =
+        camera.color_camera.core().intrinsics();
+    const CameraInfo& depth_intrinsics =
+        camera.depth_camera.core().intrinsics();
+    images.color.emplace_back(color_intrinsics.width(),
+                              color_intrinsics.height());
+    images.depth.emplace_back(depth_intrinsics.width(),
+                              depth_intrinsics.height());
+    images.label.emplace_back(color_intrinsics.width(),
+                              color_intrinsics.height());
+  }
+  return images;
+}
+
+void MultiCameraRgbdSensor::CalcImages(const Context<double>& context,
+                                       Images* images) const {
+  const QueryObject<double>& query_object =
+      query_object_input_port_->Eval<QueryObject<double>>(context);
+  std::vector<RenderImageRequest> requests;
+  requests.reserve(num_cameras());
+  for (int i = 0; i < num_cameras(); ++i) {
+    const Camera& camera = cameras_[i];
+    RigidTransformd X_WB = camera.X_PB;
+    if (camera.parent_id != SceneGraph<double>::world_frame_id()) {
+      X_WB = query_object.GetPoseInWorld(camera.parent_id) * camera.X_PB;
+    }
+    const RigidTransformd& X_BC =
+        camera.color_camera.core().sensor_pose_in_camera_body();
+    const RigidTransformd& X_BD =
+        camera.depth_camera.core().sensor_pose_in_camera_body();
+    if (X_BC.IsExactlyEqualTo(X_BD)) {
+      requests.push_back({X_WB * X_BC, camera.color_camera,
+                          camera.depth_camera, &images->color[i],
+                          &images->depth[i], &images->label[i]});
+    } else {
+      // The color and depth cameras are posed differently in the body.
+      requests.push_back({X_WB * X_BC, camera.color_camera, std::nullopt,
+                          &images->color[i], nullptr, &images->label[i]});
+      requests.push_back({X_WB * X_BD, std::nullopt, camera.depth_camera,
+                          nullptr, &images->depth[i], nullptr});
+    }
+  }
+  query_object.RenderImages(requests);
+}
+
+const MultiCameraRgbdSensor::Images& MultiCameraRgbdSensor::EvalImages(
+    const Context<double>& context) const {
+  return images_cache_entry_->Eval<Images>(context);
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
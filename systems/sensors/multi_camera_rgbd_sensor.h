@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/render/render_camera.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** A sensor that houses any number of RGB-D cameras -- each equivalent to an
+ RgbdSensor -- and renders all of their images at once.
+
+ Rendering the cameras of a robot with one RgbdSensor per camera renders each
+ image separately. This system instead passes all of its images to
+ geometry::QueryObject::RenderImages() in a single call, so that the poses of
+ the geometries are updated once for all of them and each
+ geometry::render::RenderEngine receives all of its cameras together; an engine
+ can then share work among the images (e.g., the engine made by
+ geometry::render::MakeRenderEngineRayCast() casts the rays of all of the
+ images in parallel, and the color, depth, and label images of a camera with
+ identical rays in a single pass).
+
+ All of the images are computed together the first time any of them is
+ evaluated, and are cached until the geometry_query input changes.
+
+ @system
+ name: MultiCameraRgbdSensor
+ input_ports:
+ - geometry_query
+ output_ports:
+ - color_image_0
+ - depth_image_32f_0
+ - label_image_0
+ - ...
+ - color_image_N-1
+ - depth_image_32f_N-1
+ - label_image_N-1
+ @endsystem
+
+ The frames and the image formats of each camera are those of RgbdSensor.  */
+class MultiCameraRgbdSensor final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultiCameraRgbdSensor)
+
+  /** The specification of one of the sensor's cameras; its members are the
+   arguments of the corresponding RgbdSensor constructor.  */
+  struct Camera {
+    /** The identifier of the frame `P` in geometry::SceneGraph to which the
+     camera is rigidly affixed.  */
+    geometry::FrameId parent_id;
+    /** The pose of the camera body frame `B` relative to the parent frame
+     `P`.  */
+    math::RigidTransformd X_PB;
+    geometry::render::ColorRenderCamera color_camera;
+    geometry::render::DepthRenderCamera depth_camera;
+  };
+
+  /** Constructs the sensor with the given cameras; the output ports of camera
+   `i` are suffixed with `_i`.  */
+  explicit MultiCameraRgbdSensor(std::vector<Camera> cameras);
+
+  /** Returns the number of cameras.  */
+  int num_cameras() const { return static_cast<int>(cameras_.size()); }
+
+  /** Returns the specification of camera `i`.
+   @throws std::exception unless 0 <= i < num_cameras().  */
+  const Camera& camera(int i) const;
+
+  /** Returns the geometry::QueryObject<double>-valued input port.  */
+  const InputPort<double>& query_object_input_port() const;
+
+  /** Returns the abstract-valued output port that contains the ImageRgba8U of
+   camera `i`.
+   @throws std::exception unless 0 <= i < num_cameras().  */
+  const OutputPort<double>& color_image_output_port(int i) const;
+
+  /** Returns the abstract-valued output port that contains the ImageDepth32F
+   of camera `i`.
+   @throws std::exception unless 0 <= i < num_cameras().  */
+  const OutputPort<double>& depth_image_32F_output_port(int i) const;
+
+  /** Returns the abstract-valued output port that contains the ImageLabel16I
+   of camera `i`.
+   @throws std::exception unless 0 <= i < num_cameras().  */
+  const OutputPort<double>& label_image_output_port(int i) const;
+
+ private:
+  // The images of all of the cameras, indexed by camera.
+  struct Images {
+    std::vector<ImageRgba8U> color;
+    std::vector<ImageDepth32F> depth;
+    std::vector<ImageLabel16I> label;
+  };
+
+  // Allocates the images of all of the cameras.
+  Images MakeImages() const;
+
+  // Renders the images of all of the cameras.
+  void CalcImages(const Context<double>& context, Images* images) const;
+
+  // Returns the (cached) images of all of the cameras.
+  const Images& EvalImages(const Context<double>& context) const;
+
+  const std::vector<Camera> cameras_;
+
+  const InputPort<double>* query_object_input_port_{};
+  const CacheEntry* images_cache_entry_{};
+  std::vector<const OutputPort<double>*> color_image_ports_;
+  std::vector<const OutputPort<double>*> depth_image_32F_ports_;
+  std::vector<const OutputPort<double>*> label_image_ports_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -28,6 +28,12 @@ namespace sensors {
 /** A meta-sensor that houses RGB, depth, and label cameras, producing their
  corresponding images based on the contents of the geometry::SceneGraph.
 
+ The images are rendered by the geometry::render::RenderEngine that was added
+ to the SceneGraph (see geometry::SceneGraph::AddRenderer()) under the
+ `renderer_name` of each camera. For example, the engine made by
+ geometry::render::MakeRenderEngineRayCast() renders on the CPU alone, for
+ machines without a GPU or a display.
+
  @system
  name: RgbdSensor
  input_ports:
@@ -0,0 +1,185 @@
+#include "drake/systems/sensors/multi_camera_rgbd_sensor.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/geometry_frame.h"
+#include "drake/geometry/geometry_state.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/test_utilities/dummy_render_engine.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace geometry {
+
+// Friend class provides access to the render engine in the GeometryState; the
+// engine in the *context* is a copy of the one registered with SceneGraph.
+template <class T>
+class GeometryStateTester {
+ public:
+  static const internal::DummyRenderEngine& GetDummyRenderEngine(
+      const systems::Context<T>& context, const std::string& name) {
+    // Technically brittle, but relatively safe assumption that GeometryState
+    // is abstract Parameter value 0.
+    auto& geo_state = context.get_parameters()
+                          .template get_abstract_parameter<GeometryState<T>>(0);
+    const render::RenderEngine& engine = geo_state.GetRenderEngineOrThrow(name);
+    return dynamic_cast<const internal::DummyRenderEngine&>(engine);
+  }
+};
+
+}  // namespace geometry
+
+namespace systems {
+namespace sensors {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using geometry::FramePoseVector;
+using geometry::GeometryFrame;
+using geometry::GeometryStateTester;
+using geometry::SceneGraph;
+using geometry::SourceId;
+using geometry::internal::DummyRenderEngine;
+using geometry::render::ColorRenderCamera;
+using geometry::render::DepthRenderCamera;
+using geometry::render::RenderCameraCore;
+using math::RigidTransformd;
+
+constexpr char kRendererName[] = "renderer";
+
+ColorRenderCamera MakeColorCamera(int width, int height) {
+  return ColorRenderCamera(
+      RenderCameraCore(kRendererName, {width, height, M_PI / 4}, {0.1, 10.0},
+                       {}),
+      false);
+}
+
+DepthRenderCamera MakeDepthCamera(int width, int height,
+                                  const RigidTransformd& X_BD = {}) {
+  return DepthRenderCamera(
+      RenderCameraCore(kRendererName, {width, height, M_PI / 6}, {0.1, 10.0},
+                       X_BD),
+      {0.1, 10.0});
+}
+
+GTEST_TEST(MultiCameraRgbdSensorTest, PortsAndCameras) {
+  const MultiCameraRgbdSensor sensor(
+      {{SceneGraph<double>::world_frame_id(), RigidTransformd(),
+        MakeColorCamera(4, 3), MakeDepthCamera(4, 3)},
+       {SceneGraph<double>::world_frame_id(), RigidTransformd(),
+        MakeColorCamera(8, 6), MakeDepthCamera(2, 1)}});
+  EXPECT_EQ(sensor.num_cameras(), 2);
+  EXPECT_EQ(sensor.num_input_ports(), 1);
+  EXPECT_EQ(sensor.num_output_ports(), 6);
+  EXPECT_EQ(sensor.query_object_input_port().get_name(), "geometry_query");
+  for (int i = 0; i < 2; ++i) {
+    const std::string suffix = "_" + std::to_string(i);
+    EXPECT_EQ(sensor.color_image_output_port(i).get_name(),
+              "color_image" + suffix);
+    EXPECT_EQ(sensor.depth_image_32F_output_port(i).get_name(),
+              "depth_image_32f" + suffix);
+    EXPECT_EQ(sensor.label_image_output_port(i).get_name(),
+              "label_image" + suffix);
+  }
+  EXPECT_EQ(sensor.camera(1).color_camera.core().intrinsics().width(), 8);
+  EXPECT_EQ(sensor.camera(1).depth_camera.core().intrinsics().width(), 2);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(sensor.camera(2), std::exception, ".*");
+  DRAKE_EXPECT_THROWS_MESSAGE(sensor.color_image_output_port(-1),
+                              std::exception, ".*");
+  DRAKE_EXPECT_THROWS_MESSAGE(sensor.depth_image_32F_output_port(2),
+                              std::exception, ".*");
+  DRAKE_EXPECT_THROWS_MESSAGE(sensor.label_image_output_port(2),
+                              std::exception, ".*");
+}
+
+// Confirms that all of the images are rendered together, once per change of
+// the geometry_query input, from the poses of their cameras.
+GTEST_TEST(MultiCameraRgbdSensorTest, RenderAllCameras) {
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  scene_graph->AddRenderer(kRendererName,
+                           std::make_unique<DummyRenderEngine>());
+  const SourceId source_id = scene_graph->RegisterSource("source");
+  const GeometryFrame frame("camera_frame");
+  scene_graph->RegisterFrame(source_id, frame);
+
+  // Camera 0 is anchored in the world. Camera 1 is affixed to the frame, and
+  // its depth camera is offset from its color camera.
+  const RigidTransformd X_WB0(Vector3d(1, 2, 3));
+  const RigidTransformd X_PB1(AngleAxisd(M_PI / 6, Vector3d(1, 1, 1)),
+                              Vector3d(1, 2, 3));
+  const RigidTransformd X_BD1(Vector3d(0, 0.02, 0));
+  auto* sensor = builder.AddSystem<MultiCameraRgbdSensor>(
+      std::vector<MultiCameraRgbdSensor::Camera>{
+          {SceneGraph<double>::world_frame_id(), X_WB0, MakeColorCamera(4, 3),
+           MakeDepthCamera(4, 3)},
+          {frame.id(), X_PB1, MakeColorCamera(4, 3),
+           MakeDepthCamera(2, 2, X_BD1)}});
+  builder.Connect(scene_graph->get_query_output_port(),
+                  sensor->query_object_input_port());
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  auto& scene_graph_context =
+      diagram->GetMutableSubsystemContext(*scene_graph, context.get());
+  const auto& sensor_context =
+      diagram->GetSubsystemContext(*sensor, *context);
+  const DummyRenderEngine& render_engine =
+      GeometryStateTester<double>::GetDummyRenderEngine(scene_graph_context,
+                                                        kRendererName);
+
+  const RigidTransformd X_WP(AngleAxisd(M_PI / 7, Vector3d(-1, 0, 1)),
+                             Vector3d(-2, -1, -3));
+  scene_graph->get_source_pose_port(source_id).FixValue(
+      &scene_graph_context, FramePoseVector<double>{{frame.id(), X_WP}});
+
+  auto eval_all = [&]() {
+    for (int i = 0; i < 2; ++i) {
+      sensor->color_image_output_port(i).Eval<ImageRgba8U>(sensor_context);
+      sensor->depth_image_32F_output_port(i).Eval<ImageDepth32F>(
+          sensor_context);
+      sensor->label_image_output_port(i).Eval<ImageLabel16I>(sensor_context);
+    }
+  };
+  eval_all();
+  EXPECT_EQ(render_engine.num_color_renders(), 2);
+  EXPECT_EQ(render_engine.num_depth_renders(), 2);
+  EXPECT_EQ(render_engine.num_label_renders(), 2);
+  // The last image rendered is the depth image of camera 1.
+  EXPECT_TRUE(CompareMatrices(render_engine.last_updated_X_WC().GetAsMatrix4(),
+                              (X_WP * X_PB1 * X_BD1).GetAsMatrix4(), 1e-14));
+  EXPECT_EQ(render_engine.last_depth_camera().core().intrinsics().width(), 2);
+  const ImageDepth32F& depth =
+      sensor->depth_image_32F_output_port(1).Eval<ImageDepth32F>(
+          sensor_context);
+  EXPECT_EQ(depth.width(), 2);
+  EXPECT_EQ(depth.height(), 2);
+
+  // Evaluating again renders nothing new.
+  eval_all();
+  EXPECT_EQ(render_engine.num_color_renders(), 2);
+  EXPECT_EQ(render_engine.num_depth_renders(), 2);
+  EXPECT_EQ(render_engine.num_label_renders(), 2);
+
+  // Moving the frame renders all of the images again.
+  const RigidTransformd X_WP2(Vector3d(4, 5, 6));
+  scene_graph->get_source_pose_port(source_id).FixValue(
+      &scene_graph_context, FramePoseVector<double>{{frame.id(), X_WP2}});
+  sensor->label_image_output_port(0).Eval<ImageLabel16I>(sensor_context);
+  EXPECT_EQ(render_engine.num_color_renders(), 4);
+  EXPECT_EQ(render_engine.num_depth_renders(), 4);
+  EXPECT_EQ(render_engine.num_label_renders(), 4);
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake